@@ -28,6 +28,8 @@
 #include "kissmath/transform2d.hpp"
 #include "kissmath/transform3d.hpp"
 
+#include "kissmath/quat.hpp"
+
 using namespace kissmath;
 
 #include "kissmath_colors.hpp"
@@ -1,6 +1,9 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_BOOL_CPP
+#define KISSMATH_BOOL_CPP
 #include "bool.hpp"
 
 namespace kissmath {
 }
 
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -7,3 +8,6 @@
 namespace kissmath {
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "bool.cpp"
+#endif
@@ -0,0 +1,13 @@
+#pragma once
+
+// Define KISSMATH_HEADER_ONLY (for the whole project) to compile kissmath header only
+//  every header then includes its .cpp at the end, all functions become inline and the trivial ones (eg. float3 operator+) constexpr
+//  so that the compiler can inline and constant fold them without needing LTO, the .cpp files then compile to nothing
+//  without it the functions are compiled once in the .cpp files like before (faster compile times, but every vector op is a call without LTO)
+#ifdef KISSMATH_HEADER_ONLY
+	#define KISSMATH_INLINE		inline
+	#define KISSMATH_CONSTEXPR	constexpr
+#else
+	#define KISSMATH_INLINE
+	#define KISSMATH_CONSTEXPR
+#endif
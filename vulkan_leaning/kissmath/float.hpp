@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include <cmath>
 #include <limits> // for std::numeric_limits<float>::quiet_NaN()
@@ -24,11 +25,11 @@ namespace kissmath {
 	
 	// clamp x into range [a, b]
 	// equivalent to min(max(x,a), b)
-	float clamp (float x, float a, float b);
+	KISSMATH_CONSTEXPR float clamp (float x, float a, float b);
 	
 	// clamp x into range [0, 1]
 	// also known as saturate in hlsl
-	float clamp (float x);
+	KISSMATH_CONSTEXPR float clamp (float x);
 	
 	
 	//// Math constants
@@ -63,48 +64,48 @@ namespace kissmath {
 	
 	
 	// returns the greater value of a and b
-	float min (float l, float r);
+	KISSMATH_CONSTEXPR float min (float l, float r);
 	
 	// returns the smaller value of a and b
-	float max (float l, float r);
+	KISSMATH_CONSTEXPR float max (float l, float r);
 	
 	// equivalent to ternary c ? l : r
 	// for conformity with vectors
-	float select (bool c, float l, float r);
+	KISSMATH_CONSTEXPR float select (bool c, float l, float r);
 	
 	
 	//// Angle conversion
 	
 	// converts degrees to radiants
-	float to_radians (float deg);
+	KISSMATH_CONSTEXPR float to_radians (float deg);
 	
 	// converts radiants to degrees
-	float to_degrees (float rad);
+	KISSMATH_CONSTEXPR float to_degrees (float rad);
 	
 	// converts degrees to radiants
 	// shortform to make degree literals more readable
-	float deg (float deg);
+	KISSMATH_CONSTEXPR float deg (float deg);
 	
 	// converts degrees to radiants
 	// spcial shortform to make degree literals more readable and allow to use integer literals (deg(5) would throw error)
-	float deg (int deg);
+	KISSMATH_CONSTEXPR float deg (int deg);
 	
 	//// Linear interpolation
 	
 	// linear interpolation
 	// like getting the output of a linear function
 	// ex. t=0 -> a ; t=1 -> b ; t=0.5 -> (a+b)/2
-	float lerp (float a, float b, float t);
+	KISSMATH_CONSTEXPR float lerp (float a, float b, float t);
 	
 	// linear mapping
 	// sometimes called inverse linear interpolation
 	// like getting the x for a y on a linear function
 	// ex. map(70, 0,100) -> 0.7 ; map(0.5, -1,+1) -> 0.75
-	float map (float x, float in_a, float in_b);
+	KISSMATH_CONSTEXPR float map (float x, float in_a, float in_b);
 	
 	// linear remapping
 	// equivalent of lerp(out_a, out_b, map(x, in_a, in_b))
-	float map (float x, float in_a, float in_b, float out_a, float out_b);
+	KISSMATH_CONSTEXPR float map (float x, float in_a, float in_b, float out_a, float out_b);
 	
 	
 	//// Various interpolation
@@ -141,3 +142,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float.cpp"
+#endif
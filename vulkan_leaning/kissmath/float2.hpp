@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float.hpp"
 
@@ -44,10 +45,10 @@ namespace kissmath {
 		}
 
 		// truncate vector
-		float2 (float3 v);
+		KISSMATH_CONSTEXPR float2 (float3 v);
 
 		// truncate vector
-		float2 (float4 v);
+		KISSMATH_CONSTEXPR float2 (float4 v);
 		
 		
 		//// Truncating cast operators
@@ -56,16 +57,16 @@ namespace kissmath {
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator int64v2 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v2 () const;
 		
 		// type cast operator
-		explicit operator int2 () const;
+		KISSMATH_CONSTEXPR explicit operator int2 () const;
 		
 		// type cast operator
-		explicit operator uint8v2 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v2 () const;
 		
 		// type cast operator
-		explicit operator bool2 () const;
+		KISSMATH_CONSTEXPR explicit operator bool2 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -84,17 +85,17 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	float2 operator+ (float2 v);
+	KISSMATH_CONSTEXPR float2 operator+ (float2 v);
 	
-	float2 operator- (float2 v);
+	KISSMATH_CONSTEXPR float2 operator- (float2 v);
 	
-	float2 operator+ (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 operator+ (float2 l, float2 r);
 	
-	float2 operator- (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 operator- (float2 l, float2 r);
 	
-	float2 operator* (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 operator* (float2 l, float2 r);
 	
-	float2 operator/ (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 operator/ (float2 l, float2 r);
 	
 	
 	//// bitwise ops
@@ -103,28 +104,28 @@ namespace kissmath {
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator< (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator< (float2 l, float2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator<= (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator<= (float2 l, float2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator> (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator> (float2 l, float2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator>= (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator>= (float2 l, float2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator== (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator== (float2 l, float2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator!= (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool2 operator!= (float2 l, float2 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (float2 l, float2 r);
+	KISSMATH_CONSTEXPR bool equal (float2 l, float2 r);
 	
 	// componentwise ternary (c ? l : r)
-	float2 select (bool2 c, float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 select (bool2 c, float2 l, float2 r);
 	
 	
 	//// misc ops
@@ -132,16 +133,16 @@ namespace kissmath {
 	float2 abs (float2 v);
 	
 	// componentwise minimum
-	float2 min (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 min (float2 l, float2 r);
 	
 	// componentwise maximum
-	float2 max (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float2 max (float2 l, float2 r);
 	
 	// componentwise clamp into range [a,b]
-	float2 clamp (float2 x, float2 a, float2 b);
+	KISSMATH_CONSTEXPR float2 clamp (float2 x, float2 a, float2 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	float2 clamp (float2 x);
+	KISSMATH_CONSTEXPR float2 clamp (float2 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	float min_component (float2 v, int* min_index=nullptr);
@@ -182,31 +183,31 @@ namespace kissmath {
 	//// Angle conversion
 	
 	// converts degrees to radiants
-	float2 to_radians (float2 deg);
+	KISSMATH_CONSTEXPR float2 to_radians (float2 deg);
 	
 	// converts radiants to degrees
-	float2 to_degrees (float2 rad);
+	KISSMATH_CONSTEXPR float2 to_degrees (float2 rad);
 	
 	// converts degrees to radiants
 	// shortform to make degree literals more readable
-	float2 deg (float2 deg);
+	KISSMATH_CONSTEXPR float2 deg (float2 deg);
 	
 	//// Linear interpolation
 	
 	// linear interpolation
 	// like getting the output of a linear function
 	// ex. t=0 -> a ; t=1 -> b ; t=0.5 -> (a+b)/2
-	float2 lerp (float2 a, float2 b, float2 t);
+	KISSMATH_CONSTEXPR float2 lerp (float2 a, float2 b, float2 t);
 	
 	// linear mapping
 	// sometimes called inverse linear interpolation
 	// like getting the x for a y on a linear function
 	// ex. map(70, 0,100) -> 0.7 ; map(0.5, -1,+1) -> 0.75
-	float2 map (float2 x, float2 in_a, float2 in_b);
+	KISSMATH_CONSTEXPR float2 map (float2 x, float2 in_a, float2 in_b);
 	
 	// linear remapping
 	// equivalent of lerp(out_a, out_b, map(x, in_a, in_b))
-	float2 map (float2 x, float2 in_a, float2 in_b, float2 out_a, float2 out_b);
+	KISSMATH_CONSTEXPR float2 map (float2 x, float2 in_a, float2 in_b, float2 out_a, float2 out_b);
 	
 	
 	//// Various interpolation
@@ -230,7 +231,7 @@ namespace kissmath {
 	float length (float2 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	float length_sqr (float2 v);
+	KISSMATH_CONSTEXPR float length_sqr (float2 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (float2 a, float2 b);
@@ -242,15 +243,18 @@ namespace kissmath {
 	float2 normalizesafe (float2 v);
 	
 	// dot product
-	float dot (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float dot (float2 l, float2 r);
 	
 	// 2d cross product hack for convenient 2d stuff
 	// same as cross({T.name[:-2]}3(l, 0), {T.name[:-2]}3(r, 0)).z,
 	// ie. the cross product of the 2d vectors on the z=0 plane in 3d space and then return the z coord of that (signed mag of cross product)
-	float cross (float2 l, float2 r);
+	KISSMATH_CONSTEXPR float cross (float2 l, float2 r);
 	
 	// rotate 2d vector counterclockwise 90 deg, ie. float2(-y, x) which is fast
-	float2 rotate90 (float2 v);
+	KISSMATH_CONSTEXPR float2 rotate90 (float2 v);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float2.cpp"
+#endif
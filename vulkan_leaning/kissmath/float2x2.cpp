@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_FLOAT2X2_CPP
+#define KISSMATH_FLOAT2X2_CPP
 #include "float2x2.hpp"
 
 #include "float4x4.hpp"
@@ -11,17 +13,17 @@ namespace kissmath {
 	
 	
 	// get cell with row, column indecies
-	float const& float2x2::get (int r, int c) const {
+	KISSMATH_INLINE float const& float2x2::get (int r, int c) const {
 		return arr[c][r];
 	}
 	
 	// get matrix column
-	float2 const& float2x2::get_column (int indx) const {
+	KISSMATH_INLINE float2 const& float2x2::get_column (int indx) const {
 		return arr[indx];
 	}
 	
 	// get matrix row
-	float2 float2x2::get_row (int indx) const {
+	KISSMATH_INLINE float2 float2x2::get_row (int indx) const {
 		return float2(arr[0][indx], arr[1][indx]);
 	}
 	
@@ -29,19 +31,19 @@ namespace kissmath {
 	
 	
 	// uninitialized constructor
-	float2x2::float2x2 () {
+	KISSMATH_INLINE float2x2::float2x2 () {
 		
 	}
 	
 	// supply one value for all cells
-	float2x2::float2x2 (float all): 
+	KISSMATH_INLINE float2x2::float2x2 (float all): 
 	arr{float2(all, all),
 		float2(all, all)} {
 		
 	}
 	
 	// supply all cells, in row major order for readability -> c<row><column>
-	float2x2::float2x2 (float c00, float c01,
+	KISSMATH_INLINE float2x2::float2x2 (float c00, float c01,
 						float c10, float c11): 
 	arr{float2(c00, c10),
 		float2(c01, c11)} {
@@ -51,26 +53,26 @@ namespace kissmath {
 	// static rows() and columns() methods are preferred over constructors, to avoid confusion if column or row vectors are supplied to the constructor
 	
 	// supply all row vectors
-	float2x2 float2x2::rows (float2 row0, float2 row1) {
+	KISSMATH_INLINE float2x2 float2x2::rows (float2 row0, float2 row1) {
 		return float2x2(row0[0], row0[1],
 						row1[0], row1[1]);
 	}
 	
 	// supply all cells in row major order
-	float2x2 float2x2::rows (float c00, float c01,
+	KISSMATH_INLINE float2x2 float2x2::rows (float c00, float c01,
 							 float c10, float c11) {
 		return float2x2(c00, c01,
 						c10, c11);
 	}
 	
 	// supply all column vectors
-	float2x2 float2x2::columns (float2 col0, float2 col1) {
+	KISSMATH_INLINE float2x2 float2x2::columns (float2 col0, float2 col1) {
 		return float2x2(col0[0], col1[0],
 						col0[1], col1[1]);
 	}
 	
 	// supply all cells in column major order
-	float2x2 float2x2::columns (float c00, float c10,
+	KISSMATH_INLINE float2x2 float2x2::columns (float c00, float c10,
 								float c01, float c11) {
 		return float2x2(c00, c01,
 						c10, c11);
@@ -78,7 +80,7 @@ namespace kissmath {
 	
 	
 	// identity matrix
-	float2x2 float2x2::identity () {
+	KISSMATH_INLINE float2x2 float2x2::identity () {
 		return float2x2(1,0,
 						0,1);
 	}
@@ -87,7 +89,7 @@ namespace kissmath {
 	
 	
 	// extend/truncate matrix of other size
-	float2x2::operator float4x4 () const {
+	KISSMATH_INLINE float2x2::operator float4x4 () const {
 		return float4x4(arr[0][0], arr[1][0],         0,         0,
 						arr[0][1], arr[1][1],         0,         0,
 						        0,         0,         1,         0,
@@ -95,14 +97,14 @@ namespace kissmath {
 	}
 	
 	// extend/truncate matrix of other size
-	float2x2::operator float3x4 () const {
+	KISSMATH_INLINE float2x2::operator float3x4 () const {
 		return float3x4(arr[0][0], arr[1][0],         0,         0,
 						arr[0][1], arr[1][1],         0,         0,
 						        0,         0,         1,         0);
 	}
 	
 	// extend/truncate matrix of other size
-	float2x2::operator float3x3 () const {
+	KISSMATH_INLINE float2x2::operator float3x3 () const {
 		return float3x3(arr[0][0], arr[1][0],         0,
 						arr[0][1], arr[1][1],         0,
 						        0,         0,         1);
@@ -112,25 +114,25 @@ namespace kissmath {
 	
 	
 	// add scalar to all matrix cells
-	float2x2& float2x2::operator+= (float r) {
+	KISSMATH_INLINE float2x2& float2x2::operator+= (float r) {
 		*this = *this + r;
 		return *this;
 	}
 	
 	// substract scalar from all matrix cells
-	float2x2& float2x2::operator-= (float r) {
+	KISSMATH_INLINE float2x2& float2x2::operator-= (float r) {
 		*this = *this - r;
 		return *this;
 	}
 	
 	// multiply scalar with all matrix cells
-	float2x2& float2x2::operator*= (float r) {
+	KISSMATH_INLINE float2x2& float2x2::operator*= (float r) {
 		*this = *this * r;
 		return *this;
 	}
 	
 	// divide all matrix cells by scalar
-	float2x2& float2x2::operator/= (float r) {
+	KISSMATH_INLINE float2x2& float2x2::operator/= (float r) {
 		*this = *this / r;
 		return *this;
 	}
@@ -139,7 +141,7 @@ namespace kissmath {
 	
 	
 	// matrix-matrix muliplication
-	float2x2& float2x2::operator*= (float2x2 const& r) {
+	KISSMATH_INLINE float2x2& float2x2::operator*= (float2x2 const& r) {
 		*this = *this * r;
 		return *this;
 	}
@@ -149,76 +151,76 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell + matrix_cell
-	float2x2 operator+ (float2x2 const& l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator+ (float2x2 const& l, float2x2 const& r) {
 		return float2x2(l.arr[0][0] + r.arr[0][0], l.arr[1][0] + r.arr[1][0],
 						l.arr[0][1] + r.arr[0][1], l.arr[1][1] + r.arr[1][1]);
 	}
 	
 	// componentwise matrix_cell + scalar
-	float2x2 operator+ (float2x2 const& l, float r) {
+	KISSMATH_INLINE float2x2 operator+ (float2x2 const& l, float r) {
 		return float2x2(l.arr[0][0] + r, l.arr[1][0] + r,
 						l.arr[0][1] + r, l.arr[1][1] + r);
 	}
 	
 	// componentwise scalar + matrix_cell
-	float2x2 operator+ (float l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator+ (float l, float2x2 const& r) {
 		return float2x2(l + r.arr[0][0], l + r.arr[1][0],
 						l + r.arr[0][1], l + r.arr[1][1]);
 	}
 	
 	
 	// componentwise matrix_cell - matrix_cell
-	float2x2 operator- (float2x2 const& l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator- (float2x2 const& l, float2x2 const& r) {
 		return float2x2(l.arr[0][0] - r.arr[0][0], l.arr[1][0] - r.arr[1][0],
 						l.arr[0][1] - r.arr[0][1], l.arr[1][1] - r.arr[1][1]);
 	}
 	
 	// componentwise matrix_cell - scalar
-	float2x2 operator- (float2x2 const& l, float r) {
+	KISSMATH_INLINE float2x2 operator- (float2x2 const& l, float r) {
 		return float2x2(l.arr[0][0] - r, l.arr[1][0] - r,
 						l.arr[0][1] - r, l.arr[1][1] - r);
 	}
 	
 	// componentwise scalar - matrix_cell
-	float2x2 operator- (float l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator- (float l, float2x2 const& r) {
 		return float2x2(l - r.arr[0][0], l - r.arr[1][0],
 						l - r.arr[0][1], l - r.arr[1][1]);
 	}
 	
 	
 	// componentwise matrix_cell * matrix_cell
-	float2x2 mul_componentwise (float2x2 const& l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 mul_componentwise (float2x2 const& l, float2x2 const& r) {
 		return float2x2(l.arr[0][0] * r.arr[0][0], l.arr[1][0] * r.arr[1][0],
 						l.arr[0][1] * r.arr[0][1], l.arr[1][1] * r.arr[1][1]);
 	}
 	
 	// componentwise matrix_cell * scalar
-	float2x2 operator* (float2x2 const& l, float r) {
+	KISSMATH_INLINE float2x2 operator* (float2x2 const& l, float r) {
 		return float2x2(l.arr[0][0] * r, l.arr[1][0] * r,
 						l.arr[0][1] * r, l.arr[1][1] * r);
 	}
 	
 	// componentwise scalar * matrix_cell
-	float2x2 operator* (float l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator* (float l, float2x2 const& r) {
 		return float2x2(l * r.arr[0][0], l * r.arr[1][0],
 						l * r.arr[0][1], l * r.arr[1][1]);
 	}
 	
 	
 	// componentwise matrix_cell / matrix_cell
-	float2x2 div_componentwise (float2x2 const& l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 div_componentwise (float2x2 const& l, float2x2 const& r) {
 		return float2x2(l.arr[0][0] / r.arr[0][0], l.arr[1][0] / r.arr[1][0],
 						l.arr[0][1] / r.arr[0][1], l.arr[1][1] / r.arr[1][1]);
 	}
 	
 	// componentwise matrix_cell / scalar
-	float2x2 operator/ (float2x2 const& l, float r) {
+	KISSMATH_INLINE float2x2 operator/ (float2x2 const& l, float r) {
 		return float2x2(l.arr[0][0] / r, l.arr[1][0] / r,
 						l.arr[0][1] / r, l.arr[1][1] / r);
 	}
 	
 	// componentwise scalar / matrix_cell
-	float2x2 operator/ (float l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator/ (float l, float2x2 const& r) {
 		return float2x2(l / r.arr[0][0], l / r.arr[1][0],
 						l / r.arr[0][1], l / r.arr[1][1]);
 	}
@@ -227,7 +229,7 @@ namespace kissmath {
 	
 	
 	// matrix-matrix multiply
-	float2x2 operator* (float2x2 const& l, float2x2 const& r) {
+	KISSMATH_INLINE float2x2 operator* (float2x2 const& l, float2x2 const& r) {
 		float2x2 ret;
 		ret.arr[0] = l * r.arr[0];
 		ret.arr[1] = l * r.arr[1];
@@ -235,7 +237,7 @@ namespace kissmath {
 	}
 	
 	// matrix-vector multiply
-	float2 operator* (float2x2 const& l, float2 r) {
+	KISSMATH_INLINE float2 operator* (float2x2 const& l, float2 r) {
 		float2 ret;
 		ret[0] = l.arr[0].x * r.x + l.arr[1].x * r.y;
 		ret[1] = l.arr[0].y * r.x + l.arr[1].y * r.y;
@@ -243,14 +245,14 @@ namespace kissmath {
 	}
 	
 	// vector-matrix multiply
-	float2 operator* (float2 l, float2x2 const& r) {
+	KISSMATH_INLINE float2 operator* (float2 l, float2x2 const& r) {
 		float2 ret;
 		ret[0] = l.x * r.arr[0].x + l.y * r.arr[0].y;
 		ret[1] = l.x * r.arr[1].x + l.y * r.arr[1].y;
 		return ret;
 	}
 	
-	float2x2 transpose (float2x2 const& m) {
+	KISSMATH_INLINE float2x2 transpose (float2x2 const& m) {
 		return float2x2::rows(m.arr[0], m.arr[1]);
 	}
 	
@@ -260,13 +262,13 @@ namespace kissmath {
 	float c = mat.arr[1][0]; \
 	float d = mat.arr[1][1];
 	
-	float determinant (float2x2 const& mat) {
+	KISSMATH_INLINE float determinant (float2x2 const& mat) {
 		LETTERIFY
 		
 		return a*d - b*c;
 	}
 	
-	float2x2 inverse (float2x2 const& mat) {
+	KISSMATH_INLINE float2x2 inverse (float2x2 const& mat) {
 		LETTERIFY
 		
 		float det;
@@ -297,3 +299,4 @@ namespace kissmath {
 	
 }
 
+#endif
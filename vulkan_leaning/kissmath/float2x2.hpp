@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float2.hpp"
 
@@ -155,3 +156,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float2x2.cpp"
+#endif
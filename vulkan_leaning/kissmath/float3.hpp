@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float.hpp"
 
@@ -40,31 +41,31 @@ namespace kissmath {
 		constexpr float3 (float x, float y, float z): x{x}, y{y}, z{z} {}
 		
 		// extend vector
-		float3 (float2 xy, float z);
+		KISSMATH_CONSTEXPR float3 (float2 xy, float z);
 		
 		// truncate vector
-		float3 (float4 v);
+		KISSMATH_CONSTEXPR float3 (float4 v);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator float2 () const;
+		KISSMATH_CONSTEXPR explicit operator float2 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator bool3 () const;
+		KISSMATH_CONSTEXPR explicit operator bool3 () const;
 		
 		// type cast operator
-		explicit operator uint8v3 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v3 () const;
 		
 		// type cast operator
-		explicit operator int64v3 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v3 () const;
 		
 		// type cast operator
-		explicit operator int3 () const;
+		KISSMATH_CONSTEXPR explicit operator int3 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -83,17 +84,17 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	float3 operator+ (float3 v);
+	KISSMATH_CONSTEXPR float3 operator+ (float3 v);
 	
-	float3 operator- (float3 v);
+	KISSMATH_CONSTEXPR float3 operator- (float3 v);
 	
-	float3 operator+ (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 operator+ (float3 l, float3 r);
 	
-	float3 operator- (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 operator- (float3 l, float3 r);
 	
-	float3 operator* (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 operator* (float3 l, float3 r);
 	
-	float3 operator/ (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 operator/ (float3 l, float3 r);
 	
 	
 	//// bitwise ops
@@ -102,28 +103,28 @@ namespace kissmath {
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator< (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator< (float3 l, float3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator<= (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator<= (float3 l, float3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator> (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator> (float3 l, float3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator>= (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator>= (float3 l, float3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator== (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator== (float3 l, float3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator!= (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool3 operator!= (float3 l, float3 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (float3 l, float3 r);
+	KISSMATH_CONSTEXPR bool equal (float3 l, float3 r);
 	
 	// componentwise ternary (c ? l : r)
-	float3 select (bool3 c, float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 select (bool3 c, float3 l, float3 r);
 	
 	
 	//// misc ops
@@ -131,16 +132,16 @@ namespace kissmath {
 	float3 abs (float3 v);
 	
 	// componentwise minimum
-	float3 min (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 min (float3 l, float3 r);
 	
 	// componentwise maximum
-	float3 max (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float3 max (float3 l, float3 r);
 	
 	// componentwise clamp into range [a,b]
-	float3 clamp (float3 x, float3 a, float3 b);
+	KISSMATH_CONSTEXPR float3 clamp (float3 x, float3 a, float3 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	float3 clamp (float3 x);
+	KISSMATH_CONSTEXPR float3 clamp (float3 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	float min_component (float3 v, int* min_index=nullptr);
@@ -181,31 +182,31 @@ namespace kissmath {
 	//// Angle conversion
 	
 	// converts degrees to radiants
-	float3 to_radians (float3 deg);
+	KISSMATH_CONSTEXPR float3 to_radians (float3 deg);
 	
 	// converts radiants to degrees
-	float3 to_degrees (float3 rad);
+	KISSMATH_CONSTEXPR float3 to_degrees (float3 rad);
 	
 	// converts degrees to radiants
 	// shortform to make degree literals more readable
-	float3 deg (float3 deg);
+	KISSMATH_CONSTEXPR float3 deg (float3 deg);
 	
 	//// Linear interpolation
 	
 	// linear interpolation
 	// like getting the output of a linear function
 	// ex. t=0 -> a ; t=1 -> b ; t=0.5 -> (a+b)/2
-	float3 lerp (float3 a, float3 b, float3 t);
+	KISSMATH_CONSTEXPR float3 lerp (float3 a, float3 b, float3 t);
 	
 	// linear mapping
 	// sometimes called inverse linear interpolation
 	// like getting the x for a y on a linear function
 	// ex. map(70, 0,100) -> 0.7 ; map(0.5, -1,+1) -> 0.75
-	float3 map (float3 x, float3 in_a, float3 in_b);
+	KISSMATH_CONSTEXPR float3 map (float3 x, float3 in_a, float3 in_b);
 	
 	// linear remapping
 	// equivalent of lerp(out_a, out_b, map(x, in_a, in_b))
-	float3 map (float3 x, float3 in_a, float3 in_b, float3 out_a, float3 out_b);
+	KISSMATH_CONSTEXPR float3 map (float3 x, float3 in_a, float3 in_b, float3 out_a, float3 out_b);
 	
 	
 	//// Various interpolation
@@ -229,7 +230,7 @@ namespace kissmath {
 	float length (float3 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	float length_sqr (float3 v);
+	KISSMATH_CONSTEXPR float length_sqr (float3 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (float3 a, float3 b);
@@ -241,10 +242,13 @@ namespace kissmath {
 	float3 normalizesafe (float3 v);
 	
 	// dot product
-	float dot (float3 l, float3 r);
+	KISSMATH_CONSTEXPR float dot (float3 l, float3 r);
 	
 	// 3d cross product
 	float3 cross (float3 l, float3 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float3.cpp"
+#endif
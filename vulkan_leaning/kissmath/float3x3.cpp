@@ -1,9 +1,12 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_FLOAT3X3_CPP
+#define KISSMATH_FLOAT3X3_CPP
 #include "float3x3.hpp"
 
 #include "float4x4.hpp"
 #include "float3x4.hpp"
 #include "float2x2.hpp"
+#include "simd_backend.hpp"
 
 namespace kissmath {
 	
@@ -11,17 +14,17 @@ namespace kissmath {
 	
 	
 	// get cell with row, column indecies
-	float const& float3x3::get (int r, int c) const {
+	KISSMATH_INLINE float const& float3x3::get (int r, int c) const {
 		return arr[c][r];
 	}
 	
 	// get matrix column
-	float3 const& float3x3::get_column (int indx) const {
+	KISSMATH_INLINE float3 const& float3x3::get_column (int indx) const {
 		return arr[indx];
 	}
 	
 	// get matrix row
-	float3 float3x3::get_row (int indx) const {
+	KISSMATH_INLINE float3 float3x3::get_row (int indx) const {
 		return float3(arr[0][indx], arr[1][indx], arr[2][indx]);
 	}
 	
@@ -29,12 +32,12 @@ namespace kissmath {
 	
 	
 	// uninitialized constructor
-	float3x3::float3x3 () {
+	KISSMATH_INLINE float3x3::float3x3 () {
 		
 	}
 	
 	// supply one value for all cells
-	float3x3::float3x3 (float all): 
+	KISSMATH_INLINE float3x3::float3x3 (float all): 
 	arr{float3(all, all, all),
 		float3(all, all, all),
 		float3(all, all, all)} {
@@ -54,14 +57,14 @@ namespace kissmath {
 	// static rows() and columns() methods are preferred over constructors, to avoid confusion if column or row vectors are supplied to the constructor
 	
 	// supply all row vectors
-	float3x3 float3x3::rows (float3 row0, float3 row1, float3 row2) {
+	KISSMATH_INLINE float3x3 float3x3::rows (float3 row0, float3 row1, float3 row2) {
 		return float3x3(row0[0], row0[1], row0[2],
 						row1[0], row1[1], row1[2],
 						row2[0], row2[1], row2[2]);
 	}
 	
 	// supply all cells in row major order
-	float3x3 float3x3::rows (float c00, float c01, float c02,
+	KISSMATH_INLINE float3x3 float3x3::rows (float c00, float c01, float c02,
 							 float c10, float c11, float c12,
 							 float c20, float c21, float c22) {
 		return float3x3(c00, c01, c02,
@@ -70,14 +73,14 @@ namespace kissmath {
 	}
 	
 	// supply all column vectors
-	float3x3 float3x3::columns (float3 col0, float3 col1, float3 col2) {
+	KISSMATH_INLINE float3x3 float3x3::columns (float3 col0, float3 col1, float3 col2) {
 		return float3x3(col0[0], col1[0], col2[0],
 						col0[1], col1[1], col2[1],
 						col0[2], col1[2], col2[2]);
 	}
 	
 	// supply all cells in column major order
-	float3x3 float3x3::columns (float c00, float c10, float c20,
+	KISSMATH_INLINE float3x3 float3x3::columns (float c00, float c10, float c20,
 								float c01, float c11, float c21,
 								float c02, float c12, float c22) {
 		return float3x3(c00, c01, c02,
@@ -97,7 +100,7 @@ namespace kissmath {
 	
 	
 	// extend/truncate matrix of other size
-	float3x3::operator float4x4 () const {
+	KISSMATH_INLINE float3x3::operator float4x4 () const {
 		return float4x4(arr[0][0], arr[1][0], arr[2][0],         0,
 						arr[0][1], arr[1][1], arr[2][1],         0,
 						arr[0][2], arr[1][2], arr[2][2],         0,
@@ -105,14 +108,14 @@ namespace kissmath {
 	}
 	
 	// extend/truncate matrix of other size
-	float3x3::operator float3x4 () const {
+	KISSMATH_INLINE float3x3::operator float3x4 () const {
 		return float3x4(arr[0][0], arr[1][0], arr[2][0],         0,
 						arr[0][1], arr[1][1], arr[2][1],         0,
 						arr[0][2], arr[1][2], arr[2][2],         0);
 	}
 	
 	// extend/truncate matrix of other size
-	float3x3::operator float2x2 () const {
+	KISSMATH_INLINE float3x3::operator float2x2 () const {
 		return float2x2(arr[0][0], arr[1][0],
 						arr[0][1], arr[1][1]);
 	}
@@ -121,25 +124,25 @@ namespace kissmath {
 	
 	
 	// add scalar to all matrix cells
-	float3x3& float3x3::operator+= (float r) {
+	KISSMATH_INLINE float3x3& float3x3::operator+= (float r) {
 		*this = *this + r;
 		return *this;
 	}
 	
 	// substract scalar from all matrix cells
-	float3x3& float3x3::operator-= (float r) {
+	KISSMATH_INLINE float3x3& float3x3::operator-= (float r) {
 		*this = *this - r;
 		return *this;
 	}
 	
 	// multiply scalar with all matrix cells
-	float3x3& float3x3::operator*= (float r) {
+	KISSMATH_INLINE float3x3& float3x3::operator*= (float r) {
 		*this = *this * r;
 		return *this;
 	}
 	
 	// divide all matrix cells by scalar
-	float3x3& float3x3::operator/= (float r) {
+	KISSMATH_INLINE float3x3& float3x3::operator/= (float r) {
 		*this = *this / r;
 		return *this;
 	}
@@ -148,7 +151,7 @@ namespace kissmath {
 	
 	
 	// matrix-matrix muliplication
-	float3x3& float3x3::operator*= (float3x3 const& r) {
+	KISSMATH_INLINE float3x3& float3x3::operator*= (float3x3 const& r) {
 		*this = *this * r;
 		return *this;
 	}
@@ -158,21 +161,21 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell + matrix_cell
-	float3x3 operator+ (float3x3 const& l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator+ (float3x3 const& l, float3x3 const& r) {
 		return float3x3(l.arr[0][0] + r.arr[0][0], l.arr[1][0] + r.arr[1][0], l.arr[2][0] + r.arr[2][0],
 						l.arr[0][1] + r.arr[0][1], l.arr[1][1] + r.arr[1][1], l.arr[2][1] + r.arr[2][1],
 						l.arr[0][2] + r.arr[0][2], l.arr[1][2] + r.arr[1][2], l.arr[2][2] + r.arr[2][2]);
 	}
 	
 	// componentwise matrix_cell + scalar
-	float3x3 operator+ (float3x3 const& l, float r) {
+	KISSMATH_INLINE float3x3 operator+ (float3x3 const& l, float r) {
 		return float3x3(l.arr[0][0] + r, l.arr[1][0] + r, l.arr[2][0] + r,
 						l.arr[0][1] + r, l.arr[1][1] + r, l.arr[2][1] + r,
 						l.arr[0][2] + r, l.arr[1][2] + r, l.arr[2][2] + r);
 	}
 	
 	// componentwise scalar + matrix_cell
-	float3x3 operator+ (float l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator+ (float l, float3x3 const& r) {
 		return float3x3(l + r.arr[0][0], l + r.arr[1][0], l + r.arr[2][0],
 						l + r.arr[0][1], l + r.arr[1][1], l + r.arr[2][1],
 						l + r.arr[0][2], l + r.arr[1][2], l + r.arr[2][2]);
@@ -180,21 +183,21 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell - matrix_cell
-	float3x3 operator- (float3x3 const& l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator- (float3x3 const& l, float3x3 const& r) {
 		return float3x3(l.arr[0][0] - r.arr[0][0], l.arr[1][0] - r.arr[1][0], l.arr[2][0] - r.arr[2][0],
 						l.arr[0][1] - r.arr[0][1], l.arr[1][1] - r.arr[1][1], l.arr[2][1] - r.arr[2][1],
 						l.arr[0][2] - r.arr[0][2], l.arr[1][2] - r.arr[1][2], l.arr[2][2] - r.arr[2][2]);
 	}
 	
 	// componentwise matrix_cell - scalar
-	float3x3 operator- (float3x3 const& l, float r) {
+	KISSMATH_INLINE float3x3 operator- (float3x3 const& l, float r) {
 		return float3x3(l.arr[0][0] - r, l.arr[1][0] - r, l.arr[2][0] - r,
 						l.arr[0][1] - r, l.arr[1][1] - r, l.arr[2][1] - r,
 						l.arr[0][2] - r, l.arr[1][2] - r, l.arr[2][2] - r);
 	}
 	
 	// componentwise scalar - matrix_cell
-	float3x3 operator- (float l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator- (float l, float3x3 const& r) {
 		return float3x3(l - r.arr[0][0], l - r.arr[1][0], l - r.arr[2][0],
 						l - r.arr[0][1], l - r.arr[1][1], l - r.arr[2][1],
 						l - r.arr[0][2], l - r.arr[1][2], l - r.arr[2][2]);
@@ -202,21 +205,21 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell * matrix_cell
-	float3x3 mul_componentwise (float3x3 const& l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 mul_componentwise (float3x3 const& l, float3x3 const& r) {
 		return float3x3(l.arr[0][0] * r.arr[0][0], l.arr[1][0] * r.arr[1][0], l.arr[2][0] * r.arr[2][0],
 						l.arr[0][1] * r.arr[0][1], l.arr[1][1] * r.arr[1][1], l.arr[2][1] * r.arr[2][1],
 						l.arr[0][2] * r.arr[0][2], l.arr[1][2] * r.arr[1][2], l.arr[2][2] * r.arr[2][2]);
 	}
 	
 	// componentwise matrix_cell * scalar
-	float3x3 operator* (float3x3 const& l, float r) {
+	KISSMATH_INLINE float3x3 operator* (float3x3 const& l, float r) {
 		return float3x3(l.arr[0][0] * r, l.arr[1][0] * r, l.arr[2][0] * r,
 						l.arr[0][1] * r, l.arr[1][1] * r, l.arr[2][1] * r,
 						l.arr[0][2] * r, l.arr[1][2] * r, l.arr[2][2] * r);
 	}
 	
 	// componentwise scalar * matrix_cell
-	float3x3 operator* (float l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator* (float l, float3x3 const& r) {
 		return float3x3(l * r.arr[0][0], l * r.arr[1][0], l * r.arr[2][0],
 						l * r.arr[0][1], l * r.arr[1][1], l * r.arr[2][1],
 						l * r.arr[0][2], l * r.arr[1][2], l * r.arr[2][2]);
@@ -224,21 +227,21 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell / matrix_cell
-	float3x3 div_componentwise (float3x3 const& l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 div_componentwise (float3x3 const& l, float3x3 const& r) {
 		return float3x3(l.arr[0][0] / r.arr[0][0], l.arr[1][0] / r.arr[1][0], l.arr[2][0] / r.arr[2][0],
 						l.arr[0][1] / r.arr[0][1], l.arr[1][1] / r.arr[1][1], l.arr[2][1] / r.arr[2][1],
 						l.arr[0][2] / r.arr[0][2], l.arr[1][2] / r.arr[1][2], l.arr[2][2] / r.arr[2][2]);
 	}
 	
 	// componentwise matrix_cell / scalar
-	float3x3 operator/ (float3x3 const& l, float r) {
+	KISSMATH_INLINE float3x3 operator/ (float3x3 const& l, float r) {
 		return float3x3(l.arr[0][0] / r, l.arr[1][0] / r, l.arr[2][0] / r,
 						l.arr[0][1] / r, l.arr[1][1] / r, l.arr[2][1] / r,
 						l.arr[0][2] / r, l.arr[1][2] / r, l.arr[2][2] / r);
 	}
 	
 	// componentwise scalar / matrix_cell
-	float3x3 operator/ (float l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator/ (float l, float3x3 const& r) {
 		return float3x3(l / r.arr[0][0], l / r.arr[1][0], l / r.arr[2][0],
 						l / r.arr[0][1], l / r.arr[1][1], l / r.arr[2][1],
 						l / r.arr[0][2], l / r.arr[1][2], l / r.arr[2][2]);
@@ -248,25 +251,33 @@ namespace kissmath {
 	
 	
 	// matrix-matrix multiply
-	float3x3 operator* (float3x3 const& l, float3x3 const& r) {
+	KISSMATH_INLINE float3x3 operator* (float3x3 const& l, float3x3 const& r) {
 		float3x3 ret;
+	#if KISSMATH_SIMD
+		simd_backend::mat33_mul(&ret.arr[0].x, &l.arr[0].x, &r.arr[0].x);
+	#else
 		ret.arr[0] = l * r.arr[0];
 		ret.arr[1] = l * r.arr[1];
 		ret.arr[2] = l * r.arr[2];
+	#endif
 		return ret;
 	}
 	
 	// matrix-vector multiply
-	float3 operator* (float3x3 const& l, float3 r) {
+	KISSMATH_INLINE float3 operator* (float3x3 const& l, float3 r) {
 		float3 ret;
+	#if KISSMATH_SIMD
+		simd_backend::store3(&ret.x, simd_backend::mat33_mul_vec(&l.arr[0].x, simd_backend::set3(r.x, r.y, r.z)));
+	#else
 		ret[0] = l.arr[0].x * r.x + l.arr[1].x * r.y + l.arr[2].x * r.z;
 		ret[1] = l.arr[0].y * r.x + l.arr[1].y * r.y + l.arr[2].y * r.z;
 		ret[2] = l.arr[0].z * r.x + l.arr[1].z * r.y + l.arr[2].z * r.z;
+	#endif
 		return ret;
 	}
 	
 	// vector-matrix multiply
-	float3 operator* (float3 l, float3x3 const& r) {
+	KISSMATH_INLINE float3 operator* (float3 l, float3x3 const& r) {
 		float3 ret;
 		ret[0] = l.x * r.arr[0].x + l.y * r.arr[0].y + l.z * r.arr[0].z;
 		ret[1] = l.x * r.arr[1].x + l.y * r.arr[1].y + l.z * r.arr[1].z;
@@ -274,7 +285,7 @@ namespace kissmath {
 		return ret;
 	}
 	
-	float3x3 transpose (float3x3 const& m) {
+	KISSMATH_INLINE float3x3 transpose (float3x3 const& m) {
 		return float3x3::rows(m.arr[0], m.arr[1], m.arr[2]);
 	}
 	
@@ -289,13 +300,18 @@ namespace kissmath {
 	float h = mat.arr[2][1]; \
 	float i = mat.arr[2][2];
 	
-	float determinant (float3x3 const& mat) {
+	KISSMATH_INLINE float determinant (float3x3 const& mat) {
 		LETTERIFY
 		
 		return +a*(e*i - f*h) -b*(d*i - f*g) +c*(d*h - e*g);
 	}
 	
-	float3x3 inverse (float3x3 const& mat) {
+	KISSMATH_INLINE float3x3 inverse (float3x3 const& mat) {
+	#if KISSMATH_SIMD
+		float3x3 ret;
+		simd_backend::mat33_inverse(&ret.arr[0].x, &mat.arr[0].x);
+		return ret;
+	#else
 		LETTERIFY
 		
 		float det;
@@ -330,9 +346,11 @@ namespace kissmath {
 		ret.arr[2][2] = cofac_22 *  inv_det;
 		
 		return ret;
+	#endif
 	}
 	
 	#undef LETTERIFY
 	
 }
 
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float3.hpp"
 
@@ -165,3 +166,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float3x3.cpp"
+#endif
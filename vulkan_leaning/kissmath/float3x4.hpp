@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float3.hpp"
 #include "float4.hpp"
@@ -166,5 +167,14 @@ namespace kissmath {
 	// shortform for float3x4 * float4(float3, 1)
 	float3 operator* (float3x4 const& l, float3 r);
 	
+	// l * float4(p, 1)
+	float3 transform_point (float3x4 const& l, float3 p);
+	
+	// l * float4(d, 0)
+	float3 transform_direction (float3x4 const& l, float3 d);
+	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float3x4.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float.hpp"
 
@@ -44,34 +45,34 @@ namespace kissmath {
 		}
 
 		// extend vector
-		float4 (float2 xy, float z, float w);
+		KISSMATH_CONSTEXPR float4 (float2 xy, float z, float w);
 		
 		// extend vector
-		float4 (float3 xyz, float w);
+		KISSMATH_CONSTEXPR float4 (float3 xyz, float w);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator float2 () const;
+		KISSMATH_CONSTEXPR explicit operator float2 () const;
 		
 		// truncating cast operator
-		explicit operator float3 () const;
+		KISSMATH_CONSTEXPR explicit operator float3 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator int64v4 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v4 () const;
 		
 		// type cast operator
-		explicit operator bool4 () const;
+		KISSMATH_CONSTEXPR explicit operator bool4 () const;
 		
 		// type cast operator
-		explicit operator uint8v4 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v4 () const;
 		
 		// type cast operator
-		explicit operator int4 () const;
+		KISSMATH_CONSTEXPR explicit operator int4 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -90,17 +91,17 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	float4 operator+ (float4 v);
+	KISSMATH_CONSTEXPR float4 operator+ (float4 v);
 	
-	float4 operator- (float4 v);
+	KISSMATH_CONSTEXPR float4 operator- (float4 v);
 	
-	float4 operator+ (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 operator+ (float4 l, float4 r);
 	
-	float4 operator- (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 operator- (float4 l, float4 r);
 	
-	float4 operator* (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 operator* (float4 l, float4 r);
 	
-	float4 operator/ (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 operator/ (float4 l, float4 r);
 	
 	
 	//// bitwise ops
@@ -109,28 +110,28 @@ namespace kissmath {
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator< (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator< (float4 l, float4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator<= (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator<= (float4 l, float4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator> (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator> (float4 l, float4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator>= (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator>= (float4 l, float4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator== (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator== (float4 l, float4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator!= (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool4 operator!= (float4 l, float4 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (float4 l, float4 r);
+	KISSMATH_CONSTEXPR bool equal (float4 l, float4 r);
 	
 	// componentwise ternary (c ? l : r)
-	float4 select (bool4 c, float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 select (bool4 c, float4 l, float4 r);
 	
 	
 	//// misc ops
@@ -138,16 +139,16 @@ namespace kissmath {
 	float4 abs (float4 v);
 	
 	// componentwise minimum
-	float4 min (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 min (float4 l, float4 r);
 	
 	// componentwise maximum
-	float4 max (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float4 max (float4 l, float4 r);
 	
 	// componentwise clamp into range [a,b]
-	float4 clamp (float4 x, float4 a, float4 b);
+	KISSMATH_CONSTEXPR float4 clamp (float4 x, float4 a, float4 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	float4 clamp (float4 x);
+	KISSMATH_CONSTEXPR float4 clamp (float4 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	float min_component (float4 v, int* min_index=nullptr);
@@ -188,31 +189,31 @@ namespace kissmath {
 	//// Angle conversion
 	
 	// converts degrees to radiants
-	float4 to_radians (float4 deg);
+	KISSMATH_CONSTEXPR float4 to_radians (float4 deg);
 	
 	// converts radiants to degrees
-	float4 to_degrees (float4 rad);
+	KISSMATH_CONSTEXPR float4 to_degrees (float4 rad);
 	
 	// converts degrees to radiants
 	// shortform to make degree literals more readable
-	float4 deg (float4 deg);
+	KISSMATH_CONSTEXPR float4 deg (float4 deg);
 	
 	//// Linear interpolation
 	
 	// linear interpolation
 	// like getting the output of a linear function
 	// ex. t=0 -> a ; t=1 -> b ; t=0.5 -> (a+b)/2
-	float4 lerp (float4 a, float4 b, float4 t);
+	KISSMATH_CONSTEXPR float4 lerp (float4 a, float4 b, float4 t);
 	
 	// linear mapping
 	// sometimes called inverse linear interpolation
 	// like getting the x for a y on a linear function
 	// ex. map(70, 0,100) -> 0.7 ; map(0.5, -1,+1) -> 0.75
-	float4 map (float4 x, float4 in_a, float4 in_b);
+	KISSMATH_CONSTEXPR float4 map (float4 x, float4 in_a, float4 in_b);
 	
 	// linear remapping
 	// equivalent of lerp(out_a, out_b, map(x, in_a, in_b))
-	float4 map (float4 x, float4 in_a, float4 in_b, float4 out_a, float4 out_b);
+	KISSMATH_CONSTEXPR float4 map (float4 x, float4 in_a, float4 in_b, float4 out_a, float4 out_b);
 	
 	
 	//// Various interpolation
@@ -236,7 +237,7 @@ namespace kissmath {
 	float length (float4 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	float length_sqr (float4 v);
+	KISSMATH_CONSTEXPR float length_sqr (float4 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (float4 a, float4 b);
@@ -248,7 +249,10 @@ namespace kissmath {
 	float4 normalizesafe (float4 v);
 	
 	// dot product
-	float dot (float4 l, float4 r);
+	KISSMATH_CONSTEXPR float dot (float4 l, float4 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float4.cpp"
+#endif
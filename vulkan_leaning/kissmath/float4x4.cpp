@@ -1,9 +1,12 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_FLOAT4X4_CPP
+#define KISSMATH_FLOAT4X4_CPP
 #include "float4x4.hpp"
 
 #include "float3x4.hpp"
 #include "float2x2.hpp"
 #include "float3x3.hpp"
+#include "simd_backend.hpp"
 
 namespace kissmath {
 	
@@ -11,17 +14,17 @@ namespace kissmath {
 	
 	
 	// get cell with row, column indecies
-	float const& float4x4::get (int r, int c) const {
+	KISSMATH_INLINE float const& float4x4::get (int r, int c) const {
 		return arr[c][r];
 	}
 	
 	// get matrix column
-	float4 const& float4x4::get_column (int indx) const {
+	KISSMATH_INLINE float4 const& float4x4::get_column (int indx) const {
 		return arr[indx];
 	}
 	
 	// get matrix row
-	float4 float4x4::get_row (int indx) const {
+	KISSMATH_INLINE float4 float4x4::get_row (int indx) const {
 		return float4(arr[0][indx], arr[1][indx], arr[2][indx], arr[3][indx]);
 	}
 	
@@ -29,12 +32,12 @@ namespace kissmath {
 	
 	
 	// uninitialized constructor
-	float4x4::float4x4 () {
+	KISSMATH_INLINE float4x4::float4x4 () {
 		
 	}
 	
 	// supply one value for all cells
-	float4x4::float4x4 (float all): 
+	KISSMATH_INLINE float4x4::float4x4 (float all): 
 	arr{float4(all, all, all, all),
 		float4(all, all, all, all),
 		float4(all, all, all, all),
@@ -57,7 +60,7 @@ namespace kissmath {
 	// static rows() and columns() methods are preferred over constructors, to avoid confusion if column or row vectors are supplied to the constructor
 	
 	// supply all row vectors
-	float4x4 float4x4::rows (float4 row0, float4 row1, float4 row2, float4 row3) {
+	KISSMATH_INLINE float4x4 float4x4::rows (float4 row0, float4 row1, float4 row2, float4 row3) {
 		return float4x4(row0[0], row0[1], row0[2], row0[3],
 						row1[0], row1[1], row1[2], row1[3],
 						row2[0], row2[1], row2[2], row2[3],
@@ -65,7 +68,7 @@ namespace kissmath {
 	}
 	
 	// supply all cells in row major order
-	float4x4 float4x4::rows (float c00, float c01, float c02, float c03,
+	KISSMATH_INLINE float4x4 float4x4::rows (float c00, float c01, float c02, float c03,
 							 float c10, float c11, float c12, float c13,
 							 float c20, float c21, float c22, float c23,
 							 float c30, float c31, float c32, float c33) {
@@ -76,7 +79,7 @@ namespace kissmath {
 	}
 	
 	// supply all column vectors
-	float4x4 float4x4::columns (float4 col0, float4 col1, float4 col2, float4 col3) {
+	KISSMATH_INLINE float4x4 float4x4::columns (float4 col0, float4 col1, float4 col2, float4 col3) {
 		return float4x4(col0[0], col1[0], col2[0], col3[0],
 						col0[1], col1[1], col2[1], col3[1],
 						col0[2], col1[2], col2[2], col3[2],
@@ -84,7 +87,7 @@ namespace kissmath {
 	}
 	
 	// supply all cells in column major order
-	float4x4 float4x4::columns (float c00, float c10, float c20, float c30,
+	KISSMATH_INLINE float4x4 float4x4::columns (float c00, float c10, float c20, float c30,
 								float c01, float c11, float c21, float c31,
 								float c02, float c12, float c22, float c32,
 								float c03, float c13, float c23, float c33) {
@@ -96,7 +99,7 @@ namespace kissmath {
 	
 	
 	// identity matrix
-	float4x4 float4x4::identity () {
+	KISSMATH_INLINE float4x4 float4x4::identity () {
 		return float4x4(1,0,0,0,
 						0,1,0,0,
 						0,0,1,0,
@@ -107,20 +110,20 @@ namespace kissmath {
 	
 	
 	// extend/truncate matrix of other size
-	float4x4::operator float3x4 () const {
+	KISSMATH_INLINE float4x4::operator float3x4 () const {
 		return float3x4(arr[0][0], arr[1][0], arr[2][0], arr[3][0],
 						arr[0][1], arr[1][1], arr[2][1], arr[3][1],
 						arr[0][2], arr[1][2], arr[2][2], arr[3][2]);
 	}
 	
 	// extend/truncate matrix of other size
-	float4x4::operator float2x2 () const {
+	KISSMATH_INLINE float4x4::operator float2x2 () const {
 		return float2x2(arr[0][0], arr[1][0],
 						arr[0][1], arr[1][1]);
 	}
 	
 	// extend/truncate matrix of other size
-	float4x4::operator float3x3 () const {
+	KISSMATH_INLINE float4x4::operator float3x3 () const {
 		return float3x3(arr[0][0], arr[1][0], arr[2][0],
 						arr[0][1], arr[1][1], arr[2][1],
 						arr[0][2], arr[1][2], arr[2][2]);
@@ -130,25 +133,25 @@ namespace kissmath {
 	
 	
 	// add scalar to all matrix cells
-	float4x4& float4x4::operator+= (float r) {
+	KISSMATH_INLINE float4x4& float4x4::operator+= (float r) {
 		*this = *this + r;
 		return *this;
 	}
 	
 	// substract scalar from all matrix cells
-	float4x4& float4x4::operator-= (float r) {
+	KISSMATH_INLINE float4x4& float4x4::operator-= (float r) {
 		*this = *this - r;
 		return *this;
 	}
 	
 	// multiply scalar with all matrix cells
-	float4x4& float4x4::operator*= (float r) {
+	KISSMATH_INLINE float4x4& float4x4::operator*= (float r) {
 		*this = *this * r;
 		return *this;
 	}
 	
 	// divide all matrix cells by scalar
-	float4x4& float4x4::operator/= (float r) {
+	KISSMATH_INLINE float4x4& float4x4::operator/= (float r) {
 		*this = *this / r;
 		return *this;
 	}
@@ -157,7 +160,7 @@ namespace kissmath {
 	
 	
 	// matrix-matrix muliplication
-	float4x4& float4x4::operator*= (float4x4 const& r) {
+	KISSMATH_INLINE float4x4& float4x4::operator*= (float4x4 const& r) {
 		*this = *this * r;
 		return *this;
 	}
@@ -167,7 +170,7 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell + matrix_cell
-	float4x4 operator+ (float4x4 const& l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator+ (float4x4 const& l, float4x4 const& r) {
 		return float4x4(l.arr[0][0] + r.arr[0][0], l.arr[1][0] + r.arr[1][0], l.arr[2][0] + r.arr[2][0], l.arr[3][0] + r.arr[3][0],
 						l.arr[0][1] + r.arr[0][1], l.arr[1][1] + r.arr[1][1], l.arr[2][1] + r.arr[2][1], l.arr[3][1] + r.arr[3][1],
 						l.arr[0][2] + r.arr[0][2], l.arr[1][2] + r.arr[1][2], l.arr[2][2] + r.arr[2][2], l.arr[3][2] + r.arr[3][2],
@@ -175,7 +178,7 @@ namespace kissmath {
 	}
 	
 	// componentwise matrix_cell + scalar
-	float4x4 operator+ (float4x4 const& l, float r) {
+	KISSMATH_INLINE float4x4 operator+ (float4x4 const& l, float r) {
 		return float4x4(l.arr[0][0] + r, l.arr[1][0] + r, l.arr[2][0] + r, l.arr[3][0] + r,
 						l.arr[0][1] + r, l.arr[1][1] + r, l.arr[2][1] + r, l.arr[3][1] + r,
 						l.arr[0][2] + r, l.arr[1][2] + r, l.arr[2][2] + r, l.arr[3][2] + r,
@@ -183,7 +186,7 @@ namespace kissmath {
 	}
 	
 	// componentwise scalar + matrix_cell
-	float4x4 operator+ (float l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator+ (float l, float4x4 const& r) {
 		return float4x4(l + r.arr[0][0], l + r.arr[1][0], l + r.arr[2][0], l + r.arr[3][0],
 						l + r.arr[0][1], l + r.arr[1][1], l + r.arr[2][1], l + r.arr[3][1],
 						l + r.arr[0][2], l + r.arr[1][2], l + r.arr[2][2], l + r.arr[3][2],
@@ -192,7 +195,7 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell - matrix_cell
-	float4x4 operator- (float4x4 const& l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator- (float4x4 const& l, float4x4 const& r) {
 		return float4x4(l.arr[0][0] - r.arr[0][0], l.arr[1][0] - r.arr[1][0], l.arr[2][0] - r.arr[2][0], l.arr[3][0] - r.arr[3][0],
 						l.arr[0][1] - r.arr[0][1], l.arr[1][1] - r.arr[1][1], l.arr[2][1] - r.arr[2][1], l.arr[3][1] - r.arr[3][1],
 						l.arr[0][2] - r.arr[0][2], l.arr[1][2] - r.arr[1][2], l.arr[2][2] - r.arr[2][2], l.arr[3][2] - r.arr[3][2],
@@ -200,7 +203,7 @@ namespace kissmath {
 	}
 	
 	// componentwise matrix_cell - scalar
-	float4x4 operator- (float4x4 const& l, float r) {
+	KISSMATH_INLINE float4x4 operator- (float4x4 const& l, float r) {
 		return float4x4(l.arr[0][0] - r, l.arr[1][0] - r, l.arr[2][0] - r, l.arr[3][0] - r,
 						l.arr[0][1] - r, l.arr[1][1] - r, l.arr[2][1] - r, l.arr[3][1] - r,
 						l.arr[0][2] - r, l.arr[1][2] - r, l.arr[2][2] - r, l.arr[3][2] - r,
@@ -208,7 +211,7 @@ namespace kissmath {
 	}
 	
 	// componentwise scalar - matrix_cell
-	float4x4 operator- (float l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator- (float l, float4x4 const& r) {
 		return float4x4(l - r.arr[0][0], l - r.arr[1][0], l - r.arr[2][0], l - r.arr[3][0],
 						l - r.arr[0][1], l - r.arr[1][1], l - r.arr[2][1], l - r.arr[3][1],
 						l - r.arr[0][2], l - r.arr[1][2], l - r.arr[2][2], l - r.arr[3][2],
@@ -217,7 +220,7 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell * matrix_cell
-	float4x4 mul_componentwise (float4x4 const& l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 mul_componentwise (float4x4 const& l, float4x4 const& r) {
 		return float4x4(l.arr[0][0] * r.arr[0][0], l.arr[1][0] * r.arr[1][0], l.arr[2][0] * r.arr[2][0], l.arr[3][0] * r.arr[3][0],
 						l.arr[0][1] * r.arr[0][1], l.arr[1][1] * r.arr[1][1], l.arr[2][1] * r.arr[2][1], l.arr[3][1] * r.arr[3][1],
 						l.arr[0][2] * r.arr[0][2], l.arr[1][2] * r.arr[1][2], l.arr[2][2] * r.arr[2][2], l.arr[3][2] * r.arr[3][2],
@@ -225,7 +228,7 @@ namespace kissmath {
 	}
 	
 	// componentwise matrix_cell * scalar
-	float4x4 operator* (float4x4 const& l, float r) {
+	KISSMATH_INLINE float4x4 operator* (float4x4 const& l, float r) {
 		return float4x4(l.arr[0][0] * r, l.arr[1][0] * r, l.arr[2][0] * r, l.arr[3][0] * r,
 						l.arr[0][1] * r, l.arr[1][1] * r, l.arr[2][1] * r, l.arr[3][1] * r,
 						l.arr[0][2] * r, l.arr[1][2] * r, l.arr[2][2] * r, l.arr[3][2] * r,
@@ -233,7 +236,7 @@ namespace kissmath {
 	}
 	
 	// componentwise scalar * matrix_cell
-	float4x4 operator* (float l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator* (float l, float4x4 const& r) {
 		return float4x4(l * r.arr[0][0], l * r.arr[1][0], l * r.arr[2][0], l * r.arr[3][0],
 						l * r.arr[0][1], l * r.arr[1][1], l * r.arr[2][1], l * r.arr[3][1],
 						l * r.arr[0][2], l * r.arr[1][2], l * r.arr[2][2], l * r.arr[3][2],
@@ -242,7 +245,7 @@ namespace kissmath {
 	
 	
 	// componentwise matrix_cell / matrix_cell
-	float4x4 div_componentwise (float4x4 const& l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 div_componentwise (float4x4 const& l, float4x4 const& r) {
 		return float4x4(l.arr[0][0] / r.arr[0][0], l.arr[1][0] / r.arr[1][0], l.arr[2][0] / r.arr[2][0], l.arr[3][0] / r.arr[3][0],
 						l.arr[0][1] / r.arr[0][1], l.arr[1][1] / r.arr[1][1], l.arr[2][1] / r.arr[2][1], l.arr[3][1] / r.arr[3][1],
 						l.arr[0][2] / r.arr[0][2], l.arr[1][2] / r.arr[1][2], l.arr[2][2] / r.arr[2][2], l.arr[3][2] / r.arr[3][2],
@@ -250,7 +253,7 @@ namespace kissmath {
 	}
 	
 	// componentwise matrix_cell / scalar
-	float4x4 operator/ (float4x4 const& l, float r) {
+	KISSMATH_INLINE float4x4 operator/ (float4x4 const& l, float r) {
 		return float4x4(l.arr[0][0] / r, l.arr[1][0] / r, l.arr[2][0] / r, l.arr[3][0] / r,
 						l.arr[0][1] / r, l.arr[1][1] / r, l.arr[2][1] / r, l.arr[3][1] / r,
 						l.arr[0][2] / r, l.arr[1][2] / r, l.arr[2][2] / r, l.arr[3][2] / r,
@@ -258,7 +261,7 @@ namespace kissmath {
 	}
 	
 	// componentwise scalar / matrix_cell
-	float4x4 operator/ (float l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator/ (float l, float4x4 const& r) {
 		return float4x4(l / r.arr[0][0], l / r.arr[1][0], l / r.arr[2][0], l / r.arr[3][0],
 						l / r.arr[0][1], l / r.arr[1][1], l / r.arr[2][1], l / r.arr[3][1],
 						l / r.arr[0][2], l / r.arr[1][2], l / r.arr[2][2], l / r.arr[3][2],
@@ -269,37 +272,67 @@ namespace kissmath {
 	
 	
 	// matrix-matrix multiply
-	float4x4 operator* (float4x4 const& l, float4x4 const& r) {
+	KISSMATH_INLINE float4x4 operator* (float4x4 const& l, float4x4 const& r) {
 		float4x4 ret;
+	#if KISSMATH_SIMD
+		simd_backend::mat4_mul(&ret.arr[0].x, &l.arr[0].x, &r.arr[0].x);
+	#else
 		ret.arr[0] = l * r.arr[0];
 		ret.arr[1] = l * r.arr[1];
 		ret.arr[2] = l * r.arr[2];
 		ret.arr[3] = l * r.arr[3];
+	#endif
 		return ret;
 	}
 	
 	// matrix-vector multiply
-	float4 operator* (float4x4 const& l, float4 r) {
+	KISSMATH_INLINE float4 operator* (float4x4 const& l, float4 r) {
 		float4 ret;
+	#if KISSMATH_SIMD
+		simd_backend::store(&ret.x, simd_backend::mat4_mul_vec(&l.arr[0].x, simd_backend::set(r.x, r.y, r.z, r.w)));
+	#else
 		ret[0] = l.arr[0].x * r.x + l.arr[1].x * r.y + l.arr[2].x * r.z + l.arr[3].x * r.w;
 		ret[1] = l.arr[0].y * r.x + l.arr[1].y * r.y + l.arr[2].y * r.z + l.arr[3].y * r.w;
 		ret[2] = l.arr[0].z * r.x + l.arr[1].z * r.y + l.arr[2].z * r.z + l.arr[3].z * r.w;
 		ret[3] = l.arr[0].w * r.x + l.arr[1].w * r.y + l.arr[2].w * r.z + l.arr[3].w * r.w;
+	#endif
 		return ret;
 	}
 	
 	// vector-matrix multiply
-	float4 operator* (float4 l, float4x4 const& r) {
+	KISSMATH_INLINE float4 operator* (float4 l, float4x4 const& r) {
 		float4 ret;
+	#if KISSMATH_SIMD
+		simd_backend::store(&ret.x, simd_backend::vec_mul_mat4(simd_backend::set(l.x, l.y, l.z, l.w), &r.arr[0].x));
+	#else
 		ret[0] = l.x * r.arr[0].x + l.y * r.arr[0].y + l.z * r.arr[0].z + l.w * r.arr[0].w;
 		ret[1] = l.x * r.arr[1].x + l.y * r.arr[1].y + l.z * r.arr[1].z + l.w * r.arr[1].w;
 		ret[2] = l.x * r.arr[2].x + l.y * r.arr[2].y + l.z * r.arr[2].z + l.w * r.arr[2].w;
 		ret[3] = l.x * r.arr[3].x + l.y * r.arr[3].y + l.z * r.arr[3].z + l.w * r.arr[3].w;
+	#endif
 		return ret;
 	}
 	
-	float4x4 transpose (float4x4 const& m) {
+	KISSMATH_INLINE float4x4 transpose (float4x4 const& m) {
+	#if KISSMATH_SIMD
+		float4x4 ret;
+		simd_backend::mat4_transpose(&ret.arr[0].x, &m.arr[0].x);
+		return ret;
+	#else
 		return float4x4::rows(m.arr[0], m.arr[1], m.arr[2], m.arr[3]);
+	#endif
+	}
+	
+	// m * float4(p, 1) with perspective divide
+	KISSMATH_INLINE float3 transform_point (float4x4 const& m, float3 p) {
+		float4 r = m * float4(p, 1);
+		return float3(r.x, r.y, r.z) / r.w;
+	}
+	
+	// m * float4(d, 0)
+	KISSMATH_INLINE float3 transform_direction (float4x4 const& m, float3 d) {
+		float4 r = m * float4(d, 0);
+		return float3(r.x, r.y, r.z);
 	}
 	
 	#define LETTERIFY \
@@ -320,7 +353,7 @@ namespace kissmath {
 	float o = mat.arr[3][2]; \
 	float p = mat.arr[3][3];
 	
-	float determinant (float4x4 const& mat) {
+	KISSMATH_INLINE float determinant (float4x4 const& mat) {
 		LETTERIFY
 		
 		return +a*(+f*(k*p - l*o) -g*(j*p - l*n) +h*(j*o - k*n))
@@ -329,7 +362,12 @@ namespace kissmath {
 			   -d*(+e*(j*o - k*n) -f*(i*o - k*m) +g*(i*n - j*m));
 	}
 	
-	float4x4 inverse (float4x4 const& mat) {
+	KISSMATH_INLINE float4x4 inverse (float4x4 const& mat) {
+	#if KISSMATH_SIMD
+		float4x4 ret;
+		simd_backend::mat4_inverse(&ret.arr[0].x, &mat.arr[0].x);
+		return ret;
+	#else
 		LETTERIFY
 		
 		float det;
@@ -381,9 +419,11 @@ namespace kissmath {
 		ret.arr[3][3] = cofac_33 *  inv_det;
 		
 		return ret;
+	#endif
 	}
 	
 	#undef LETTERIFY
 	
 }
 
+#endif
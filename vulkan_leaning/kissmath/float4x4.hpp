@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "float4.hpp"
 
@@ -160,6 +161,12 @@ namespace kissmath {
 	
 	float4x4 transpose (float4x4 const& m);
 	
+	// m * float4(p, 1) with perspective divide
+	float3 transform_point (float4x4 const& m, float3 p);
+	
+	// m * float4(d, 0)
+	float3 transform_direction (float4x4 const& m, float3 d);
+	
 	
 	float determinant (float4x4 const& mat);
 	
@@ -167,3 +174,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "float4x4.cpp"
+#endif
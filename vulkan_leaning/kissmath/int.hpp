@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -23,21 +24,21 @@ namespace kissmath {
 	
 	// clamp x into range [a, b]
 	// equivalent to min(max(x,a), b)
-	int clamp (int x, int a, int b);
+	KISSMATH_CONSTEXPR int clamp (int x, int a, int b);
 
 	// clamp x into range [0, 1]
 	// also known as saturate in hlsl
-	int clamp (int x);
+	KISSMATH_CONSTEXPR int clamp (int x);
 
 	// returns the greater value of a and b
-	int min (int l, int r);
+	KISSMATH_CONSTEXPR int min (int l, int r);
 
 	// returns the smaller value of a and b
-	int max (int l, int r);
+	KISSMATH_CONSTEXPR int max (int l, int r);
 	
 	// equivalent to ternary c ? l : r
 	// for conformity with vectors
-	int select (bool c, int l, int r);
+	KISSMATH_CONSTEXPR int select (bool c, int l, int r);
 	
 	
 	// length(scalar) = abs(scalar)
@@ -59,3 +60,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "int.hpp"
 
@@ -34,16 +35,16 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		int2 (int all);
+		KISSMATH_CONSTEXPR int2 (int all);
 		
 		// supply all components
-		int2 (int x, int y);
+		KISSMATH_CONSTEXPR int2 (int x, int y);
 		
 		// truncate vector
-		int2 (int3 v);
+		KISSMATH_CONSTEXPR int2 (int3 v);
 		
 		// truncate vector
-		int2 (int4 v);
+		KISSMATH_CONSTEXPR int2 (int4 v);
 		
 		//// Truncating cast operators
 		
@@ -51,16 +52,16 @@ namespace kissmath {
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator int64v2 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v2 () const;
 		
 		// type cast operator
-		explicit operator float2 () const;
+		KISSMATH_CONSTEXPR explicit operator float2 () const;
 		
 		// type cast operator
-		explicit operator uint8v2 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v2 () const;
 		
 		// type cast operator
-		explicit operator bool2 () const;
+		KISSMATH_CONSTEXPR explicit operator bool2 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -79,55 +80,55 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	int2 operator+ (int2 v);
+	KISSMATH_CONSTEXPR int2 operator+ (int2 v);
 	
-	int2 operator- (int2 v);
+	KISSMATH_CONSTEXPR int2 operator- (int2 v);
 	
-	int2 operator+ (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator+ (int2 l, int2 r);
 	
-	int2 operator- (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator- (int2 l, int2 r);
 	
-	int2 operator* (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator* (int2 l, int2 r);
 	
-	int2 operator/ (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator/ (int2 l, int2 r);
 	
 	
 	//// bitwise ops
 	
-	int2 operator~ (int2 v);
+	KISSMATH_CONSTEXPR int2 operator~ (int2 v);
 	
-	int2 operator& (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator& (int2 l, int2 r);
 	
-	int2 operator| (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator| (int2 l, int2 r);
 	
-	int2 operator^ (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 operator^ (int2 l, int2 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator< (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator< (int2 l, int2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator<= (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator<= (int2 l, int2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator> (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator> (int2 l, int2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator>= (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator>= (int2 l, int2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator== (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator== (int2 l, int2 r);
 	
 	// componentwise comparison returns a bool vector
-	bool2 operator!= (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool2 operator!= (int2 l, int2 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int2 l, int2 r);
+	KISSMATH_CONSTEXPR bool equal (int2 l, int2 r);
 	
 	// componentwise ternary (c ? l : r)
-	int2 select (bool2 c, int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 select (bool2 c, int2 l, int2 r);
 	
 	
 	//// misc ops
@@ -135,16 +136,16 @@ namespace kissmath {
 	int2 abs (int2 v);
 	
 	// componentwise minimum
-	int2 min (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 min (int2 l, int2 r);
 	
 	// componentwise maximum
-	int2 max (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int2 max (int2 l, int2 r);
 	
 	// componentwise clamp into range [a,b]
-	int2 clamp (int2 x, int2 a, int2 b);
+	KISSMATH_CONSTEXPR int2 clamp (int2 x, int2 a, int2 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int2 clamp (int2 x);
+	KISSMATH_CONSTEXPR int2 clamp (int2 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	int min_component (int2 v, int* min_index=nullptr);
@@ -167,7 +168,7 @@ namespace kissmath {
 	float length (int2 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int length_sqr (int2 v);
+	KISSMATH_CONSTEXPR int length_sqr (int2 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (int2 a, int2 b);
@@ -179,15 +180,18 @@ namespace kissmath {
 	float2 normalizesafe (int2 v);
 	
 	// dot product
-	int dot (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int dot (int2 l, int2 r);
 	
 	// 2d cross product hack for convenient 2d stuff
 	// same as cross({T.name[:-2]}3(l, 0), {T.name[:-2]}3(r, 0)).z,
 	// ie. the cross product of the 2d vectors on the z=0 plane in 3d space and then return the z coord of that (signed mag of cross product)
-	int cross (int2 l, int2 r);
+	KISSMATH_CONSTEXPR int cross (int2 l, int2 r);
 	
 	// rotate 2d vector counterclockwise 90 deg, ie. int2(-y, x) which is fast
-	int2 rotate90 (int2 v);
+	KISSMATH_CONSTEXPR int2 rotate90 (int2 v);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int2.cpp"
+#endif
@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_INT3_CPP
+#define KISSMATH_INT3_CPP
 #include "int3.hpp"
 
 #include "bool3.hpp"
@@ -16,28 +18,28 @@ namespace kissmath {
 	typedef int64_t int64;
 	
 	// Component indexing operator
-	int& int3::operator[] (int i) {
+	KISSMATH_INLINE int& int3::operator[] (int i) {
 		return arr[i];
 	}
 	
 	// Component indexing operator
-	int const& int3::operator[] (int i) const {
+	KISSMATH_INLINE int const& int3::operator[] (int i) const {
 		return arr[i];
 	}
 	
 	
 	// uninitialized constructor
-	int3::int3 () {
+	KISSMATH_INLINE int3::int3 () {
 		
 	}
 	
 	// extend vector
-	int3::int3 (int2 xy, int z): x{xy.x}, y{xy.y}, z{z} {
+	KISSMATH_CONSTEXPR int3::int3 (int2 xy, int z): x{xy.x}, y{xy.y}, z{z} {
 		
 	}
 	
 	// truncate vector
-	int3::int3 (int4 v): x{v.x}, y{v.y}, z{v.z} {
+	KISSMATH_CONSTEXPR int3::int3 (int4 v): x{v.x}, y{v.y}, z{v.z} {
 		
 	}
 	
@@ -45,7 +47,7 @@ namespace kissmath {
 	
 	
 	// truncating cast operator
-	int3::operator int2 () const {
+	KISSMATH_CONSTEXPR int3::operator int2 () const {
 		return int2(x, y);
 	}
 	
@@ -53,28 +55,28 @@ namespace kissmath {
 	
 	
 	// type cast operator
-	int3::operator bool3 () const {
+	KISSMATH_CONSTEXPR int3::operator bool3 () const {
 		return bool3((bool)x, (bool)y, (bool)z);
 	}
 	
 	// type cast operator
-	int3::operator uint8v3 () const {
+	KISSMATH_CONSTEXPR int3::operator uint8v3 () const {
 		return uint8v3((uint8)x, (uint8)y, (uint8)z);
 	}
 	
 	// type cast operator
-	int3::operator int64v3 () const {
+	KISSMATH_CONSTEXPR int3::operator int64v3 () const {
 		return int64v3((int64)x, (int64)y, (int64)z);
 	}
 	
 	// type cast operator
-	int3::operator float3 () const {
+	KISSMATH_CONSTEXPR int3::operator float3 () const {
 		return float3((float)x, (float)y, (float)z);
 	}
 	
 	
 	// componentwise arithmetic operator
-	int3 int3::operator+= (int3 r) {
+	KISSMATH_INLINE int3 int3::operator+= (int3 r) {
 		x += r.x;
 		y += r.y;
 		z += r.z;
@@ -82,7 +84,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int3 int3::operator-= (int3 r) {
+	KISSMATH_INLINE int3 int3::operator-= (int3 r) {
 		x -= r.x;
 		y -= r.y;
 		z -= r.z;
@@ -90,7 +92,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int3 int3::operator*= (int3 r) {
+	KISSMATH_INLINE int3 int3::operator*= (int3 r) {
 		x *= r.x;
 		y *= r.y;
 		z *= r.z;
@@ -98,7 +100,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int3 int3::operator/= (int3 r) {
+	KISSMATH_INLINE int3 int3::operator/= (int3 r) {
 		x /= r.x;
 		y /= r.y;
 		z /= r.z;
@@ -108,46 +110,46 @@ namespace kissmath {
 	//// arthmethic ops
 	
 	
-	int3 operator+ (int3 v) {
+	KISSMATH_CONSTEXPR int3 operator+ (int3 v) {
 		return int3(+v.x, +v.y, +v.z);
 	}
 	
-	int3 operator- (int3 v) {
+	KISSMATH_CONSTEXPR int3 operator- (int3 v) {
 		return int3(-v.x, -v.y, -v.z);
 	}
 	
-	int3 operator+ (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator+ (int3 l, int3 r) {
 		return int3(l.x + r.x, l.y + r.y, l.z + r.z);
 	}
 	
-	int3 operator- (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator- (int3 l, int3 r) {
 		return int3(l.x - r.x, l.y - r.y, l.z - r.z);
 	}
 	
-	int3 operator* (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator* (int3 l, int3 r) {
 		return int3(l.x * r.x, l.y * r.y, l.z * r.z);
 	}
 	
-	int3 operator/ (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator/ (int3 l, int3 r) {
 		return int3(l.x / r.x, l.y / r.y, l.z / r.z);
 	}
 	
 	//// bitwise ops
 	
 	
-	int3 operator~ (int3 v) {
+	KISSMATH_CONSTEXPR int3 operator~ (int3 v) {
 		return int3(~v.x, ~v.y, ~v.z);
 	}
 	
-	int3 operator& (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator& (int3 l, int3 r) {
 		return int3(l.x & r.x, l.y & r.y, l.z & r.z);
 	}
 	
-	int3 operator| (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator| (int3 l, int3 r) {
 		return int3(l.x | r.x, l.y | r.y, l.z | r.z);
 	}
 	
-	int3 operator^ (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 operator^ (int3 l, int3 r) {
 		return int3(l.x ^ r.x, l.y ^ r.y, l.z ^ r.z);
 	}
 	
@@ -155,74 +157,74 @@ namespace kissmath {
 	
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator< (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator< (int3 l, int3 r) {
 		return bool3(l.x < r.x, l.y < r.y, l.z < r.z);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator<= (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator<= (int3 l, int3 r) {
 		return bool3(l.x <= r.x, l.y <= r.y, l.z <= r.z);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator> (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator> (int3 l, int3 r) {
 		return bool3(l.x > r.x, l.y > r.y, l.z > r.z);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator>= (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator>= (int3 l, int3 r) {
 		return bool3(l.x >= r.x, l.y >= r.y, l.z >= r.z);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator== (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator== (int3 l, int3 r) {
 		return bool3(l.x == r.x, l.y == r.y, l.z == r.z);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator!= (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool3 operator!= (int3 l, int3 r) {
 		return bool3(l.x != r.x, l.y != r.y, l.z != r.z);
 	}
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR bool equal (int3 l, int3 r) {
 		return all(l == r);
 	}
 	
 	// componentwise ternary (c ? l : r)
-	int3 select (bool3 c, int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 select (bool3 c, int3 l, int3 r) {
 		return int3(c.x ? l.x : r.x, c.y ? l.y : r.y, c.z ? l.z : r.z);
 	}
 	
 	//// misc ops
 	
 	// componentwise absolute
-	int3 abs (int3 v) {
+	KISSMATH_INLINE int3 abs (int3 v) {
 		return int3(abs(v.x), abs(v.y), abs(v.z));
 	}
 	
 	// componentwise minimum
-	int3 min (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 min (int3 l, int3 r) {
 		return int3(min(l.x,r.x), min(l.y,r.y), min(l.z,r.z));
 	}
 	
 	// componentwise maximum
-	int3 max (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int3 max (int3 l, int3 r) {
 		return int3(max(l.x,r.x), max(l.y,r.y), max(l.z,r.z));
 	}
 	
 	// componentwise clamp into range [a,b]
-	int3 clamp (int3 x, int3 a, int3 b) {
+	KISSMATH_CONSTEXPR int3 clamp (int3 x, int3 a, int3 b) {
 		return min(max(x,a), b);
 	}
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int3 clamp (int3 x) {
+	KISSMATH_CONSTEXPR int3 clamp (int3 x) {
 		return min(max(x, int(0)), int(1));
 	}
 	
 	// get minimum component of vector, optionally get component index via min_index
-	int min_component (int3 v, int* min_index) {
+	KISSMATH_INLINE int min_component (int3 v, int* min_index) {
 		int index = 0;
 		int min_val = v.x;	
 		for (int i=1; i<3; ++i) {
@@ -236,7 +238,7 @@ namespace kissmath {
 	}
 	
 	// get maximum component of vector, optionally get component index via max_index
-	int max_component (int3 v, int* max_index) {
+	KISSMATH_INLINE int max_component (int3 v, int* max_index) {
 		int index = 0;
 		int max_val = v.x;	
 		for (int i=1; i<3; ++i) {
@@ -251,12 +253,12 @@ namespace kissmath {
 	
 	
 	// componentwise wrap
-	int3 wrap (int3 v, int3 range) {
+	KISSMATH_INLINE int3 wrap (int3 v, int3 range) {
 		return int3(wrap(v.x,range.x), wrap(v.y,range.y), wrap(v.z,range.z));
 	}
 	
 	// componentwise wrap
-	int3 wrap (int3 v, int3 a, int3 b) {
+	KISSMATH_INLINE int3 wrap (int3 v, int3 a, int3 b) {
 		return int3(wrap(v.x,a.x,b.x), wrap(v.y,a.y,b.y), wrap(v.z,a.z,b.z));
 	}
 	
@@ -265,27 +267,27 @@ namespace kissmath {
 	
 	
 	// magnitude of vector
-	float length (int3 v) {
+	KISSMATH_INLINE float length (int3 v) {
 		return sqrt((float)(v.x * v.x + v.y * v.y + v.z * v.z));
 	}
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int length_sqr (int3 v) {
+	KISSMATH_CONSTEXPR int length_sqr (int3 v) {
 		return v.x * v.x + v.y * v.y + v.z * v.z;
 	}
 	
 	// distance between points, equivalent to length(a - b)
-	float distance (int3 a, int3 b) {
+	KISSMATH_INLINE float distance (int3 a, int3 b) {
 		return length(a - b);
 	}
 	
 	// normalize vector so that it has length() = 1, undefined for zero vector
-	float3 normalize (int3 v) {
+	KISSMATH_INLINE float3 normalize (int3 v) {
 		return float3(v) / length(v);
 	}
 	
 	// normalize vector so that it has length() = 1, returns zero vector if vector was zero vector
-	float3 normalizesafe (int3 v) {
+	KISSMATH_INLINE float3 normalizesafe (int3 v) {
 		float len = length(v);
 		if (len == float(0)) {
 			return float(0);
@@ -294,12 +296,12 @@ namespace kissmath {
 	}
 	
 	// dot product
-	int dot (int3 l, int3 r) {
+	KISSMATH_CONSTEXPR int dot (int3 l, int3 r) {
 		return l.x * r.x + l.y * r.y + l.z * r.z;
 	}
 	
 	// 3d cross product
-	int3 cross (int3 l, int3 r) {
+	KISSMATH_INLINE int3 cross (int3 l, int3 r) {
 		return int3(
 					l.y * r.z - l.z * r.y,
 					l.z * r.x - l.x * r.z,
@@ -307,3 +309,4 @@ namespace kissmath {
 	}
 }
 
+#endif
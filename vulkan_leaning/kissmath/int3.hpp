@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "int.hpp"
 
@@ -44,31 +45,31 @@ namespace kissmath {
 		}
 
 		// extend vector
-		int3 (int2 xy, int z);
+		KISSMATH_CONSTEXPR int3 (int2 xy, int z);
 		
 		// truncate vector
-		int3 (int4 v);
+		KISSMATH_CONSTEXPR int3 (int4 v);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator int2 () const;
+		KISSMATH_CONSTEXPR explicit operator int2 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator bool3 () const;
+		KISSMATH_CONSTEXPR explicit operator bool3 () const;
 		
 		// type cast operator
-		explicit operator uint8v3 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v3 () const;
 		
 		// type cast operator
-		explicit operator int64v3 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v3 () const;
 		
 		// type cast operator
-		explicit operator float3 () const;
+		KISSMATH_CONSTEXPR explicit operator float3 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -87,55 +88,55 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	int3 operator+ (int3 v);
+	KISSMATH_CONSTEXPR int3 operator+ (int3 v);
 	
-	int3 operator- (int3 v);
+	KISSMATH_CONSTEXPR int3 operator- (int3 v);
 	
-	int3 operator+ (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator+ (int3 l, int3 r);
 	
-	int3 operator- (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator- (int3 l, int3 r);
 	
-	int3 operator* (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator* (int3 l, int3 r);
 	
-	int3 operator/ (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator/ (int3 l, int3 r);
 	
 	
 	//// bitwise ops
 	
-	int3 operator~ (int3 v);
+	KISSMATH_CONSTEXPR int3 operator~ (int3 v);
 	
-	int3 operator& (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator& (int3 l, int3 r);
 	
-	int3 operator| (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator| (int3 l, int3 r);
 	
-	int3 operator^ (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 operator^ (int3 l, int3 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator< (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator< (int3 l, int3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator<= (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator<= (int3 l, int3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator> (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator> (int3 l, int3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator>= (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator>= (int3 l, int3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator== (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator== (int3 l, int3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator!= (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool3 operator!= (int3 l, int3 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int3 l, int3 r);
+	KISSMATH_CONSTEXPR bool equal (int3 l, int3 r);
 	
 	// componentwise ternary (c ? l : r)
-	int3 select (bool3 c, int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 select (bool3 c, int3 l, int3 r);
 	
 	
 	//// misc ops
@@ -143,16 +144,16 @@ namespace kissmath {
 	int3 abs (int3 v);
 	
 	// componentwise minimum
-	int3 min (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 min (int3 l, int3 r);
 	
 	// componentwise maximum
-	int3 max (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int3 max (int3 l, int3 r);
 	
 	// componentwise clamp into range [a,b]
-	int3 clamp (int3 x, int3 a, int3 b);
+	KISSMATH_CONSTEXPR int3 clamp (int3 x, int3 a, int3 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int3 clamp (int3 x);
+	KISSMATH_CONSTEXPR int3 clamp (int3 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	int min_component (int3 v, int* min_index=nullptr);
@@ -175,7 +176,7 @@ namespace kissmath {
 	float length (int3 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int length_sqr (int3 v);
+	KISSMATH_CONSTEXPR int length_sqr (int3 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (int3 a, int3 b);
@@ -187,10 +188,13 @@ namespace kissmath {
 	float3 normalizesafe (int3 v);
 	
 	// dot product
-	int dot (int3 l, int3 r);
+	KISSMATH_CONSTEXPR int dot (int3 l, int3 r);
 	
 	// 3d cross product
 	int3 cross (int3 l, int3 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int3.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "int.hpp"
 
@@ -34,40 +35,40 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		int4 (int all);
+		KISSMATH_CONSTEXPR int4 (int all);
 		
 		// supply all components
-		int4 (int x, int y, int z, int w);
+		KISSMATH_CONSTEXPR int4 (int x, int y, int z, int w);
 		
 		// extend vector
-		int4 (int2 xy, int z, int w);
+		KISSMATH_CONSTEXPR int4 (int2 xy, int z, int w);
 		
 		// extend vector
-		int4 (int3 xyz, int w);
+		KISSMATH_CONSTEXPR int4 (int3 xyz, int w);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator int2 () const;
+		KISSMATH_CONSTEXPR explicit operator int2 () const;
 		
 		// truncating cast operator
-		explicit operator int3 () const;
+		KISSMATH_CONSTEXPR explicit operator int3 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator int64v4 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v4 () const;
 		
 		// type cast operator
-		explicit operator bool4 () const;
+		KISSMATH_CONSTEXPR explicit operator bool4 () const;
 		
 		// type cast operator
-		explicit operator uint8v4 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v4 () const;
 		
 		// type cast operator
-		explicit operator float4 () const;
+		KISSMATH_CONSTEXPR explicit operator float4 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -86,55 +87,55 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	int4 operator+ (int4 v);
+	KISSMATH_CONSTEXPR int4 operator+ (int4 v);
 	
-	int4 operator- (int4 v);
+	KISSMATH_CONSTEXPR int4 operator- (int4 v);
 	
-	int4 operator+ (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator+ (int4 l, int4 r);
 	
-	int4 operator- (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator- (int4 l, int4 r);
 	
-	int4 operator* (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator* (int4 l, int4 r);
 	
-	int4 operator/ (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator/ (int4 l, int4 r);
 	
 	
 	//// bitwise ops
 	
-	int4 operator~ (int4 v);
+	KISSMATH_CONSTEXPR int4 operator~ (int4 v);
 	
-	int4 operator& (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator& (int4 l, int4 r);
 	
-	int4 operator| (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator| (int4 l, int4 r);
 	
-	int4 operator^ (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 operator^ (int4 l, int4 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator< (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator< (int4 l, int4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator<= (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator<= (int4 l, int4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator> (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator> (int4 l, int4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator>= (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator>= (int4 l, int4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator== (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator== (int4 l, int4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator!= (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool4 operator!= (int4 l, int4 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int4 l, int4 r);
+	KISSMATH_CONSTEXPR bool equal (int4 l, int4 r);
 	
 	// componentwise ternary (c ? l : r)
-	int4 select (bool4 c, int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 select (bool4 c, int4 l, int4 r);
 	
 	
 	//// misc ops
@@ -142,16 +143,16 @@ namespace kissmath {
 	int4 abs (int4 v);
 	
 	// componentwise minimum
-	int4 min (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 min (int4 l, int4 r);
 	
 	// componentwise maximum
-	int4 max (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int4 max (int4 l, int4 r);
 	
 	// componentwise clamp into range [a,b]
-	int4 clamp (int4 x, int4 a, int4 b);
+	KISSMATH_CONSTEXPR int4 clamp (int4 x, int4 a, int4 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int4 clamp (int4 x);
+	KISSMATH_CONSTEXPR int4 clamp (int4 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	int min_component (int4 v, int* min_index=nullptr);
@@ -174,7 +175,7 @@ namespace kissmath {
 	float length (int4 v);
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int length_sqr (int4 v);
+	KISSMATH_CONSTEXPR int length_sqr (int4 v);
 	
 	// distance between points, equivalent to length(a - b)
 	float distance (int4 a, int4 b);
@@ -186,7 +187,10 @@ namespace kissmath {
 	float4 normalizesafe (int4 v);
 	
 	// dot product
-	int dot (int4 l, int4 r);
+	KISSMATH_CONSTEXPR int dot (int4 l, int4 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int4.cpp"
+#endif
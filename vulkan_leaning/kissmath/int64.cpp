@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_INT64_CPP
+#define KISSMATH_INT64_CPP
 #include "int64.hpp"
 
 namespace kissmath {
@@ -6,7 +8,7 @@ namespace kissmath {
 	// wrap x into range [0,range)
 	// negative x wrap back to +range unlike c++ % operator
 	// negative range supported
-	int64 wrap (int64 x, int64 range) {
+	KISSMATH_INLINE int64 wrap (int64 x, int64 range) {
 		int64 modded = x % range;
 		if (range > 0) {
 			if (modded < 0) modded += range;
@@ -17,7 +19,7 @@ namespace kissmath {
 	}
 	
 	// wrap x into [a,b) range
-	int64 wrap (int64 x, int64 a, int64 b) {
+	KISSMATH_INLINE int64 wrap (int64 x, int64 a, int64 b) {
 		x -= a;
 		int64 range = b -a;
 		
@@ -28,42 +30,42 @@ namespace kissmath {
 	
 	// clamp x into range [a, b]
 	// equivalent to min(max(x,a), b)
-	int64 clamp (int64 x, int64 a, int64 b) {
+	KISSMATH_CONSTEXPR int64 clamp (int64 x, int64 a, int64 b) {
 		return min(max(x, a), b);
 	}
 	
 	// clamp x into range [0, 1]
 	// also known as saturate in hlsl
-	int64 clamp (int64 x) {
+	KISSMATH_CONSTEXPR int64 clamp (int64 x) {
 		return min(max(x, int64(0)), int64(1));
 	}
 	
 	// returns the greater value of a and b
-	int64 min (int64 l, int64 r) {
+	KISSMATH_CONSTEXPR int64 min (int64 l, int64 r) {
 		return l <= r ? l : r;
 	}
 	
 	// returns the smaller value of a and b
-	int64 max (int64 l, int64 r) {
+	KISSMATH_CONSTEXPR int64 max (int64 l, int64 r) {
 		return l >= r ? l : r;
 	}
 	
 	// equivalent to ternary c ? l : r
 	// for conformity with vectors
-	int64 select (bool c, int64 l, int64 r) {
+	KISSMATH_CONSTEXPR int64 select (bool c, int64 l, int64 r) {
 		return c ? l : r;
 	}
 	
 	
 	// length(scalar) = abs(scalar)
 	// for conformity with vectors
-	int64 length (int64 x) {
+	KISSMATH_INLINE int64 length (int64 x) {
 		return std::abs(x);
 	}
 	
 	// length_sqr(scalar) = abs(scalar)^2
 	// for conformity with vectors (for vectors this func is preferred over length to avoid the sqrt)
-	int64 length_sqr (int64 x) {
+	KISSMATH_INLINE int64 length_sqr (int64 x) {
 		x = std::abs(x);
 		return x*x;
 	}
@@ -71,12 +73,12 @@ namespace kissmath {
 	// scalar normalize for conformity with vectors
 	// normalize(-6.2f) = -1f, normalize(7) = 1, normalize(0) = <div 0>
 	// can be useful in some cases
-	int64 normalize (int64 x) {
+	KISSMATH_INLINE int64 normalize (int64 x) {
 		return x / length(x);
 	}
 	
 	// normalize(x) for length(x) != 0 else 0
-	int64 normalizesafe (int64 x) {
+	KISSMATH_INLINE int64 normalizesafe (int64 x) {
 		int64 len = length(x);
 		if (len == int64(0)) {
 			return int64(0);
@@ -86,3 +88,4 @@ namespace kissmath {
 	
 }
 
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -24,21 +25,21 @@ namespace kissmath {
 	
 	// clamp x into range [a, b]
 	// equivalent to min(max(x,a), b)
-	int64 clamp (int64 x, int64 a, int64 b);
+	KISSMATH_CONSTEXPR int64 clamp (int64 x, int64 a, int64 b);
 	
 	// clamp x into range [0, 1]
 	// also known as saturate in hlsl
-	int64 clamp (int64 x);
+	KISSMATH_CONSTEXPR int64 clamp (int64 x);
 	
 	// returns the greater value of a and b
-	int64 min (int64 l, int64 r);
+	KISSMATH_CONSTEXPR int64 min (int64 l, int64 r);
 	
 	// returns the smaller value of a and b
-	int64 max (int64 l, int64 r);
+	KISSMATH_CONSTEXPR int64 max (int64 l, int64 r);
 	
 	// equivalent to ternary c ? l : r
 	// for conformity with vectors
-	int64 select (bool c, int64 l, int64 r);
+	KISSMATH_CONSTEXPR int64 select (bool c, int64 l, int64 r);
 	
 	
 	// length(scalar) = abs(scalar)
@@ -60,3 +61,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int64.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "int64.hpp"
 
@@ -34,37 +35,37 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		int64v3 (int64 all);
+		KISSMATH_CONSTEXPR int64v3 (int64 all);
 		
 		// supply all components
-		int64v3 (int64 x, int64 y, int64 z);
+		KISSMATH_CONSTEXPR int64v3 (int64 x, int64 y, int64 z);
 		
 		// extend vector
-		int64v3 (int64v2 xy, int64 z);
+		KISSMATH_CONSTEXPR int64v3 (int64v2 xy, int64 z);
 		
 		// truncate vector
-		int64v3 (int64v4 v);
+		KISSMATH_CONSTEXPR int64v3 (int64v4 v);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator int64v2 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v2 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator bool3 () const;
+		KISSMATH_CONSTEXPR explicit operator bool3 () const;
 		
 		// type cast operator
-		explicit operator uint8v3 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v3 () const;
 		
 		// type cast operator
-		explicit operator float3 () const;
+		KISSMATH_CONSTEXPR explicit operator float3 () const;
 		
 		// type cast operator
-		explicit operator int3 () const;
+		KISSMATH_CONSTEXPR explicit operator int3 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -83,55 +84,55 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	int64v3 operator+ (int64v3 v);
+	KISSMATH_CONSTEXPR int64v3 operator+ (int64v3 v);
 	
-	int64v3 operator- (int64v3 v);
+	KISSMATH_CONSTEXPR int64v3 operator- (int64v3 v);
 	
-	int64v3 operator+ (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator+ (int64v3 l, int64v3 r);
 	
-	int64v3 operator- (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator- (int64v3 l, int64v3 r);
 	
-	int64v3 operator* (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator* (int64v3 l, int64v3 r);
 	
-	int64v3 operator/ (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator/ (int64v3 l, int64v3 r);
 	
 	
 	//// bitwise ops
 	
-	int64v3 operator~ (int64v3 v);
+	KISSMATH_CONSTEXPR int64v3 operator~ (int64v3 v);
 	
-	int64v3 operator& (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator& (int64v3 l, int64v3 r);
 	
-	int64v3 operator| (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator| (int64v3 l, int64v3 r);
 	
-	int64v3 operator^ (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 operator^ (int64v3 l, int64v3 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator< (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator< (int64v3 l, int64v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator<= (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator<= (int64v3 l, int64v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator> (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator> (int64v3 l, int64v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator>= (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator>= (int64v3 l, int64v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator== (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator== (int64v3 l, int64v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator!= (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool3 operator!= (int64v3 l, int64v3 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR bool equal (int64v3 l, int64v3 r);
 	
 	// componentwise ternary (c ? l : r)
-	int64v3 select (bool3 c, int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 select (bool3 c, int64v3 l, int64v3 r);
 	
 	
 	//// misc ops
@@ -139,16 +140,16 @@ namespace kissmath {
 	int64v3 abs (int64v3 v);
 	
 	// componentwise minimum
-	int64v3 min (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 min (int64v3 l, int64v3 r);
 	
 	// componentwise maximum
-	int64v3 max (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64v3 max (int64v3 l, int64v3 r);
 	
 	// componentwise clamp into range [a,b]
-	int64v3 clamp (int64v3 x, int64v3 a, int64v3 b);
+	KISSMATH_CONSTEXPR int64v3 clamp (int64v3 x, int64v3 a, int64v3 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int64v3 clamp (int64v3 x);
+	KISSMATH_CONSTEXPR int64v3 clamp (int64v3 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	int64 min_component (int64v3 v, int* min_index=nullptr);
@@ -168,13 +169,16 @@ namespace kissmath {
 	//// Vector math
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int64 length_sqr (int64v3 v);
+	KISSMATH_CONSTEXPR int64 length_sqr (int64v3 v);
 	
 	// dot product
-	int64 dot (int64v3 l, int64v3 r);
+	KISSMATH_CONSTEXPR int64 dot (int64v3 l, int64v3 r);
 	
 	// 3d cross product
 	int64v3 cross (int64v3 l, int64v3 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int64v3.cpp"
+#endif
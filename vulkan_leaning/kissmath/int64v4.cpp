@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_INT64V4_CPP
+#define KISSMATH_INT64V4_CPP
 #include "int64v4.hpp"
 
 #include "bool4.hpp"
@@ -17,40 +19,40 @@ namespace kissmath {
 	typedef int64_t int64;
 	
 	// Component indexing operator
-	int64& int64v4::operator[] (int i) {
+	KISSMATH_INLINE int64& int64v4::operator[] (int i) {
 		return arr[i];
 	}
 	
 	// Component indexing operator
-	int64 const& int64v4::operator[] (int i) const {
+	KISSMATH_INLINE int64 const& int64v4::operator[] (int i) const {
 		return arr[i];
 	}
 	
 	
 	// uninitialized constructor
-	int64v4::int64v4 () {
+	KISSMATH_INLINE int64v4::int64v4 () {
 		
 	}
 	
 	// sets all components to one value
 	// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 	// and short initialization like float3 a = 0; works
-	int64v4::int64v4 (int64 all): x{all}, y{all}, z{all}, w{all} {
+	KISSMATH_CONSTEXPR int64v4::int64v4 (int64 all): x{all}, y{all}, z{all}, w{all} {
 		
 	}
 	
 	// supply all components
-	int64v4::int64v4 (int64 x, int64 y, int64 z, int64 w): x{x}, y{y}, z{z}, w{w} {
+	KISSMATH_CONSTEXPR int64v4::int64v4 (int64 x, int64 y, int64 z, int64 w): x{x}, y{y}, z{z}, w{w} {
 		
 	}
 	
 	// extend vector
-	int64v4::int64v4 (int64v2 xy, int64 z, int64 w): x{xy.x}, y{xy.y}, z{z}, w{w} {
+	KISSMATH_CONSTEXPR int64v4::int64v4 (int64v2 xy, int64 z, int64 w): x{xy.x}, y{xy.y}, z{z}, w{w} {
 		
 	}
 	
 	// extend vector
-	int64v4::int64v4 (int64v3 xyz, int64 w): x{xyz.x}, y{xyz.y}, z{xyz.z}, w{w} {
+	KISSMATH_CONSTEXPR int64v4::int64v4 (int64v3 xyz, int64 w): x{xyz.x}, y{xyz.y}, z{xyz.z}, w{w} {
 		
 	}
 	
@@ -58,12 +60,12 @@ namespace kissmath {
 	
 	
 	// truncating cast operator
-	int64v4::operator int64v2 () const {
+	KISSMATH_CONSTEXPR int64v4::operator int64v2 () const {
 		return int64v2(x, y);
 	}
 	
 	// truncating cast operator
-	int64v4::operator int64v3 () const {
+	KISSMATH_CONSTEXPR int64v4::operator int64v3 () const {
 		return int64v3(x, y, z);
 	}
 	
@@ -71,28 +73,28 @@ namespace kissmath {
 	
 	
 	// type cast operator
-	int64v4::operator bool4 () const {
+	KISSMATH_CONSTEXPR int64v4::operator bool4 () const {
 		return bool4((bool)x, (bool)y, (bool)z, (bool)w);
 	}
 	
 	// type cast operator
-	int64v4::operator uint8v4 () const {
+	KISSMATH_CONSTEXPR int64v4::operator uint8v4 () const {
 		return uint8v4((uint8)x, (uint8)y, (uint8)z, (uint8)w);
 	}
 	
 	// type cast operator
-	int64v4::operator float4 () const {
+	KISSMATH_CONSTEXPR int64v4::operator float4 () const {
 		return float4((float)x, (float)y, (float)z, (float)w);
 	}
 	
 	// type cast operator
-	int64v4::operator int4 () const {
+	KISSMATH_CONSTEXPR int64v4::operator int4 () const {
 		return int4((int)x, (int)y, (int)z, (int)w);
 	}
 	
 	
 	// componentwise arithmetic operator
-	int64v4 int64v4::operator+= (int64v4 r) {
+	KISSMATH_INLINE int64v4 int64v4::operator+= (int64v4 r) {
 		x += r.x;
 		y += r.y;
 		z += r.z;
@@ -101,7 +103,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int64v4 int64v4::operator-= (int64v4 r) {
+	KISSMATH_INLINE int64v4 int64v4::operator-= (int64v4 r) {
 		x -= r.x;
 		y -= r.y;
 		z -= r.z;
@@ -110,7 +112,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int64v4 int64v4::operator*= (int64v4 r) {
+	KISSMATH_INLINE int64v4 int64v4::operator*= (int64v4 r) {
 		x *= r.x;
 		y *= r.y;
 		z *= r.z;
@@ -119,7 +121,7 @@ namespace kissmath {
 	}
 	
 	// componentwise arithmetic operator
-	int64v4 int64v4::operator/= (int64v4 r) {
+	KISSMATH_INLINE int64v4 int64v4::operator/= (int64v4 r) {
 		x /= r.x;
 		y /= r.y;
 		z /= r.z;
@@ -130,46 +132,46 @@ namespace kissmath {
 	//// arthmethic ops
 	
 	
-	int64v4 operator+ (int64v4 v) {
+	KISSMATH_CONSTEXPR int64v4 operator+ (int64v4 v) {
 		return int64v4(+v.x, +v.y, +v.z, +v.w);
 	}
 	
-	int64v4 operator- (int64v4 v) {
+	KISSMATH_CONSTEXPR int64v4 operator- (int64v4 v) {
 		return int64v4(-v.x, -v.y, -v.z, -v.w);
 	}
 	
-	int64v4 operator+ (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator+ (int64v4 l, int64v4 r) {
 		return int64v4(l.x + r.x, l.y + r.y, l.z + r.z, l.w + r.w);
 	}
 	
-	int64v4 operator- (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator- (int64v4 l, int64v4 r) {
 		return int64v4(l.x - r.x, l.y - r.y, l.z - r.z, l.w - r.w);
 	}
 	
-	int64v4 operator* (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator* (int64v4 l, int64v4 r) {
 		return int64v4(l.x * r.x, l.y * r.y, l.z * r.z, l.w * r.w);
 	}
 	
-	int64v4 operator/ (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator/ (int64v4 l, int64v4 r) {
 		return int64v4(l.x / r.x, l.y / r.y, l.z / r.z, l.w / r.w);
 	}
 	
 	//// bitwise ops
 	
 	
-	int64v4 operator~ (int64v4 v) {
+	KISSMATH_CONSTEXPR int64v4 operator~ (int64v4 v) {
 		return int64v4(~v.x, ~v.y, ~v.z, ~v.w);
 	}
 	
-	int64v4 operator& (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator& (int64v4 l, int64v4 r) {
 		return int64v4(l.x & r.x, l.y & r.y, l.z & r.z, l.w & r.w);
 	}
 	
-	int64v4 operator| (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator| (int64v4 l, int64v4 r) {
 		return int64v4(l.x | r.x, l.y | r.y, l.z | r.z, l.w | r.w);
 	}
 	
-	int64v4 operator^ (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 operator^ (int64v4 l, int64v4 r) {
 		return int64v4(l.x ^ r.x, l.y ^ r.y, l.z ^ r.z, l.w ^ r.w);
 	}
 	
@@ -177,74 +179,74 @@ namespace kissmath {
 	
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator< (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator< (int64v4 l, int64v4 r) {
 		return bool4(l.x < r.x, l.y < r.y, l.z < r.z, l.w < r.w);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator<= (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator<= (int64v4 l, int64v4 r) {
 		return bool4(l.x <= r.x, l.y <= r.y, l.z <= r.z, l.w <= r.w);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator> (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator> (int64v4 l, int64v4 r) {
 		return bool4(l.x > r.x, l.y > r.y, l.z > r.z, l.w > r.w);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator>= (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator>= (int64v4 l, int64v4 r) {
 		return bool4(l.x >= r.x, l.y >= r.y, l.z >= r.z, l.w >= r.w);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator== (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator== (int64v4 l, int64v4 r) {
 		return bool4(l.x == r.x, l.y == r.y, l.z == r.z, l.w == r.w);
 	}
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator!= (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool4 operator!= (int64v4 l, int64v4 r) {
 		return bool4(l.x != r.x, l.y != r.y, l.z != r.z, l.w != r.w);
 	}
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR bool equal (int64v4 l, int64v4 r) {
 		return all(l == r);
 	}
 	
 	// componentwise ternary (c ? l : r)
-	int64v4 select (bool4 c, int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 select (bool4 c, int64v4 l, int64v4 r) {
 		return int64v4(c.x ? l.x : r.x, c.y ? l.y : r.y, c.z ? l.z : r.z, c.w ? l.w : r.w);
 	}
 	
 	//// misc ops
 	
 	// componentwise absolute
-	int64v4 abs (int64v4 v) {
+	KISSMATH_INLINE int64v4 abs (int64v4 v) {
 		return int64v4(abs(v.x), abs(v.y), abs(v.z), abs(v.w));
 	}
 	
 	// componentwise minimum
-	int64v4 min (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 min (int64v4 l, int64v4 r) {
 		return int64v4(min(l.x,r.x), min(l.y,r.y), min(l.z,r.z), min(l.w,r.w));
 	}
 	
 	// componentwise maximum
-	int64v4 max (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64v4 max (int64v4 l, int64v4 r) {
 		return int64v4(max(l.x,r.x), max(l.y,r.y), max(l.z,r.z), max(l.w,r.w));
 	}
 	
 	// componentwise clamp into range [a,b]
-	int64v4 clamp (int64v4 x, int64v4 a, int64v4 b) {
+	KISSMATH_CONSTEXPR int64v4 clamp (int64v4 x, int64v4 a, int64v4 b) {
 		return min(max(x,a), b);
 	}
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int64v4 clamp (int64v4 x) {
+	KISSMATH_CONSTEXPR int64v4 clamp (int64v4 x) {
 		return min(max(x, int64(0)), int64(1));
 	}
 	
 	// get minimum component of vector, optionally get component index via min_index
-	int64 min_component (int64v4 v, int* min_index) {
+	KISSMATH_INLINE int64 min_component (int64v4 v, int* min_index) {
 		int index = 0;
 		int64 min_val = v.x;	
 		for (int i=1; i<4; ++i) {
@@ -258,7 +260,7 @@ namespace kissmath {
 	}
 	
 	// get maximum component of vector, optionally get component index via max_index
-	int64 max_component (int64v4 v, int* max_index) {
+	KISSMATH_INLINE int64 max_component (int64v4 v, int* max_index) {
 		int index = 0;
 		int64 max_val = v.x;	
 		for (int i=1; i<4; ++i) {
@@ -273,12 +275,12 @@ namespace kissmath {
 	
 	
 	// componentwise wrap
-	int64v4 wrap (int64v4 v, int64v4 range) {
+	KISSMATH_INLINE int64v4 wrap (int64v4 v, int64v4 range) {
 		return int64v4(wrap(v.x,range.x), wrap(v.y,range.y), wrap(v.z,range.z), wrap(v.w,range.w));
 	}
 	
 	// componentwise wrap
-	int64v4 wrap (int64v4 v, int64v4 a, int64v4 b) {
+	KISSMATH_INLINE int64v4 wrap (int64v4 v, int64v4 a, int64v4 b) {
 		return int64v4(wrap(v.x,a.x,b.x), wrap(v.y,a.y,b.y), wrap(v.z,a.z,b.z), wrap(v.w,a.w,b.w));
 	}
 	
@@ -287,13 +289,14 @@ namespace kissmath {
 	
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int64 length_sqr (int64v4 v) {
+	KISSMATH_CONSTEXPR int64 length_sqr (int64v4 v) {
 		return v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w;
 	}
 	
 	// dot product
-	int64 dot (int64v4 l, int64v4 r) {
+	KISSMATH_CONSTEXPR int64 dot (int64v4 l, int64v4 r) {
 		return l.x * r.x + l.y * r.y + l.z * r.z + l.w * r.w;
 	}
 }
 
+#endif
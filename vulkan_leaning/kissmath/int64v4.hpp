@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "int64.hpp"
 
@@ -34,40 +35,40 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		int64v4 (int64 all);
+		KISSMATH_CONSTEXPR int64v4 (int64 all);
 		
 		// supply all components
-		int64v4 (int64 x, int64 y, int64 z, int64 w);
+		KISSMATH_CONSTEXPR int64v4 (int64 x, int64 y, int64 z, int64 w);
 		
 		// extend vector
-		int64v4 (int64v2 xy, int64 z, int64 w);
+		KISSMATH_CONSTEXPR int64v4 (int64v2 xy, int64 z, int64 w);
 		
 		// extend vector
-		int64v4 (int64v3 xyz, int64 w);
+		KISSMATH_CONSTEXPR int64v4 (int64v3 xyz, int64 w);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator int64v2 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v2 () const;
 		
 		// truncating cast operator
-		explicit operator int64v3 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v3 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator bool4 () const;
+		KISSMATH_CONSTEXPR explicit operator bool4 () const;
 		
 		// type cast operator
-		explicit operator uint8v4 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v4 () const;
 		
 		// type cast operator
-		explicit operator float4 () const;
+		KISSMATH_CONSTEXPR explicit operator float4 () const;
 		
 		// type cast operator
-		explicit operator int4 () const;
+		KISSMATH_CONSTEXPR explicit operator int4 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -86,55 +87,55 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	int64v4 operator+ (int64v4 v);
+	KISSMATH_CONSTEXPR int64v4 operator+ (int64v4 v);
 	
-	int64v4 operator- (int64v4 v);
+	KISSMATH_CONSTEXPR int64v4 operator- (int64v4 v);
 	
-	int64v4 operator+ (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator+ (int64v4 l, int64v4 r);
 	
-	int64v4 operator- (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator- (int64v4 l, int64v4 r);
 	
-	int64v4 operator* (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator* (int64v4 l, int64v4 r);
 	
-	int64v4 operator/ (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator/ (int64v4 l, int64v4 r);
 	
 	
 	//// bitwise ops
 	
-	int64v4 operator~ (int64v4 v);
+	KISSMATH_CONSTEXPR int64v4 operator~ (int64v4 v);
 	
-	int64v4 operator& (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator& (int64v4 l, int64v4 r);
 	
-	int64v4 operator| (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator| (int64v4 l, int64v4 r);
 	
-	int64v4 operator^ (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 operator^ (int64v4 l, int64v4 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator< (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator< (int64v4 l, int64v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator<= (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator<= (int64v4 l, int64v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator> (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator> (int64v4 l, int64v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator>= (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator>= (int64v4 l, int64v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator== (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator== (int64v4 l, int64v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator!= (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool4 operator!= (int64v4 l, int64v4 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR bool equal (int64v4 l, int64v4 r);
 	
 	// componentwise ternary (c ? l : r)
-	int64v4 select (bool4 c, int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 select (bool4 c, int64v4 l, int64v4 r);
 	
 	
 	//// misc ops
@@ -142,16 +143,16 @@ namespace kissmath {
 	int64v4 abs (int64v4 v);
 	
 	// componentwise minimum
-	int64v4 min (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 min (int64v4 l, int64v4 r);
 	
 	// componentwise maximum
-	int64v4 max (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64v4 max (int64v4 l, int64v4 r);
 	
 	// componentwise clamp into range [a,b]
-	int64v4 clamp (int64v4 x, int64v4 a, int64v4 b);
+	KISSMATH_CONSTEXPR int64v4 clamp (int64v4 x, int64v4 a, int64v4 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	int64v4 clamp (int64v4 x);
+	KISSMATH_CONSTEXPR int64v4 clamp (int64v4 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	int64 min_component (int64v4 v, int* min_index=nullptr);
@@ -171,10 +172,13 @@ namespace kissmath {
 	//// Vector math
 	
 	// squared magnitude of vector, cheaper than length() because it avoids the sqrt(), some algorithms only need the squared magnitude
-	int64 length_sqr (int64v4 v);
+	KISSMATH_CONSTEXPR int64 length_sqr (int64v4 v);
 	
 	// dot product
-	int64 dot (int64v4 l, int64v4 r);
+	KISSMATH_CONSTEXPR int64 dot (int64v4 l, int64v4 r);
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "int64v4.cpp"
+#endif
@@ -0,0 +1,176 @@
+#ifndef KISSMATH_QUAT_CPP
+#define KISSMATH_QUAT_CPP
+#include "quat.hpp"
+
+#include <cmath>
+
+namespace kissmath {
+	
+	// uninitialized constructor
+	KISSMATH_INLINE quat::quat () {
+		
+	}
+	
+	// supply vector and scalar part
+	KISSMATH_CONSTEXPR quat::quat (float3 xyz, float w): x{xyz.x}, y{xyz.y}, z{xyz.z}, w{w} {
+		
+	}
+	
+	// vector part
+	KISSMATH_CONSTEXPR float3 quat::xyz () const {
+		return float3(x, y, z);
+	}
+	
+	// components as float4
+	KISSMATH_CONSTEXPR quat::operator float4 () const {
+		return float4(x, y, z, w);
+	}
+	
+	// rotation matrix, q needs to be normalized
+	KISSMATH_INLINE quat::operator float3x3 () const {
+		float x2 = x + x, y2 = y + y, z2 = z + z;
+		float xx = x * x2, yy = y * y2, zz = z * z2;
+		float xy = x * y2, xz = x * z2, yz = y * z2;
+		float wx = w * x2, wy = w * y2, wz = w * z2;
+		return float3x3(
+						1 - (yy + zz),      xy - wz,       xz + wy,
+						     xy + wz, 1 - (xx + zz),       yz - wx,
+						     xz - wy,       yz + wx, 1 - (xx + yy)
+			   );
+	}
+	
+	//// construction
+	
+	// rotation around axis by ang radians, axis needs to be normalized
+	KISSMATH_INLINE quat rotateQ (float3 axis, float ang) {
+		float s = std::sin(ang * 0.5f), c = std::cos(ang * 0.5f);
+		return quat(axis * s, c);
+	}
+	
+	KISSMATH_INLINE quat rotateQ_X (float ang) {
+		float s = std::sin(ang * 0.5f), c = std::cos(ang * 0.5f);
+		return quat(s, 0, 0, c);
+	}
+	
+	KISSMATH_INLINE quat rotateQ_Y (float ang) {
+		float s = std::sin(ang * 0.5f), c = std::cos(ang * 0.5f);
+		return quat(0, s, 0, c);
+	}
+	
+	KISSMATH_INLINE quat rotateQ_Z (float ang) {
+		float s = std::sin(ang * 0.5f), c = std::cos(ang * 0.5f);
+		return quat(0, 0, s, c);
+	}
+	
+	// z * y * x euler angles (like blender default, same as rotate3_Z(z) * rotate3_Y(y) * rotate3_X(x))
+	KISSMATH_INLINE quat rotateQ_euler (float3 angles) {
+		return rotateQ_Z(angles.z) * rotateQ_Y(angles.y) * rotateQ_X(angles.x);
+	}
+	
+	// rotation quaternion of a rotation matrix (pure rotation, no scale)
+	KISSMATH_INLINE quat to_quat (float3x3 const& m) {
+		// pick the largest of w,x,y,z to divide by for numerical stability
+		float m00 = m.arr[0].x, m11 = m.arr[1].y, m22 = m.arr[2].z;
+		float trace = m00 + m11 + m22;
+		quat q;
+		if (trace > 0) {
+			float s = std::sqrt(trace + 1.0f) * 2; // 4w
+			q = quat((m.arr[1].z - m.arr[2].y) / s, (m.arr[2].x - m.arr[0].z) / s, (m.arr[0].y - m.arr[1].x) / s, 0.25f * s);
+		} else if (m00 > m11 && m00 > m22) {
+			float s = std::sqrt(1.0f + m00 - m11 - m22) * 2; // 4x
+			q = quat(0.25f * s, (m.arr[1].x + m.arr[0].y) / s, (m.arr[2].x + m.arr[0].z) / s, (m.arr[1].z - m.arr[2].y) / s);
+		} else if (m11 > m22) {
+			float s = std::sqrt(1.0f + m11 - m00 - m22) * 2; // 4y
+			q = quat((m.arr[1].x + m.arr[0].y) / s, 0.25f * s, (m.arr[2].y + m.arr[1].z) / s, (m.arr[2].x - m.arr[0].z) / s);
+		} else {
+			float s = std::sqrt(1.0f + m22 - m00 - m11) * 2; // 4z
+			q = quat((m.arr[2].x + m.arr[0].z) / s, (m.arr[2].y + m.arr[1].z) / s, 0.25f * s, (m.arr[0].y - m.arr[1].x) / s);
+		}
+		return q;
+	}
+	
+	//// ops
+	
+	// rotation l after r (like matrix multiplication)
+	KISSMATH_CONSTEXPR quat operator* (quat l, quat r) {
+		return quat(l.w * r.x + l.x * r.w + l.y * r.z - l.z * r.y,
+		            l.w * r.y - l.x * r.z + l.y * r.w + l.z * r.x,
+		            l.w * r.z + l.x * r.y - l.y * r.x + l.z * r.w,
+		            l.w * r.w - l.x * r.x - l.y * r.y - l.z * r.z);
+	}
+	
+	// rotate vector
+	KISSMATH_INLINE float3 operator* (quat q, float3 v) {
+		// v + 2w (q.xyz x v) + 2 q.xyz x (q.xyz x v)
+		float3 t = cross(q.xyz(), v) * 2;
+		return v + t * q.w + cross(q.xyz(), t);
+	}
+	
+	KISSMATH_CONSTEXPR quat operator- (quat q) {
+		return quat(-q.x, -q.y, -q.z, -q.w);
+	}
+	
+	KISSMATH_CONSTEXPR bool operator== (quat l, quat r) {
+		return l.x == r.x && l.y == r.y && l.z == r.z && l.w == r.w;
+	}
+	
+	KISSMATH_CONSTEXPR bool operator!= (quat l, quat r) {
+		return l.x != r.x || l.y != r.y || l.z != r.z || l.w != r.w;
+	}
+	
+	// inverse rotation (for normalized quaternions)
+	KISSMATH_CONSTEXPR quat conjugate (quat q) {
+		return quat(-q.x, -q.y, -q.z, q.w);
+	}
+	
+	// inverse of non-normalized quaternion
+	KISSMATH_INLINE quat inverse (quat q) {
+		float inv_len_sqr = 1.0f / dot(q, q);
+		return quat(-q.x * inv_len_sqr, -q.y * inv_len_sqr, -q.z * inv_len_sqr, q.w * inv_len_sqr);
+	}
+	
+	KISSMATH_CONSTEXPR float dot (quat l, quat r) {
+		return l.x * r.x + l.y * r.y + l.z * r.z + l.w * r.w;
+	}
+	
+	KISSMATH_INLINE float length (quat q) {
+		return std::sqrt(dot(q, q));
+	}
+	
+	KISSMATH_INLINE quat normalize (quat q) {
+		float inv_len = 1.0f / length(q);
+		return quat(q.x * inv_len, q.y * inv_len, q.z * inv_len, q.w * inv_len);
+	}
+	
+	//// interpolation
+	
+	// normalized linear interpolation along the shortest path
+	// not constant angular velocity like slerp, but much cheaper and close enough for keyframes that are not too far apart
+	KISSMATH_INLINE quat nlerp (quat a, quat b, float t) {
+		float tb = dot(a, b) < 0 ? -t : t; // flip b to take the shortest path
+		float ta = 1.0f - t;
+		return normalize(quat(a.x * ta + b.x * tb, a.y * ta + b.y * tb, a.z * ta + b.z * tb, a.w * ta + b.w * tb));
+	}
+	
+	// spherical linear interpolation along the shortest path (constant angular velocity)
+	KISSMATH_INLINE quat slerp (quat a, quat b, float t) {
+		float d = dot(a, b);
+		float sign = 1;
+		if (d < 0) { // flip b to take the shortest path
+			d = -d;
+			sign = -1;
+		}
+		
+		if (d > 0.9995f) // sin(theta) is close to zero, nlerp is exact enough
+			return nlerp(a, b, t);
+		
+		float theta = std::acos(d);
+		float inv_sin = 1.0f / std::sin(theta);
+		float ta = std::sin((1.0f - t) * theta) * inv_sin;
+		float tb = std::sin(t * theta) * inv_sin * sign;
+		return quat(a.x * ta + b.x * tb, a.y * ta + b.y * tb, a.z * ta + b.z * tb, a.w * ta + b.w * tb);
+	}
+	
+}
+
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+#include "config.hpp"
+
+#include "float3.hpp"
+#include "float4.hpp"
+#include "float3x3.hpp"
+
+namespace kissmath {
+	
+	// Rotation quaternion  x,y,z is the vector part (axis * sin(ang/2)), w the scalar part (cos(ang/2))
+	// all functions that take rotations expect normalized quaternions, q and -q represent the same rotation
+	struct quat {
+		union {
+			struct {
+				float	x, y, z, w;
+			};
+			float		arr[4];
+		};
+		
+		// uninitialized constructor
+		quat ();
+		
+		// supply all components
+		constexpr quat (float x, float y, float z, float w): x{x}, y{y}, z{z}, w{w} {
+			
+		}
+		
+		// supply vector and scalar part
+		KISSMATH_CONSTEXPR quat (float3 xyz, float w);
+		
+		// identity rotation
+		static constexpr quat identity () {
+			return quat(0,0,0,1);
+		}
+		
+		// vector part
+		KISSMATH_CONSTEXPR float3 xyz () const;
+		
+		// components as float4
+		KISSMATH_CONSTEXPR explicit operator float4 () const;
+		
+		// rotation matrix, q needs to be normalized
+		explicit operator float3x3 () const;
+		
+	};
+	
+	//// construction
+	
+	// rotation around axis by ang radians, axis needs to be normalized
+	quat rotateQ (float3 axis, float ang);
+	
+	quat rotateQ_X (float ang);
+	
+	quat rotateQ_Y (float ang);
+	
+	quat rotateQ_Z (float ang);
+	
+	// z * y * x euler angles (like blender default, same as rotate3_Z(z) * rotate3_Y(y) * rotate3_X(x))
+	quat rotateQ_euler (float3 angles);
+	
+	// rotation quaternion of a rotation matrix (pure rotation, no scale)
+	quat to_quat (float3x3 const& m);
+	
+	//// ops
+	
+	// rotation l after r (like matrix multiplication)
+	KISSMATH_CONSTEXPR quat operator* (quat l, quat r);
+	
+	// rotate vector
+	float3 operator* (quat q, float3 v);
+	
+	KISSMATH_CONSTEXPR quat operator- (quat q);
+	
+	KISSMATH_CONSTEXPR bool operator== (quat l, quat r);
+	
+	KISSMATH_CONSTEXPR bool operator!= (quat l, quat r);
+	
+	// inverse rotation (for normalized quaternions)
+	KISSMATH_CONSTEXPR quat conjugate (quat q);
+	
+	// inverse of non-normalized quaternion
+	quat inverse (quat q);
+	
+	KISSMATH_CONSTEXPR float dot (quat l, quat r);
+	
+	float length (quat q);
+	
+	quat normalize (quat q);
+	
+	//// interpolation
+	
+	// normalized linear interpolation along the shortest path
+	// not constant angular velocity like slerp, but much cheaper and close enough for keyframes that are not too far apart
+	quat nlerp (quat a, quat b, float t);
+	
+	// spherical linear interpolation along the shortest path (constant angular velocity)
+	quat slerp (quat a, quat b, float t);
+	
+}
+
+#ifdef KISSMATH_HEADER_ONLY
+#include "quat.cpp"
+#endif
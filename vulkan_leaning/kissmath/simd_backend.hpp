@@ -0,0 +1,323 @@
+// SIMD kernels for the kissmath matrix and vector ops, only included by the kissmath .cpp files and util/batch_transform.cpp (not part of the public api)
+// the public types keep their layout (column major, float3 is 12 bytes), the kernels work on the raw floats
+// SSE (+ AVX/FMA if enabled for the compiler) or NEON, define KISSMATH_NO_SIMD to use the plain scalar code instead
+#pragma once
+
+#if !defined(KISSMATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define KISSMATH_SSE	1
+	#define KISSMATH_NEON	0
+	#include <immintrin.h>
+#elif !defined(KISSMATH_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+	#define KISSMATH_SSE	0
+	#define KISSMATH_NEON	1
+	#include <arm_neon.h>
+#else
+	#define KISSMATH_SSE	0
+	#define KISSMATH_NEON	0
+#endif
+
+#define KISSMATH_SIMD (KISSMATH_SSE || KISSMATH_NEON)
+
+// 256 bit path for 4x4 matrix multiply (msvc defines __AVX__ with /arch:AVX)
+#if KISSMATH_SSE && defined(__AVX__)
+	#define KISSMATH_AVX	1
+#else
+	#define KISSMATH_AVX	0
+#endif
+
+#if KISSMATH_SIMD
+namespace kissmath {
+namespace simd_backend {
+
+	//// 4 lane primitives
+	// vectors passed by value are already in registers, use set/set3 for them, load/load3 is for matrices in memory
+
+#if KISSMATH_SSE
+	typedef __m128 v4;
+
+	inline v4 load (float const* p)			{ return _mm_loadu_ps(p); }
+	inline void store (float* p, v4 v)		{ _mm_storeu_ps(p, v); }
+	// load 3 floats (w = 0) without reading past p[2]
+	inline v4 load3 (float const* p)		{ return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double const*)p)), _mm_load_ss(p + 2)); }
+	// store xyz without writing past p[2]
+	inline void store3 (float* p, v4 v)		{ _mm_store_sd((double*)p, _mm_castps_pd(v)); _mm_store_ss(p + 2, _mm_movehl_ps(v, v)); }
+	inline v4 set (float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+	inline v4 set1 (float f)				{ return _mm_set1_ps(f); }
+	inline v4 set3 (float x, float y, float z) { return _mm_setr_ps(x, y, z, 0); }
+	inline float get_x (v4 v)				{ return _mm_cvtss_f32(v); }
+
+	inline v4 add (v4 l, v4 r)				{ return _mm_add_ps(l, r); }
+	inline v4 sub (v4 l, v4 r)				{ return _mm_sub_ps(l, r); }
+	inline v4 mul (v4 l, v4 r)				{ return _mm_mul_ps(l, r); }
+	// a * b + c
+	#if defined(__FMA__)
+	inline v4 madd (v4 a, v4 b, v4 c)		{ return _mm_fmadd_ps(a, b, c); }
+	#else
+	inline v4 madd (v4 a, v4 b, v4 c)		{ return _mm_add_ps(_mm_mul_ps(a, b), c); }
+	#endif
+
+	// (v[i], v[i], v[i], v[i])
+	template <int i>
+	inline v4 splat (v4 v)					{ return _mm_shuffle_ps(v, v, _MM_SHUFFLE(i,i,i,i)); }
+	// (x[a], x[b], y[c], y[d])
+	template <int a, int b, int c, int d>
+	inline v4 shuffle (v4 x, v4 y)			{ return _mm_shuffle_ps(x, y, _MM_SHUFFLE(d,c,b,a)); }
+
+	inline void transpose (v4& r0, v4& r1, v4& r2, v4& r3) {
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	}
+
+	inline float hsum (v4 v) {
+		v4 s = _mm_add_ps(v, _mm_movehl_ps(v, v)); // (x+z, y+w, ..)
+		s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+		return _mm_cvtss_f32(s);
+	}
+
+#elif KISSMATH_NEON
+	typedef float32x4_t v4;
+
+	inline v4 load (float const* p)			{ return vld1q_f32(p); }
+	inline void store (float* p, v4 v)		{ vst1q_f32(p, v); }
+	inline v4 load3 (float const* p)		{ return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0), 0)); }
+	inline void store3 (float* p, v4 v)		{ vst1_f32(p, vget_low_f32(v)); vst1q_lane_f32(p + 2, v, 2); }
+	inline v4 set (float x, float y, float z, float w) { float f[4] = { x, y, z, w }; return vld1q_f32(f); }
+	inline v4 set1 (float f)				{ return vdupq_n_f32(f); }
+	inline v4 set3 (float x, float y, float z) { return set(x, y, z, 0); }
+	inline float get_x (v4 v)				{ return vgetq_lane_f32(v, 0); }
+
+	inline v4 add (v4 l, v4 r)				{ return vaddq_f32(l, r); }
+	inline v4 sub (v4 l, v4 r)				{ return vsubq_f32(l, r); }
+	inline v4 mul (v4 l, v4 r)				{ return vmulq_f32(l, r); }
+	inline v4 madd (v4 a, v4 b, v4 c)		{ return vmlaq_f32(c, a, b); }
+
+	template <int i>
+	inline v4 splat (v4 v)					{ return vdupq_n_f32(vgetq_lane_f32(v, i)); }
+	template <int a, int b, int c, int d>
+	inline v4 shuffle (v4 x, v4 y) {
+	#if defined(__clang__)
+		return __builtin_shufflevector(x, y, a, b, c + 4, d + 4);
+	#else
+		v4 r = vdupq_n_f32(vgetq_lane_f32(x, a));
+		r = vsetq_lane_f32(vgetq_lane_f32(x, b), r, 1);
+		r = vsetq_lane_f32(vgetq_lane_f32(y, c), r, 2);
+		r = vsetq_lane_f32(vgetq_lane_f32(y, d), r, 3);
+		return r;
+	#endif
+	}
+
+	inline void transpose (v4& r0, v4& r1, v4& r2, v4& r3) {
+		float32x4x2_t t01 = vtrnq_f32(r0, r1); // (a0 b0 a2 b2) (a1 b1 a3 b3)
+		float32x4x2_t t23 = vtrnq_f32(r2, r3);
+		r0 = vcombine_f32(vget_low_f32 (t01.val[0]), vget_low_f32 (t23.val[0]));
+		r1 = vcombine_f32(vget_low_f32 (t01.val[1]), vget_low_f32 (t23.val[1]));
+		r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+
+	inline float hsum (v4 v) {
+		float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+		return vget_lane_f32(vpadd_f32(s, s), 0);
+	}
+#endif
+
+	//// vector kernels
+	// (dot stays scalar, with the vector in registers the horizontal add was slower than the plain code)
+
+	// l.yzx * r.zxy - l.zxy * r.yzx
+	inline v4 cross (v4 l, v4 r) {
+		v4 l_yzx = shuffle<1,2,0,3>(l, l);
+		v4 r_yzx = shuffle<1,2,0,3>(r, r);
+		// (l * r.yzx - l.yzx * r).yzx == l.yzx * r.zxy - l.zxy * r.yzx
+		v4 c = sub(mul(l, r_yzx), mul(l_yzx, r));
+		return shuffle<1,2,0,3>(c, c);
+	}
+
+	//// 4x4 matrix kernels, matrices are 16 floats column major
+
+	// out = m * v
+	inline v4 mat4_mul_vec (float const* m, v4 v) {
+		v4 r = mul(load(m), splat<0>(v));
+		r = madd(load(m +  4), splat<1>(v), r);
+		r = madd(load(m +  8), splat<2>(v), r);
+		r = madd(load(m + 12), splat<3>(v), r);
+		return r;
+	}
+
+	// out = v * m (row vector)
+	inline v4 vec_mul_mat4 (v4 v, float const* m) {
+		// out[j] = dot(v, column j) -> with the transposed columns (rows) out = sum v[k] * row k
+		v4 r0 = load(m), r1 = load(m + 4), r2 = load(m + 8), r3 = load(m + 12);
+		transpose(r0, r1, r2, r3);
+
+		v4 r = mul(r0, splat<0>(v));
+		r = madd(r1, splat<1>(v), r);
+		r = madd(r2, splat<2>(v), r);
+		r = madd(r3, splat<3>(v), r);
+		return r;
+	}
+
+	// out = l * r, out must not alias l or r
+	inline void mat4_mul (float* out, float const* l, float const* r) {
+	#if KISSMATH_AVX
+		// two result columns per 256 bit register
+		__m256 l0 = _mm256_broadcast_ps((__m128 const*)(l +  0));
+		__m256 l1 = _mm256_broadcast_ps((__m128 const*)(l +  4));
+		__m256 l2 = _mm256_broadcast_ps((__m128 const*)(l +  8));
+		__m256 l3 = _mm256_broadcast_ps((__m128 const*)(l + 12));
+
+		for (int j=0; j<16; j += 8) {
+			__m256 rc = _mm256_loadu_ps(r + j);
+			__m256 res = _mm256_mul_ps(l0, _mm256_shuffle_ps(rc, rc, 0x00));
+		#if defined(__FMA__)
+			res = _mm256_fmadd_ps(l1, _mm256_shuffle_ps(rc, rc, 0x55), res);
+			res = _mm256_fmadd_ps(l2, _mm256_shuffle_ps(rc, rc, 0xaa), res);
+			res = _mm256_fmadd_ps(l3, _mm256_shuffle_ps(rc, rc, 0xff), res);
+		#else
+			res = _mm256_add_ps(res, _mm256_mul_ps(l1, _mm256_shuffle_ps(rc, rc, 0x55)));
+			res = _mm256_add_ps(res, _mm256_mul_ps(l2, _mm256_shuffle_ps(rc, rc, 0xaa)));
+			res = _mm256_add_ps(res, _mm256_mul_ps(l3, _mm256_shuffle_ps(rc, rc, 0xff)));
+		#endif
+			_mm256_storeu_ps(out + j, res);
+		}
+	#else
+		for (int j=0; j<16; j += 4)
+			store(out + j, mat4_mul_vec(l, load(r + j)));
+	#endif
+	}
+
+	inline void mat4_transpose (float* out, float const* m) {
+		v4 r0 = load(m), r1 = load(m + 4), r2 = load(m + 8), r3 = load(m + 12);
+		transpose(r0, r1, r2, r3);
+		store(out, r0);
+		store(out + 4, r1);
+		store(out + 8, r2);
+		store(out + 12, r3);
+	}
+
+	template <int r> inline v4 _inv_p (v4 c1, v4 c2) {
+		return shuffle<r,r,r,r>(c2, c1);
+	}
+	template <int r> inline v4 _inv_q (v4 c2, v4 c3) {
+		v4 t = shuffle<r,r,r,r>(c3, c2); // (c3[r], c3[r], c2[r], c2[r])
+		return shuffle<0,0,0,2>(t, t);
+	}
+	template <int r> inline v4 _inv_v (v4 c0, v4 c1) {
+		v4 t = shuffle<r,r,r,r>(c1, c0); // (c1[r], c1[r], c0[r], c0[r])
+		return shuffle<0,2,2,2>(t, t);
+	}
+
+	// cofactor inverse with 2x2 sub determinants computed 4 at a time
+	//  out must not alias m, singular matrices produce inf/nan like the scalar code
+	inline void mat4_inverse (float* out, float const* m) {
+		v4 c0 = load(m), c1 = load(m + 4), c2 = load(m + 8), c3 = load(m + 12);
+
+		// for row r: p_r = (c2[r], c2[r], c1[r], c1[r])  q_r = (c3[r], c3[r], c3[r], c2[r])  v_r = (c1[r], c0[r], c0[r], c0[r])
+		// 2x2 determinants of rows r1,r2 of the column pairs (2,3) (2,3) (1,3) (1,2): fac = p_r1 * q_r2 - q_r1 * p_r2
+		v4 p0 = _inv_p<0>(c1, c2), p1 = _inv_p<1>(c1, c2), p2 = _inv_p<2>(c1, c2), p3 = _inv_p<3>(c1, c2);
+		v4 q0 = _inv_q<0>(c2, c3), q1 = _inv_q<1>(c2, c3), q2 = _inv_q<2>(c2, c3), q3 = _inv_q<3>(c2, c3);
+
+		v4 fac0 = sub(mul(p2, q3), mul(q2, p3)); // rows 2,3
+		v4 fac1 = sub(mul(p1, q3), mul(q1, p3)); // rows 1,3
+		v4 fac2 = sub(mul(p1, q2), mul(q1, p2)); // rows 1,2
+		v4 fac3 = sub(mul(p0, q3), mul(q0, p3)); // rows 0,3
+		v4 fac4 = sub(mul(p0, q2), mul(q0, p2)); // rows 0,2
+		v4 fac5 = sub(mul(p0, q1), mul(q0, p1)); // rows 0,1
+
+		v4 v0 = _inv_v<0>(c0, c1), v1 = _inv_v<1>(c0, c1), v2 = _inv_v<2>(c0, c1), v3 = _inv_v<3>(c0, c1);
+
+		v4 sign_a = set(+1.0f, -1.0f, +1.0f, -1.0f);
+		v4 sign_b = set(-1.0f, +1.0f, -1.0f, +1.0f);
+
+		v4 inv0 = mul(add(sub(mul(v1, fac0), mul(v2, fac1)), mul(v3, fac2)), sign_a);
+		v4 inv1 = mul(add(sub(mul(v0, fac0), mul(v2, fac3)), mul(v3, fac4)), sign_b);
+		v4 inv2 = mul(add(sub(mul(v0, fac1), mul(v1, fac3)), mul(v3, fac5)), sign_a);
+		v4 inv3 = mul(add(sub(mul(v0, fac2), mul(v1, fac4)), mul(v2, fac5)), sign_b);
+
+		// determinant = dot(column 0, first row of the adjugate)
+		v4 row0 = shuffle<0,2,0,2>(shuffle<0,0,0,0>(inv0, inv1), shuffle<0,0,0,0>(inv2, inv3));
+		v4 inv_det = set1(1.0f / hsum(mul(c0, row0)));
+
+		store(out,      mul(inv0, inv_det));
+		store(out +  4, mul(inv1, inv_det));
+		store(out +  8, mul(inv2, inv_det));
+		store(out + 12, mul(inv3, inv_det));
+	}
+
+	//// 3x4 and 3x3 matrix kernels, matrices are 12 or 9 floats column major (float3 columns)
+	//  loading a column with load() reads the x of the next column into w, which is ignored, the last column uses load3 to not read past the matrix
+
+	// m * (v.xyz, 1)
+	inline v4 mat34_mul_point (float const* m, v4 v) {
+		v4 r = madd(load(m), splat<0>(v), load3(m + 9));
+		r = madd(load(m + 3), splat<1>(v), r);
+		r = madd(load(m + 6), splat<2>(v), r);
+		return r;
+	}
+	// m * (v.xyz, 0)
+	inline v4 mat34_mul_dir (float const* m, v4 v) {
+		v4 r = mul(load(m), splat<0>(v));
+		r = madd(load(m + 3), splat<1>(v), r);
+		r = madd(load3(m + 6), splat<2>(v), r);
+		return r;
+	}
+
+	// m * v
+	inline v4 mat34_mul_vec (float const* m, v4 v) {
+		return madd(load3(m + 9), splat<3>(v), mat34_mul_dir(m, v));
+	}
+
+	// out = l * r  (as 4x4 matrices with implicit last row 0,0,0,1), out must not alias l or r
+	inline void mat34_mul (float* out, float const* l, float const* r) {
+		v4 l0 = load(l), l1 = load(l + 3), l2 = load(l + 6), l3 = load3(l + 9);
+
+		v4 o[4];
+		for (int j=0; j<4; ++j) {
+			v4 rc = j < 3 ? load(r + j*3) : load3(r + 9);
+			v4 res = mul(l0, splat<0>(rc));
+			res = madd(l1, splat<1>(rc), res);
+			res = madd(l2, splat<2>(rc), res);
+			o[j] = res;
+		}
+		o[3] = add(o[3], l3);
+
+		// stores in order, each 4 float store overwrites the garbage w of the previous one
+		store(out,     o[0]);
+		store(out + 3, o[1]);
+		store(out + 6, o[2]);
+		store3(out + 9, o[3]);
+	}
+
+	inline v4 mat33_mul_vec (float const* m, v4 v) {
+		return mat34_mul_dir(m, v);
+	}
+
+	// out = l * r, out must not alias l or r
+	inline void mat33_mul (float* out, float const* l, float const* r) {
+		v4 o0 = mat33_mul_vec(l, load(r));
+		v4 o1 = mat33_mul_vec(l, load(r + 3));
+		v4 o2 = mat33_mul_vec(l, load3(r + 6));
+		store(out,     o0);
+		store(out + 3, o1);
+		store3(out + 6, o2);
+	}
+
+	// inverse via cross products: the rows of the inverse are cross(c1,c2), cross(c2,c0), cross(c0,c1) divided by the determinant
+	inline void mat33_inverse (float* out, float const* m) {
+		v4 c0 = load(m), c1 = load(m + 3), c2 = load3(m + 6);
+
+		v4 r0 = cross(c1, c2);
+		v4 r1 = cross(c2, c0);
+		v4 r2 = cross(c0, c1);
+
+		v4 inv_det = set1(1.0f / hsum(mul(c2, r2))); // c2.w is 0, so the w lanes do not matter
+
+		v4 r3 = set1(0);
+		transpose(r0, r1, r2, r3);
+
+		store(out,     mul(r0, inv_det));
+		store(out + 3, mul(r1, inv_det));
+		store3(out + 6, mul(r2, inv_det));
+	}
+}
+}
+#endif
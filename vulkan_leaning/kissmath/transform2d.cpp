@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_TRANSFORM2D_CPP
+#define KISSMATH_TRANSFORM2D_CPP
 #include "transform2d.hpp"
 
 #include <cmath>
@@ -6,7 +8,7 @@
 namespace kissmath {
 	
 	
-	float2x2 rotate2 (float ang) {
+	KISSMATH_INLINE float2x2 rotate2 (float ang) {
 		float s = std::sin(ang), c = std::cos(ang);
 		return float2x2(
 						 c, -s,
@@ -14,7 +16,7 @@ namespace kissmath {
 			   );
 	}
 	
-	float2x2 scale (float2 v) {
+	KISSMATH_INLINE float2x2 scale (float2 v) {
 		return float2x2(
 						v.x,   0,
 						  0, v.y
@@ -24,3 +26,4 @@ namespace kissmath {
 	
 }
 
+#endif
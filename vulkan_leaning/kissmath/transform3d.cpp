@@ -1,4 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
+#ifndef KISSMATH_TRANSFORM3D_CPP
+#define KISSMATH_TRANSFORM3D_CPP
 #include "transform3d.hpp"
 
 #include <cmath>
@@ -6,7 +8,7 @@
 namespace kissmath {
 	
 	
-	float3x3 rotate3_X (float ang) {
+	KISSMATH_INLINE float3x3 rotate3_X (float ang) {
 		float s = std::sin(ang), c = std::cos(ang);
 		return float3x3(
 						 1,  0,  0,
@@ -15,7 +17,7 @@ namespace kissmath {
 			   );
 	}
 	
-	float3x3 rotate3_Y (float ang) {
+	KISSMATH_INLINE float3x3 rotate3_Y (float ang) {
 		float s = std::sin(ang), c = std::cos(ang);
 		return float3x3(
 						 c,  0,  s,
@@ -24,7 +26,7 @@ namespace kissmath {
 			   );
 	}
 	
-	float3x3 rotate3_Z (float ang) {
+	KISSMATH_INLINE float3x3 rotate3_Z (float ang) {
 		float s = std::sin(ang), c = std::cos(ang);
 		return float3x3(
 						 c, -s,  0,
@@ -33,7 +35,7 @@ namespace kissmath {
 			   );
 	}
 	
-	float3x3 scale (float3 v) {
+	KISSMATH_INLINE float3x3 scale (float3 v) {
 		return float3x3(
 						v.x,   0,   0,
 						  0, v.y,   0,
@@ -41,7 +43,7 @@ namespace kissmath {
 			   );
 	}
 	
-	float3x4 translate (float3 v) {
+	KISSMATH_INLINE float3x4 translate (float3 v) {
 		return float3x4(
 						1, 0, 0, v.x,
 						0, 1, 0, v.y,
@@ -52,3 +54,4 @@ namespace kissmath {
 	
 }
 
+#endif
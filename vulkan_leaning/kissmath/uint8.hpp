@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -24,22 +25,25 @@ namespace kissmath {
 	
 	// clamp x into range [a, b]
 	// equivalent to min(max(x,a), b)
-	uint8 clamp (uint8 x, uint8 a, uint8 b);
+	KISSMATH_CONSTEXPR uint8 clamp (uint8 x, uint8 a, uint8 b);
 	
 	// clamp x into range [0, 1]
 	// also known as saturate in hlsl
-	uint8 clamp (uint8 x);
+	KISSMATH_CONSTEXPR uint8 clamp (uint8 x);
 	
 	// returns the greater value of a and b
-	uint8 min (uint8 l, uint8 r);
+	KISSMATH_CONSTEXPR uint8 min (uint8 l, uint8 r);
 	
 	// returns the smaller value of a and b
-	uint8 max (uint8 l, uint8 r);
+	KISSMATH_CONSTEXPR uint8 max (uint8 l, uint8 r);
 	
 	// equivalent to ternary c ? l : r
 	// for conformity with vectors
-	uint8 select (bool c, uint8 l, uint8 r);
+	KISSMATH_CONSTEXPR uint8 select (bool c, uint8 l, uint8 r);
 	
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "uint8.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "uint8.hpp"
 
@@ -34,37 +35,37 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		uint8v3 (uint8 all);
+		KISSMATH_CONSTEXPR uint8v3 (uint8 all);
 		
 		// supply all components
-		uint8v3 (uint8 x, uint8 y, uint8 z);
+		KISSMATH_CONSTEXPR uint8v3 (uint8 x, uint8 y, uint8 z);
 		
 		// extend vector
-		uint8v3 (uint8v2 xy, uint8 z);
+		KISSMATH_CONSTEXPR uint8v3 (uint8v2 xy, uint8 z);
 		
 		// truncate vector
-		uint8v3 (uint8v4 v);
+		KISSMATH_CONSTEXPR uint8v3 (uint8v4 v);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator uint8v2 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v2 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator bool3 () const;
+		KISSMATH_CONSTEXPR explicit operator bool3 () const;
 		
 		// type cast operator
-		explicit operator int64v3 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v3 () const;
 		
 		// type cast operator
-		explicit operator float3 () const;
+		KISSMATH_CONSTEXPR explicit operator float3 () const;
 		
 		// type cast operator
-		explicit operator int3 () const;
+		KISSMATH_CONSTEXPR explicit operator int3 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -83,67 +84,67 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	uint8v3 operator+ (uint8v3 v);
+	KISSMATH_CONSTEXPR uint8v3 operator+ (uint8v3 v);
 	
-	uint8v3 operator+ (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator+ (uint8v3 l, uint8v3 r);
 	
-	uint8v3 operator- (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator- (uint8v3 l, uint8v3 r);
 	
-	uint8v3 operator* (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator* (uint8v3 l, uint8v3 r);
 	
-	uint8v3 operator/ (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator/ (uint8v3 l, uint8v3 r);
 	
 	
 	//// bitwise ops
 	
-	uint8v3 operator~ (uint8v3 v);
+	KISSMATH_CONSTEXPR uint8v3 operator~ (uint8v3 v);
 	
-	uint8v3 operator& (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator& (uint8v3 l, uint8v3 r);
 	
-	uint8v3 operator| (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator| (uint8v3 l, uint8v3 r);
 	
-	uint8v3 operator^ (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 operator^ (uint8v3 l, uint8v3 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator< (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator< (uint8v3 l, uint8v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator<= (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator<= (uint8v3 l, uint8v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator> (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator> (uint8v3 l, uint8v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator>= (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator>= (uint8v3 l, uint8v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator== (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator== (uint8v3 l, uint8v3 r);
 	
 	// componentwise comparison returns a bool vector
-	bool3 operator!= (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool3 operator!= (uint8v3 l, uint8v3 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR bool equal (uint8v3 l, uint8v3 r);
 	
 	// componentwise ternary (c ? l : r)
-	uint8v3 select (bool3 c, uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 select (bool3 c, uint8v3 l, uint8v3 r);
 	
 	
 	//// misc ops
 	// componentwise minimum
-	uint8v3 min (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 min (uint8v3 l, uint8v3 r);
 	
 	// componentwise maximum
-	uint8v3 max (uint8v3 l, uint8v3 r);
+	KISSMATH_CONSTEXPR uint8v3 max (uint8v3 l, uint8v3 r);
 	
 	// componentwise clamp into range [a,b]
-	uint8v3 clamp (uint8v3 x, uint8v3 a, uint8v3 b);
+	KISSMATH_CONSTEXPR uint8v3 clamp (uint8v3 x, uint8v3 a, uint8v3 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	uint8v3 clamp (uint8v3 x);
+	KISSMATH_CONSTEXPR uint8v3 clamp (uint8v3 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	uint8 min_component (uint8v3 v, int* min_index=nullptr);
@@ -164,3 +165,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "uint8v3.cpp"
+#endif
@@ -1,5 +1,6 @@
 // file was generated by kissmath.py at <TODO: add github link>
 #pragma once
+#include "config.hpp"
 
 #include "uint8.hpp"
 
@@ -34,40 +35,40 @@ namespace kissmath {
 		// sets all components to one value
 		// implicit constructor -> float3(x,y,z) * 5 will be turned into float3(x,y,z) * float3(5) by to compiler to be able to execute operator*(float3, float3), which is desirable
 		// and short initialization like float3 a = 0; works
-		uint8v4 (uint8 all);
+		KISSMATH_CONSTEXPR uint8v4 (uint8 all);
 		
 		// supply all components
-		uint8v4 (uint8 x, uint8 y, uint8 z, uint8 w);
+		KISSMATH_CONSTEXPR uint8v4 (uint8 x, uint8 y, uint8 z, uint8 w);
 		
 		// extend vector
-		uint8v4 (uint8v2 xy, uint8 z, uint8 w);
+		KISSMATH_CONSTEXPR uint8v4 (uint8v2 xy, uint8 z, uint8 w);
 		
 		// extend vector
-		uint8v4 (uint8v3 xyz, uint8 w);
+		KISSMATH_CONSTEXPR uint8v4 (uint8v3 xyz, uint8 w);
 		
 		
 		//// Truncating cast operators
 		
 		// truncating cast operator
-		explicit operator uint8v2 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v2 () const;
 		
 		// truncating cast operator
-		explicit operator uint8v3 () const;
+		KISSMATH_CONSTEXPR explicit operator uint8v3 () const;
 		
 		
 		//// Type cast operators
 		
 		// type cast operator
-		explicit operator int64v4 () const;
+		KISSMATH_CONSTEXPR explicit operator int64v4 () const;
 		
 		// type cast operator
-		explicit operator bool4 () const;
+		KISSMATH_CONSTEXPR explicit operator bool4 () const;
 		
 		// type cast operator
-		explicit operator float4 () const;
+		KISSMATH_CONSTEXPR explicit operator float4 () const;
 		
 		// type cast operator
-		explicit operator int4 () const;
+		KISSMATH_CONSTEXPR explicit operator int4 () const;
 		
 		
 		// componentwise arithmetic operator
@@ -86,67 +87,67 @@ namespace kissmath {
 	
 	//// arthmethic ops
 	
-	uint8v4 operator+ (uint8v4 v);
+	KISSMATH_CONSTEXPR uint8v4 operator+ (uint8v4 v);
 	
-	uint8v4 operator+ (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator+ (uint8v4 l, uint8v4 r);
 	
-	uint8v4 operator- (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator- (uint8v4 l, uint8v4 r);
 	
-	uint8v4 operator* (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator* (uint8v4 l, uint8v4 r);
 	
-	uint8v4 operator/ (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator/ (uint8v4 l, uint8v4 r);
 	
 	
 	//// bitwise ops
 	
-	uint8v4 operator~ (uint8v4 v);
+	KISSMATH_CONSTEXPR uint8v4 operator~ (uint8v4 v);
 	
-	uint8v4 operator& (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator& (uint8v4 l, uint8v4 r);
 	
-	uint8v4 operator| (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator| (uint8v4 l, uint8v4 r);
 	
-	uint8v4 operator^ (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 operator^ (uint8v4 l, uint8v4 r);
 	
 	
 	//// comparison ops
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator< (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator< (uint8v4 l, uint8v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator<= (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator<= (uint8v4 l, uint8v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator> (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator> (uint8v4 l, uint8v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator>= (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator>= (uint8v4 l, uint8v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator== (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator== (uint8v4 l, uint8v4 r);
 	
 	// componentwise comparison returns a bool vector
-	bool4 operator!= (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool4 operator!= (uint8v4 l, uint8v4 r);
 	
 	// vectors are equal, equivalent to all(l == r)
-	bool equal (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR bool equal (uint8v4 l, uint8v4 r);
 	
 	// componentwise ternary (c ? l : r)
-	uint8v4 select (bool4 c, uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 select (bool4 c, uint8v4 l, uint8v4 r);
 	
 	
 	//// misc ops
 	// componentwise minimum
-	uint8v4 min (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 min (uint8v4 l, uint8v4 r);
 	
 	// componentwise maximum
-	uint8v4 max (uint8v4 l, uint8v4 r);
+	KISSMATH_CONSTEXPR uint8v4 max (uint8v4 l, uint8v4 r);
 	
 	// componentwise clamp into range [a,b]
-	uint8v4 clamp (uint8v4 x, uint8v4 a, uint8v4 b);
+	KISSMATH_CONSTEXPR uint8v4 clamp (uint8v4 x, uint8v4 a, uint8v4 b);
 	
 	// componentwise clamp into range [0,1] also known as saturate in hlsl
-	uint8v4 clamp (uint8v4 x);
+	KISSMATH_CONSTEXPR uint8v4 clamp (uint8v4 x);
 	
 	// get minimum component of vector, optionally get component index via min_index
 	uint8 min_component (uint8v4 v, int* min_index=nullptr);
@@ -167,3 +168,6 @@ namespace kissmath {
 	
 }
 
+#ifdef KISSMATH_HEADER_ONLY
+#include "uint8v4.cpp"
+#endif
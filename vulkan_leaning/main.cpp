@@ -4,6 +4,18 @@
 #include "assert.h"
 #include <vector>
 #include "util/file_io.hpp"
+#include "util/voxel_mesher.hpp"
+#include "util/terrain_gen.hpp"
+#include "util/chunk_streamer.hpp"
+#include "util/flight_recorder.hpp"
+#include "util/counters.hpp"
+#include "util/counter_reader.hpp"
+#include "util/benchmarks.hpp"
+#include "util/alloc_tracking.hpp"
+#include "util/slot_map.hpp"
+#include "util/flat_hash_map.hpp"
+#include "util/range_allocator.hpp"
+#include <string.h>
 
 const int2 window_size = int2(1280, 720);
 
@@ -38,7 +50,60 @@ VkPipelineLayout				vk_pipeline_layout;
 VkPipeline						vk_pipeline;
 std::vector<VkFramebuffer>		vk_swap_chain_framebuffers;
 VkCommandPool					vk_command_pool;
-std::vector<VkCommandBuffer>	vk_command_buffers;
+std::vector<VkCommandBuffer>	vk_command_buffers; // one per frame in flight, recorded every frame
+
+static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
+
+// two timestamps per frame in flight (start and end of the command buffer), for the gpu track of the profiler
+VkQueryPool						vk_timestamp_pool = VK_NULL_HANDLE; // null if the graphics queue does not support timestamps
+float							vk_timestamp_period; // ns per timestamp
+uint64_t						vk_frame_submit_ticks[MAX_FRAMES_IN_FLIGHT] = {}; // profiler ticks at submit, 0 if not submitted yet
+
+VkImage							vk_depth_image;
+VkDeviceMemory					vk_depth_image_memory;
+VkImageView						vk_depth_image_view;
+static constexpr VkFormat		vk_depth_format = VK_FORMAT_D32_SFLOAT;
+
+VkDescriptorSetLayout			vk_descriptor_set_layout;
+VkDescriptorPool				vk_descriptor_pool;
+
+// shared index buffer for all face draws: 0,1,2, 2,3,0 + face*4 for each face
+VkBuffer						vk_index_buffer;
+VkDeviceMemory					vk_index_buffer_memory;
+
+// storage buffer with the packed faces of all chunks (see pack_face_word), each chunk at its own range from face_ranges
+// one per frame in flight, the cpu only writes to the buffer of the frame whose fence it waited on, so it never touches faces the gpu is still reading
+struct VulkanFaceBuffer {
+	VkBuffer		buffer = VK_NULL_HANDLE;
+	VkDeviceMemory	memory = VK_NULL_HANDLE;
+	uint32_t*		mapped = nullptr;
+	size_t			capacity = 0; // in faces
+
+	std::vector<SlotHandle>	pending; // chunks (in chunk_faces) that changed since this buffer was last written, can contain duplicates and erased chunks
+
+	VkDescriptorSet	descriptor_set;
+};
+VulkanFaceBuffer				vk_face_buffers[MAX_FRAMES_IN_FLIGHT];
+
+// exported every frame, watch with  vulkan_leaning --counters
+Counter counter_draw_calls			("draw calls");
+Counter counter_triangles			("triangles");
+Counter counter_bytes_uploaded		("bytes uploaded");
+Counter counter_chunks_remeshed		("chunks remeshed");
+Counter counter_fence_wait_us		("fence wait us");
+Counter counter_mesher_dirty		("mesher dirty chunks", CT_GAUGE);
+Counter counter_mesher_in_flight	("mesher jobs in flight", CT_GAUGE);
+Counter counter_streamer_pending	("streamer pending chunks", CT_GAUGE);
+Counter counter_streamer_in_flight	("streamer jobs in flight", CT_GAUGE);
+
+// max faces of a chunk, for a checkerboard pattern every second voxel is solid with all 6 faces visible
+static constexpr uint32_t MAX_CHUNK_FACES = CHUNK_VOXELS / 2 * 6;
+static constexpr size_t INITIAL_FACE_BUFFER_CAPACITY = 1 << 16;
+
+struct VoxelPushConstants {
+	float4x4	world_to_clip;
+	float4		chunk_pos; // world position of chunk origin in xyz
+};
 
 VkDebugUtilsMessengerEXT vk_debug_messenger;
 
@@ -435,6 +500,90 @@ void vk_create_image_views () {
 	}
 }
 
+uint32_t vk_find_memory_type (uint32_t type_bits, VkMemoryPropertyFlags props) {
+	VkPhysicalDeviceMemoryProperties mem_props;
+	vkGetPhysicalDeviceMemoryProperties(vk_physical_device, &mem_props);
+
+	for (uint32_t i=0; i<mem_props.memoryTypeCount; ++i) {
+		if ((type_bits & (1u << i)) && (mem_props.memoryTypes[i].propertyFlags & props) == props)
+			return i;
+	}
+
+	assert(false);
+	return 0;
+}
+
+void vk_create_buffer (VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props, VkBuffer* buffer, VkDeviceMemory* memory) {
+	VkBufferCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	info.size = size;
+	info.usage = usage;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	VkResult res = vkCreateBuffer(vk_device, &info, nullptr, buffer);
+	assert(res == VK_SUCCESS);
+
+	VkMemoryRequirements mem_req;
+	vkGetBufferMemoryRequirements(vk_device, *buffer, &mem_req);
+
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = mem_req.size;
+	alloc_info.memoryTypeIndex = vk_find_memory_type(mem_req.memoryTypeBits, props);
+
+	res = vkAllocateMemory(vk_device, &alloc_info, nullptr, memory);
+	assert(res == VK_SUCCESS);
+
+	vkBindBufferMemory(vk_device, *buffer, *memory, 0);
+}
+
+void vk_create_depth_resources () {
+	VkImageCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+	info.imageType = VK_IMAGE_TYPE_2D;
+	info.extent.width  = vk_swap_chain_extent.width ;
+	info.extent.height = vk_swap_chain_extent.height;
+	info.extent.depth = 1;
+	info.mipLevels = 1;
+	info.arrayLayers = 1;
+	info.format = vk_depth_format;
+	info.tiling = VK_IMAGE_TILING_OPTIMAL;
+	info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	info.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+	info.samples = VK_SAMPLE_COUNT_1_BIT;
+	info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+	VkResult res = vkCreateImage(vk_device, &info, nullptr, &vk_depth_image);
+	assert(res == VK_SUCCESS);
+
+	VkMemoryRequirements mem_req;
+	vkGetImageMemoryRequirements(vk_device, vk_depth_image, &mem_req);
+
+	VkMemoryAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.allocationSize = mem_req.size;
+	alloc_info.memoryTypeIndex = vk_find_memory_type(mem_req.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+	res = vkAllocateMemory(vk_device, &alloc_info, nullptr, &vk_depth_image_memory);
+	assert(res == VK_SUCCESS);
+
+	vkBindImageMemory(vk_device, vk_depth_image, vk_depth_image_memory, 0);
+
+	VkImageViewCreateInfo view_info = {};
+	view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+	view_info.image = vk_depth_image;
+	view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	view_info.format = vk_depth_format;
+	view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+	view_info.subresourceRange.baseMipLevel = 0;
+	view_info.subresourceRange.levelCount = 1;
+	view_info.subresourceRange.baseArrayLayer = 0;
+	view_info.subresourceRange.layerCount = 1;
+
+	res = vkCreateImageView(vk_device, &view_info, nullptr, &vk_depth_image_view);
+	assert(res == VK_SUCCESS);
+}
+
 void vk_create_render_pass () {
 	VkAttachmentDescription color_attachment = {};
 	color_attachment.format = vk_swap_chain_image_format;
@@ -446,27 +595,45 @@ void vk_create_render_pass () {
 	color_attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 	color_attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
+	VkAttachmentDescription depth_attachment = {};
+	depth_attachment.format = vk_depth_format;
+	depth_attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+	depth_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+	depth_attachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	depth_attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+	depth_attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	depth_attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	depth_attachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
 	VkAttachmentReference color_attachment_ref = {};
 	color_attachment_ref.attachment = 0;
 	color_attachment_ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
+	VkAttachmentReference depth_attachment_ref = {};
+	depth_attachment_ref.attachment = 1;
+	depth_attachment_ref.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
 	VkSubpassDescription subpass = {};
 	subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 	subpass.colorAttachmentCount = 1;
 	subpass.pColorAttachments = &color_attachment_ref;
+	subpass.pDepthStencilAttachment = &depth_attachment_ref;
 
+	// the depth image is shared between the frames in flight, so the depth writes also have to wait for the previous frame
 	VkSubpassDependency depen = {};
 	depen.srcSubpass = VK_SUBPASS_EXTERNAL;
 	depen.dstSubpass = 0;
-	depen.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	depen.srcAccessMask = 0;
-	depen.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-	depen.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	depen.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	depen.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	depen.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+	depen.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+	VkAttachmentDescription attachments[] = { color_attachment, depth_attachment };
 
 	VkRenderPassCreateInfo info = {};
 	info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-	info.attachmentCount = 1;
-	info.pAttachments = &color_attachment;
+	info.attachmentCount = 2;
+	info.pAttachments = attachments;
 	info.subpassCount = 1;
 	info.pSubpasses = &subpass;
 	info.dependencyCount = 1;
@@ -492,10 +659,26 @@ VkShaderModule vk_create_shader_module (char const* filename) {
 	return shader;
 }
 
+void vk_create_descriptor_set_layout () {
+	VkDescriptorSetLayoutBinding faces_binding = {};
+	faces_binding.binding = 0;
+	faces_binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	faces_binding.descriptorCount = 1;
+	faces_binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+	VkDescriptorSetLayoutCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	info.bindingCount = 1;
+	info.pBindings = &faces_binding;
+
+	VkResult res = vkCreateDescriptorSetLayout(vk_device, &info, nullptr, &vk_descriptor_set_layout);
+	assert(res == VK_SUCCESS);
+}
+
 void vk_create_graphics_pipeline () {
 
-	auto vert_module = vk_create_shader_module("shaders/shader.vert.spv");
-	auto frag_module = vk_create_shader_module("shaders/shader.frag.spv");
+	auto vert_module = vk_create_shader_module("shaders/voxel.vert.spv");
+	auto frag_module = vk_create_shader_module("shaders/voxel.frag.spv");
 
 	VkPipelineShaderStageCreateInfo shader_stages[2] = {};
 
@@ -509,6 +692,7 @@ void vk_create_graphics_pipeline () {
 	shader_stages[1].module = frag_module;
 	shader_stages[1].pName = "main";
 
+	// no vertex input, verticies are pulled from the faces storage buffer in the vertex shader
 	VkPipelineVertexInputStateCreateInfo vert_input = {};
 	vert_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
 	vert_input.vertexBindingDescriptionCount = 0;
@@ -547,7 +731,7 @@ void vk_create_graphics_pipeline () {
 	rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
 	rasterizer.lineWidth = 1.0f;
 	rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-	rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+	rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE; // faces are ccw seen from the outside, the y flip in the projection keeps them ccw in framebuffer space
 	rasterizer.depthBiasEnable = VK_FALSE;
 	rasterizer.depthBiasConstantFactor = 0.0f;
 	rasterizer.depthBiasClamp = 0.0f;
@@ -583,12 +767,25 @@ void vk_create_graphics_pipeline () {
 	color_blending.blendConstants[2] = 0.0f;
 	color_blending.blendConstants[3] = 0.0f;
 
+	VkPipelineDepthStencilStateCreateInfo depth_stencil = {};
+	depth_stencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+	depth_stencil.depthTestEnable = VK_TRUE;
+	depth_stencil.depthWriteEnable = VK_TRUE;
+	depth_stencil.depthCompareOp = VK_COMPARE_OP_LESS;
+	depth_stencil.depthBoundsTestEnable = VK_FALSE;
+	depth_stencil.stencilTestEnable = VK_FALSE;
+
+	VkPushConstantRange push_constants = {};
+	push_constants.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+	push_constants.offset = 0;
+	push_constants.size = sizeof(VoxelPushConstants);
+
 	VkPipelineLayoutCreateInfo pipeline_layout_info = {};
 	pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-	pipeline_layout_info.setLayoutCount = 0;
-	pipeline_layout_info.pSetLayouts = nullptr;
-	pipeline_layout_info.pushConstantRangeCount = 0;
-	pipeline_layout_info.pPushConstantRanges = nullptr;
+	pipeline_layout_info.setLayoutCount = 1;
+	pipeline_layout_info.pSetLayouts = &vk_descriptor_set_layout;
+	pipeline_layout_info.pushConstantRangeCount = 1;
+	pipeline_layout_info.pPushConstantRanges = &push_constants;
 
 	VkResult res = vkCreatePipelineLayout(vk_device, &pipeline_layout_info, nullptr, &vk_pipeline_layout);
 	assert(res == VK_SUCCESS);
@@ -602,7 +799,7 @@ void vk_create_graphics_pipeline () {
 	info.pViewportState			= &viewport_state;
 	info.pRasterizationState	= &rasterizer;
 	info.pMultisampleState		= &multisampling;
-	info.pDepthStencilState		= nullptr;
+	info.pDepthStencilState		= &depth_stencil;
 	info.pColorBlendState		= &color_blending;
 	info.pDynamicState			= nullptr;
 	info.layout					= vk_pipeline_layout;
@@ -624,12 +821,13 @@ void vk_create_framebuffers () {
 	for (size_t i=0; i<vk_swap_chain_image_views.size(); ++i) {
 		VkImageView attachments[] = {
 			vk_swap_chain_image_views[i],
+			vk_depth_image_view,
 		};
 
 		VkFramebufferCreateInfo info = {};
 		info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
 		info.renderPass = vk_render_pass;
-		info.attachmentCount = 1;
+		info.attachmentCount = 2;
 		info.pAttachments = attachments;
 		info.width  = vk_swap_chain_extent.width ;
 		info.height = vk_swap_chain_extent.height;
@@ -647,14 +845,14 @@ void vk_create_command_pool () {
 	VkCommandPoolCreateInfo info = {};
 	info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
 	info.queueFamilyIndex = q_families.graphics_family;
-	info.flags = 0;
+	info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // command buffers get rerecorded every frame
 
 	VkResult res = vkCreateCommandPool(vk_device, &info, nullptr, &vk_command_pool);
 	assert(res == VK_SUCCESS);
 }
 
 void vk_create_command_buffers () {
-	vk_command_buffers.resize(vk_swap_chain_image_views.size());
+	vk_command_buffers.resize(MAX_FRAMES_IN_FLIGHT);
 
 	VkCommandBufferAllocateInfo alloc_info = {};
 	alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -664,41 +862,102 @@ void vk_create_command_buffers () {
 
 	VkResult res = vkAllocateCommandBuffers(vk_device, &alloc_info, vk_command_buffers.data());
 	assert(res == VK_SUCCESS);
+}
 
-	for (size_t i=0; i<vk_command_buffers.size(); ++i) {
-		VkCommandBufferBeginInfo begin_info = {};
-		begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-		begin_info.flags = 0;
-		begin_info.pInheritanceInfo = nullptr;
+void vk_create_index_buffer () {
+	VkDeviceSize size = (VkDeviceSize)MAX_CHUNK_FACES * 6 * sizeof(uint32_t);
 
-		res = vkBeginCommandBuffer(vk_command_buffers[i], &begin_info);
-		assert(res == VK_SUCCESS);
+	// never changes, but host visible to keep it simple
+	vk_create_buffer(size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		&vk_index_buffer, &vk_index_buffer_memory);
 
-		VkRenderPassBeginInfo render_pass_info = {};
-		render_pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		render_pass_info.renderPass = vk_render_pass;
-		render_pass_info.framebuffer = vk_swap_chain_framebuffers[i];
-		render_pass_info.renderArea.offset = { 0, 0 };
-		render_pass_info.renderArea.extent = vk_swap_chain_extent;
+	uint32_t* indices;
+	vkMapMemory(vk_device, vk_index_buffer_memory, 0, size, 0, (void**)&indices);
 
-		VkClearValue clear_color = { 0, 0, 0, 1 };
-		render_pass_info.clearValueCount = 1;
-		render_pass_info.pClearValues = &clear_color;
+	for (uint32_t i=0; i<MAX_CHUNK_FACES; ++i) {
+		indices[i*6 +0] = i*4 +0;
+		indices[i*6 +1] = i*4 +1;
+		indices[i*6 +2] = i*4 +2;
+		indices[i*6 +3] = i*4 +2;
+		indices[i*6 +4] = i*4 +3;
+		indices[i*6 +5] = i*4 +0;
+	}
 
-		vkCmdBeginRenderPass(vk_command_buffers[i], &render_pass_info, VK_SUBPASS_CONTENTS_INLINE);
+	vkUnmapMemory(vk_device, vk_index_buffer_memory);
+}
 
-		vkCmdBindPipeline(vk_command_buffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, vk_pipeline);
+void vk_create_descriptor_pool () {
+	VkDescriptorPoolSize pool_size = {};
+	pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	pool_size.descriptorCount = MAX_FRAMES_IN_FLIGHT;
 
-		vkCmdDraw(vk_command_buffers[i], 3, 1, 0, 0);
+	VkDescriptorPoolCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	info.poolSizeCount = 1;
+	info.pPoolSizes = &pool_size;
+	info.maxSets = MAX_FRAMES_IN_FLIGHT;
 
-		vkCmdEndRenderPass(vk_command_buffers[i]);
+	VkResult res = vkCreateDescriptorPool(vk_device, &info, nullptr, &vk_descriptor_pool);
+	assert(res == VK_SUCCESS);
+}
 
-		res = vkEndCommandBuffer(vk_command_buffers[i]);
-		assert(res == VK_SUCCESS);
+// (re)create the buffer and point its descriptor set to it
+void vk_create_face_buffer (VulkanFaceBuffer* fb, size_t capacity) {
+	VkDeviceSize size = (VkDeviceSize)capacity * sizeof(uint32_t);
+
+	vk_create_buffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		&fb->buffer, &fb->memory);
+
+	vkMapMemory(vk_device, fb->memory, 0, size, 0, (void**)&fb->mapped);
+	fb->capacity = capacity;
+
+	VkDescriptorBufferInfo buffer_info = {};
+	buffer_info.buffer = fb->buffer;
+	buffer_info.offset = 0;
+	buffer_info.range = VK_WHOLE_SIZE;
+
+	VkWriteDescriptorSet write = {};
+	write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	write.dstSet = fb->descriptor_set;
+	write.dstBinding = 0;
+	write.dstArrayElement = 0;
+	write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	write.descriptorCount = 1;
+	write.pBufferInfo = &buffer_info;
+
+	vkUpdateDescriptorSets(vk_device, 1, &write, 0, nullptr);
+}
+void vk_destroy_face_buffer (VulkanFaceBuffer* fb) {
+	vkUnmapMemory(vk_device, fb->memory);
+	vkDestroyBuffer(vk_device, fb->buffer, nullptr);
+	vkFreeMemory(vk_device, fb->memory, nullptr);
+	fb->buffer = VK_NULL_HANDLE;
+	fb->memory = VK_NULL_HANDLE;
+	fb->mapped = nullptr;
+	fb->capacity = 0;
+}
+
+void vk_create_face_buffers () {
+	VkDescriptorSetLayout layouts[MAX_FRAMES_IN_FLIGHT];
+	for (auto& l : layouts)
+		l = vk_descriptor_set_layout;
+
+	VkDescriptorSetAllocateInfo alloc_info = {};
+	alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	alloc_info.descriptorPool = vk_descriptor_pool;
+	alloc_info.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
+	alloc_info.pSetLayouts = layouts;
+
+	VkDescriptorSet sets[MAX_FRAMES_IN_FLIGHT];
+	VkResult res = vkAllocateDescriptorSets(vk_device, &alloc_info, sets);
+	assert(res == VK_SUCCESS);
+
+	for (int i=0; i<MAX_FRAMES_IN_FLIGHT; ++i) {
+		vk_face_buffers[i].descriptor_set = sets[i];
+		vk_create_face_buffer(&vk_face_buffers[i], INITIAL_FACE_BUFFER_CAPACITY);
 	}
 }
 
-static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
 std::vector<VkSemaphore> imageAvailableSemaphores;
 std::vector<VkSemaphore> renderFinishedSemaphores;
 std::vector<VkFence> inFlightFences;
@@ -725,6 +984,22 @@ void vk_create_semaphores () {
 	}
 }
 
+void vk_create_timestamp_queries () {
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(vk_physical_device, &props);
+	if (!props.limits.timestampComputeAndGraphics)
+		return;
+	vk_timestamp_period = props.limits.timestampPeriod;
+
+	VkQueryPoolCreateInfo info = {};
+	info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	info.queryCount = MAX_FRAMES_IN_FLIGHT * 2;
+
+	auto res = vkCreateQueryPool(vk_device, &info, nullptr, &vk_timestamp_pool);
+	assert(res == VK_SUCCESS);
+}
+
 void vk_init () {
 	vk_create_instance();
 
@@ -738,12 +1013,18 @@ void vk_init () {
 	vk_create_logical_device();
 	vk_create_swap_chain();
 	vk_create_image_views();
+	vk_create_depth_resources();
 	vk_create_render_pass();
+	vk_create_descriptor_set_layout();
 	vk_create_graphics_pipeline();
 	vk_create_framebuffers();
 	vk_create_command_pool();
 	vk_create_command_buffers();
+	vk_create_index_buffer();
+	vk_create_descriptor_pool();
+	vk_create_face_buffers();
 	vk_create_semaphores();
+	vk_create_timestamp_queries();
 }
 
 void vk_deinit () {
@@ -755,6 +1036,16 @@ void vk_deinit () {
 		vkDestroyFence(vk_device, inFlightFences[i], nullptr);
 	}
 
+	if (vk_timestamp_pool)
+		vkDestroyQueryPool(vk_device, vk_timestamp_pool, nullptr);
+
+	for (auto& fb : vk_face_buffers)
+		vk_destroy_face_buffer(&fb);
+	vkDestroyDescriptorPool(vk_device, vk_descriptor_pool, nullptr);
+
+	vkDestroyBuffer(vk_device, vk_index_buffer, nullptr);
+	vkFreeMemory(vk_device, vk_index_buffer_memory, nullptr);
+
 	vkDestroyCommandPool(vk_device, vk_command_pool, nullptr);
 
 	for (auto& fb : vk_swap_chain_framebuffers) {
@@ -763,8 +1054,13 @@ void vk_deinit () {
 
 	vkDestroyPipeline(vk_device, vk_pipeline, nullptr);
 	vkDestroyPipelineLayout(vk_device, vk_pipeline_layout, nullptr);
+	vkDestroyDescriptorSetLayout(vk_device, vk_descriptor_set_layout, nullptr);
 	vkDestroyRenderPass(vk_device, vk_render_pass, nullptr);
 
+	vkDestroyImageView(vk_device, vk_depth_image_view, nullptr);
+	vkDestroyImage(vk_device, vk_depth_image, nullptr);
+	vkFreeMemory(vk_device, vk_depth_image_memory, nullptr);
+
 	for (auto& iv : vk_swap_chain_image_views)
 		vkDestroyImageView(vk_device, iv, nullptr);
 
@@ -778,10 +1074,234 @@ void vk_deinit () {
 	vkDestroyInstance(vk_instance, nullptr);
 }
 
+//// Voxel scene
+
+static constexpr int WORLD_CHUNKS = 8; // camera orbits around the center of WORLD_CHUNKS x WORLD_CHUNKS chunks, the streamer loads the chunks around it
+
+VoxelWorld world;
+std::unique_ptr<TerrainGenerator> generator;
+std::unique_ptr<ChunkStreamer> streamer;
+std::unique_ptr<ChunkMesher> mesher;
+
+// packed faces of each chunk, converted from the mesher output
+struct ChunkFaces {
+	chunk_coord				coord;
+	std::vector<uint32_t>	words;
+	RangeAllocator::Range	range; // where the words are in the face buffers, same in all of them
+};
+// stored densely so recording the draws walks one array instead of the hash map nodes
+SlotMap<ChunkFaces> chunk_faces;
+FlatHashMap<chunk_coord, SlotHandle> chunk_face_handles;
+
+// ranges of the face buffers, a remeshed chunk only gets a new range if its size class changed
+RangeAllocator face_ranges;
+
+void init_streamer () {
+	generator = std::make_unique<TerrainGenerator>(TerrainSettings());
+	streamer = std::make_unique<ChunkStreamer>(*generator, std::max((int)std::thread::hardware_concurrency() / 2, 1));
+
+	// terrain is at most base_height + height_amplitude high
+	streamer->max_z = (int)std::ceil((generator->settings.base_height + generator->settings.height_amplitude) / (float)CHUNK_SIZE) - 1;
+}
+
+float3 get_camera_target () {
+	return float3((float)(WORLD_CHUNKS * CHUNK_SIZE) * 0.5f, (float)(WORLD_CHUNKS * CHUNK_SIZE) * 0.5f, 16.0f);
+}
+// orbit around the center of the world, z is up
+float3 get_camera_pos (float time) {
+	float ang = time * 0.1f;
+	return get_camera_target() + float3(cosf(ang), sinf(ang), 0) * 180.0f + float3(0, 0, 80.0f);
+}
+
+void update_scene () {
+	PROFILE_FUNCTION();
+	ALLOC_TAG("scene");
+
+	float3 camera_pos = get_camera_pos((float)glfwGetTime());
+
+	// before apply_edits, holds back the edits of chunks that are still loading
+	streamer->update(world, camera_pos);
+
+	// edits queued during the frame (VoxelWorld::set_block) all get applied here, the mesher spreads the remeshing over the next frames
+	world.apply_edits();
+
+	mesher->update(world, camera_pos);
+
+	mesher->flush_uploads([&] (chunk_coord coord, ChunkMesher::ChunkMesh const* mesh) {
+		counter_chunks_remeshed.add();
+		SlotHandle* handle = chunk_face_handles.find(coord);
+		if (!mesh) {
+			if (handle) {
+				face_ranges.free(chunk_faces[*handle].range);
+				chunk_faces.erase(*handle);
+				chunk_face_handles.erase(coord);
+			}
+			return;
+		}
+
+		if (!handle)
+			handle = chunk_face_handles.try_emplace(coord, chunk_faces.insert({ coord, {} })).first;
+
+		auto& chunk = chunk_faces[*handle];
+		chunk.words.clear();
+		for (auto& f : mesh->faces)
+			chunk.words.push_back(pack_face_word(f));
+		assert(chunk.words.size() <= MAX_CHUNK_FACES);
+
+		uint32_t count = (uint32_t)chunk.words.size();
+		if (RangeAllocator::round_size(count) != chunk.range.size) {
+			face_ranges.free(chunk.range);
+			chunk.range = face_ranges.alloc(count);
+		}
+
+		for (auto& fb : vk_face_buffers)
+			fb.pending.push_back(*handle);
+	});
+}
+
+// write the chunks that changed since this buffer was last used to their ranges, or all chunks if the buffer had to grow
+// only call after waiting for the fence of the frame that owns the buffer
+void update_face_buffer (VulkanFaceBuffer* fb) {
+	size_t bytes = 0;
+
+	if (face_ranges.end() > fb->capacity) {
+		size_t capacity = fb->capacity;
+		while (capacity < face_ranges.end())
+			capacity *= 2;
+
+		vk_destroy_face_buffer(fb);
+		vk_create_face_buffer(fb, capacity);
+
+		for (auto& chunk : chunk_faces) {
+			memcpy(fb->mapped + chunk.range.offset, chunk.words.data(), chunk.words.size() * sizeof(uint32_t));
+			bytes += chunk.words.size() * sizeof(uint32_t);
+		}
+	} else {
+		for (SlotHandle h : fb->pending) {
+			ChunkFaces* chunk = chunk_faces.get(h);
+			if (!chunk)
+				continue; // erased since
+
+			memcpy(fb->mapped + chunk->range.offset, chunk->words.data(), chunk->words.size() * sizeof(uint32_t));
+			bytes += chunk->words.size() * sizeof(uint32_t);
+		}
+	}
+
+	fb->pending.clear();
+	counter_bytes_uploaded.add((int64_t)bytes);
+}
+
+float4x4 calc_world_to_clip (float aspect, float time) {
+	float3 target = get_camera_target();
+	float3 cam_pos = get_camera_pos(time);
+
+	float3 forw = normalize(target - cam_pos);
+	float3 right = normalize(cross(forw, float3(0,0,1)));
+	float3 up = cross(right, forw);
+
+	// camera looks along -z with y up
+	float4x4 world_to_cam = float4x4::rows(
+		float4(  right, -dot(right, cam_pos)),
+		float4(     up, -dot(up,    cam_pos)),
+		float4(  -forw, +dot(forw,  cam_pos)),
+		float4(0,0,0,1)
+	);
+
+	// perspective for vulkan clip space: y points down and depth goes from 0 at near to 1 at far
+	float vfov = deg(70);
+	float clip_near = 0.1f, clip_far = 1000.0f;
+	float f = 1.0f / tanf(vfov * 0.5f);
+
+	float4x4 cam_to_clip = float4x4::rows(
+		f / aspect,  0, 0, 0,
+		0,          -f, 0, 0,
+		0,           0, clip_far / (clip_near - clip_far), clip_near * clip_far / (clip_near - clip_far),
+		0,           0, -1, 0
+	);
+
+	return cam_to_clip * world_to_cam;
+}
+
+void record_command_buffer (VkCommandBuffer cmd, uint32_t image_index, VulkanFaceBuffer const& fb, uint32_t frame) {
+	// recording is per frame work that has all its memory already, allocations in here are bugs
+	NO_ALLOC_SCOPE();
+
+	VkCommandBufferBeginInfo begin_info = {};
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	begin_info.pInheritanceInfo = nullptr;
+
+	VkResult res = vkBeginCommandBuffer(cmd, &begin_info);
+	assert(res == VK_SUCCESS);
+
+	if (vk_timestamp_pool) {
+		vkCmdResetQueryPool(cmd, vk_timestamp_pool, frame * 2, 2);
+		vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, vk_timestamp_pool, frame * 2);
+	}
+
+	VkRenderPassBeginInfo render_pass_info = {};
+	render_pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+	render_pass_info.renderPass = vk_render_pass;
+	render_pass_info.framebuffer = vk_swap_chain_framebuffers[image_index];
+	render_pass_info.renderArea.offset = { 0, 0 };
+	render_pass_info.renderArea.extent = vk_swap_chain_extent;
+
+	VkClearValue clear_values[2] = {};
+	clear_values[0].color = { 0.5f, 0.7f, 0.9f, 1 };
+	clear_values[1].depthStencil = { 1, 0 };
+	render_pass_info.clearValueCount = 2;
+	render_pass_info.pClearValues = clear_values;
+
+	vkCmdBeginRenderPass(cmd, &render_pass_info, VK_SUBPASS_CONTENTS_INLINE);
+
+	vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk_pipeline);
+	vkCmdBindIndexBuffer(cmd, vk_index_buffer, 0, VK_INDEX_TYPE_UINT32);
+	vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk_pipeline_layout, 0, 1, &fb.descriptor_set, 0, nullptr);
+
+	VoxelPushConstants pc;
+	pc.world_to_clip = calc_world_to_clip((float)vk_swap_chain_extent.width / (float)vk_swap_chain_extent.height, (float)glfwGetTime());
+
+	for (auto& chunk : chunk_faces) {
+		uint32_t face_count = (uint32_t)chunk.words.size();
+		if (face_count == 0)
+			continue;
+
+		pc.chunk_pos = float4((float3)(chunk.coord * CHUNK_SIZE), 0);
+		vkCmdPushConstants(cmd, vk_pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(pc), &pc);
+
+		// vertexOffset shifts gl_VertexIndex to the first face of the chunk, so the same indices work for every chunk
+		vkCmdDrawIndexed(cmd, face_count * 6, 1, 0, (int32_t)(chunk.range.offset * 4), 0);
+		counter_draw_calls.add();
+		counter_triangles.add(face_count * 2);
+	}
+
+	vkCmdEndRenderPass(cmd);
+
+	if (vk_timestamp_pool)
+		vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, vk_timestamp_pool, frame * 2 + 1);
+
+	res = vkEndCommandBuffer(cmd);
+	assert(res == VK_SUCCESS);
+}
+
 size_t currentFrame = 0;
 
 void draw () {
+	PROFILE_FUNCTION();
+	ALLOC_TAG("render");
+
+	auto fence_timer = kiss::Timer::start();
 	vkWaitForFences(vk_device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX);
+	counter_fence_wait_us.add((int64_t)(fence_timer.end() * 1000000));
+
+	// the fence guarantees the timestamps of the last submit of this frame are available
+	//  the gpu track places the gpu time at the submit time, no cpu-gpu clock calibration (start is early by the queue latency)
+	if (vk_timestamp_pool && vk_frame_submit_ticks[currentFrame] != 0) {
+		uint64_t ts[2];
+		auto qres = vkGetQueryPoolResults(vk_device, vk_timestamp_pool, (uint32_t)currentFrame * 2, 2, sizeof(ts), ts, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+		if (qres == VK_SUCCESS)
+			profiler::gpu_zone("gpu frame", vk_frame_submit_ticks[currentFrame], (double)(ts[1] - ts[0]) * vk_timestamp_period * 1e-9);
+	}
 	
 	// Aquire image
 	uint32_t image_index;
@@ -793,6 +1313,10 @@ void draw () {
 
 	imagesInFlight[image_index] = inFlightFences[currentFrame];
 
+	// the gpu is done with this frames command buffer and face buffer
+	update_face_buffer(&vk_face_buffers[currentFrame]);
+	record_command_buffer(vk_command_buffers[currentFrame], image_index, vk_face_buffers[currentFrame], (uint32_t)currentFrame);
+
 	// Draw image
 	VkSemaphore wait_semaphores[] = { imageAvailableSemaphores[currentFrame] };
 	VkPipelineStageFlags wait_stages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
@@ -805,12 +1329,13 @@ void draw () {
 	submit_info.pWaitSemaphores = wait_semaphores;
 	submit_info.pWaitDstStageMask = wait_stages;
 	submit_info.commandBufferCount = 1;
-	submit_info.pCommandBuffers = &vk_command_buffers[image_index];
+	submit_info.pCommandBuffers = &vk_command_buffers[currentFrame];
 	submit_info.signalSemaphoreCount = 1;
 	submit_info.pSignalSemaphores = signal_semaphores;
 
 	vkResetFences(vk_device, 1, &inFlightFences[currentFrame]);
 
+	vk_frame_submit_ticks[currentFrame] = profiler::ticks();
 	VkResult res = vkQueueSubmit(vk_graphics_queue, 1, &submit_info, inFlightFences[currentFrame]);
 	assert(res == VK_SUCCESS);
 
@@ -831,7 +1356,18 @@ void draw () {
 	currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
 }
 
-int main () {
+int main (int argc, char** argv) {
+	// run as the counter viewer of another running instance instead
+	if (argc > 1 && strcmp(argv[1], "--counters") == 0)
+		return run_counter_reader(argc > 2 ? argv[2] : "perf_counters.bin");
+	// or run one of the micro benchmarks
+	if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+		return run_benchmark(argc - 2, argv + 2);
+
+	set_thread_description("main");
+	counters::open_shared("perf_counters.bin");
+	// the frame loop should not allocate while drawing, warn when it does
+	alloc_tracking::set_frame_budget(alloc_tracking::get_tag("render"), 0, -1);
 
 	glfwInit();
 
@@ -841,17 +1377,48 @@ int main () {
 
 	vk_init();
 
+	// unit faces, greedy quads do not fit into the 32 bit face words
+	mesher = std::make_unique<ChunkMesher>(std::max((int)std::thread::hardware_concurrency() - 1, 1));
+	mesher->greedy = false;
+
+	init_streamer();
+
+	// writes hitch_<n>.json with the last seconds of all threads when a frame spikes
+	FlightRecorder flight_recorder;
+	auto frame_timer = kiss::Timer::start();
+
 	while(!glfwWindowShouldClose(glfw_window)) {
+		PROFILE_FRAME();
+
+		flight_recorder.frame(frame_timer.end());
+		frame_timer = kiss::Timer::start();
+
 		glfwPollEvents();
 
+		update_scene();
+
 		draw();
+
+		counter_mesher_dirty.set((int64_t)mesher->dirty_count());
+		counter_mesher_in_flight.set(mesher->in_flight());
+		counter_streamer_pending.set((int64_t)streamer->pending_count());
+		counter_streamer_in_flight.set(streamer->in_flight());
+		alloc_tracking::end_frame();
+		counters::snapshot();
 	}
 
+	profiler::write_chrome_trace("profile.json");
+
 	vk_deinit();
 
+	mesher = nullptr;
+	streamer = nullptr;
+	generator = nullptr;
+
 	glfwDestroyWindow(glfw_window);
 
 	glfwTerminate();
 
+	counters::close_shared();
 	return 0;
 }
@@ -1,3 +1,3 @@
 
-D:\coding\vulkan_sdk\Bin32\glslc.exe shader.vert -o shader.vert.spv
-D:\coding\vulkan_sdk\Bin32\glslc.exe shader.frag -o shader.frag.spv
+D:\coding\vulkan_sdk\Bin32\glslc.exe voxel.vert -o voxel.vert.spv
+D:\coding\vulkan_sdk\Bin32\glslc.exe voxel.frag -o voxel.frag.spv
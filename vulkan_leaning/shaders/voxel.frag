@@ -2,9 +2,10 @@
 #extension GL_ARB_seperate_shader_objects : enable
 
 layout(location = 0) in vec3 vs_col;
+layout(location = 1) in float vs_ao;
 
 layout(location = 0) out vec4 frag_col;
 
 void main () {
-	frag_col = vec4(vs_col, 1.0);
+	frag_col = vec4(vs_col * mix(0.35, 1.0, vs_ao), 1.0);
 }
@@ -0,0 +1,88 @@
+#version 450
+
+// Vertex pulling voxel face renderer
+// no vertex input, every face is one packed word in the faces buffer, every face is drawn as 4 verticies via the shared index buffer (0,1,2, 2,3,0 per face)
+// so face = gl_VertexIndex / 4 and corner = gl_VertexIndex % 4 (vertexOffset of the draw = first_face * 4 is included in gl_VertexIndex)
+
+// face word: x:5 y:5 z:5 face:3 ao:8 block:6
+//  face is -x,+x,-y,+y,-z,+z, ao is 2 bits per corner (0 = fully occluded, 3 = open)
+layout(std430, set = 0, binding = 0) readonly buffer Faces {
+	uint faces[];
+};
+
+layout(push_constant) uniform PushConstants {
+	mat4 world_to_clip;
+	vec4 chunk_pos; // world position of the chunk origin in xyz
+};
+
+layout(location = 0) out vec3 vs_col;
+layout(location = 1) out float vs_ao;
+
+// corners in the plane of the face, along the two other axes in xyz order
+const vec2 corners[4] = vec2[] (
+	vec2(0, 0),
+	vec2(1, 0),
+	vec2(1, 1),
+	vec2(0, 1)
+);
+
+// other two axes of the face axis in xyz order
+const ivec2 face_axes[3] = ivec2[] (
+	ivec2(1, 2),
+	ivec2(0, 2),
+	ivec2(0, 1)
+);
+
+const vec3 block_colors[8] = vec3[] (
+	vec3(1.0, 0.0, 1.0), // air, should not be meshed
+	vec3(0.5, 0.5, 0.5), // stone
+	vec3(0.5, 0.3, 0.1), // dirt
+	vec3(0.2, 0.6, 0.1), // grass
+	vec3(0.8, 0.7, 0.4), // sand
+	vec3(0.9, 0.9, 0.9),
+	vec3(0.7, 0.2, 0.2),
+	vec3(0.2, 0.3, 0.8)
+);
+
+// simple fixed lighting per face direction
+const float face_brightness[6] = float[] ( 0.75, 0.75, 0.85, 0.85, 0.6, 1.0 );
+
+void main () {
+	uint face_word = faces[uint(gl_VertexIndex) >> 2];
+	uint corner = uint(gl_VertexIndex) & 3u;
+
+	vec3 voxel = vec3(float(face_word & 31u), float((face_word >> 5) & 31u), float((face_word >> 10) & 31u));
+	uint face = (face_word >> 15) & 7u;
+	uint ao = (face_word >> 18) & 255u;
+	uint block = face_word >> 26;
+
+	uint axis = face >> 1;
+	bool positive = (face & 1u) != 0u;
+
+	uint ao0 = ao & 3u;
+	uint ao1 = (ao >> 2) & 3u;
+	uint ao2 = (ao >> 4) & 3u;
+	uint ao3 = (ao >> 6) & 3u;
+
+	// flip the diagonal the quad is split along if the ao of the other diagonal is brighter to avoid anisotropic ao interpolation
+	// rotating the corners keeps the winding
+	if (ao0 + ao2 < ao1 + ao3)
+		corner = (corner + 1u) & 3u;
+
+	// make quads counter clockwise when seen from the outside by mirroring (swapping corner 1 and 3)
+	// the corner order is counter clockwise seen from +x and +z, but seen from -y for y faces
+	if ((axis == 1u) == positive)
+		corner = (4u - corner) & 3u;
+
+	ivec2 axes = face_axes[axis];
+
+	vec3 pos = voxel;
+	pos[axis] += positive ? 1.0 : 0.0;
+	pos[axes.x] += corners[corner].x;
+	pos[axes.y] += corners[corner].y;
+
+	gl_Position = world_to_clip * vec4(pos + chunk_pos.xyz, 1.0);
+
+	vs_col = block_colors[block & 7u] * face_brightness[face];
+	vs_ao = float((ao >> (corner * 2u)) & 3u) / 3.0;
+}
@@ -0,0 +1,280 @@
+#include "alloc_tracking.hpp"
+#include "counters.hpp"
+#include "assert.h"
+#include <new>
+#include <mutex>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <stdio.h>
+
+namespace alloc_tracking {
+	// own cache line per tag, threads allocating with different tags do not contend
+	struct alignas(64) TagCounters {
+		std::atomic<int64_t>	live_bytes;
+		std::atomic<int64_t>	high_water;
+		std::atomic<int64_t>	allocs;
+		std::atomic<int64_t>	alloc_bytes;
+	};
+
+	// all constant initialized, allocations during static initialization work
+	static TagCounters			tags[MAX_TAGS];
+	static const char*			tag_names[MAX_TAGS] = { "untagged" };
+	static std::atomic<int>		tag_num { 1 };
+	static std::mutex			tag_mutex;
+
+	std::atomic<int64_t>		no_alloc_violations { 0 };
+
+	int get_tag (const char* name) {
+		std::lock_guard<std::mutex> lock(tag_mutex);
+
+		int count = tag_num.load(std::memory_order_relaxed);
+		for (int i=0; i<count; ++i) {
+			if (strcmp(tag_names[i], name) == 0)
+				return i;
+		}
+
+		assert(count < MAX_TAGS);
+		if (count >= MAX_TAGS)
+			return 0;
+
+		tag_names[count] = name;
+		tag_num.store(count + 1, std::memory_order_release);
+		return count;
+	}
+	int tag_count () {
+		return tag_num.load(std::memory_order_acquire);
+	}
+
+	// in front of every tracked allocation, keeps the returned pointer 16 byte aligned
+	struct Header {
+		uint64_t	size;
+		uint16_t	tag;
+		uint16_t	aligned; // allocated with the aligned allocation function
+		uint32_t	offset; // from the start of the allocation to the returned pointer
+	};
+	static_assert(sizeof(Header) == 16, "");
+
+	static void on_alloc (int tag, size_t size) {
+	#if ALLOC_TRACKING_ENABLE
+		if (no_alloc_depth > 0) {
+			no_alloc_violations.fetch_add(1, std::memory_order_relaxed);
+		#if ALLOC_TRACKING_ASSERT_NO_ALLOC
+			assert(!"heap allocation in a NO_ALLOC_SCOPE");
+		#endif
+		}
+	#endif
+
+		auto& t = tags[tag];
+		t.allocs.fetch_add(1, std::memory_order_relaxed);
+		t.alloc_bytes.fetch_add((int64_t)size, std::memory_order_relaxed);
+
+		int64_t live = t.live_bytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size;
+		int64_t high = t.high_water.load(std::memory_order_relaxed);
+		while (live > high && !t.high_water.compare_exchange_weak(high, live, std::memory_order_relaxed))
+			;
+	}
+
+	static void* alloc (size_t size, size_t align) {
+		void* base;
+		uint32_t offset;
+		if (align <= sizeof(Header)) {
+			offset = sizeof(Header);
+			base = ::malloc(size + offset);
+		} else {
+			offset = (uint32_t)align;
+		#if defined(_WIN32)
+			base = _aligned_malloc(size + offset, align);
+		#else
+			base = aligned_alloc(align, (size + offset + align - 1) / align * align);
+		#endif
+		}
+		if (!base)
+			return nullptr;
+
+		int tag = current_tag;
+		char* ptr = (char*)base + offset;
+
+		Header* h = (Header*)ptr - 1;
+		h->size = size;
+		h->tag = (uint16_t)tag;
+		h->aligned = align > sizeof(Header);
+		h->offset = offset;
+
+		on_alloc(tag, size);
+		return ptr;
+	}
+
+	static void dealloc (void* ptr) {
+		if (!ptr)
+			return;
+
+		Header* h = (Header*)ptr - 1;
+		tags[h->tag].live_bytes.fetch_sub((int64_t)h->size, std::memory_order_relaxed);
+
+		void* base = (char*)ptr - h->offset;
+		if (h->aligned) {
+		#if defined(_WIN32)
+			_aligned_free(base);
+		#else
+			::free(base);
+		#endif
+		} else {
+			::free(base);
+		}
+	}
+
+	void* malloc (size_t size) {
+		return alloc(size, sizeof(Header));
+	}
+	void free (void* ptr) {
+		dealloc(ptr);
+	}
+	void* realloc (void* ptr, size_t size) {
+		if (!ptr)
+			return alloc(size, sizeof(Header));
+
+		Header* h = (Header*)ptr - 1;
+		if (h->aligned) {
+			// aligned allocations can not be realloc-ed
+			void* new_ptr = alloc(size, sizeof(Header));
+			if (new_ptr) {
+				memcpy(new_ptr, ptr, h->size < size ? h->size : size);
+				dealloc(ptr);
+			}
+			return new_ptr;
+		}
+
+		size_t old_size = h->size;
+		int old_tag = h->tag;
+
+		char* base = (char*)::realloc((char*)ptr - sizeof(Header), size + sizeof(Header));
+		if (!base)
+			return nullptr; // old block is still valid
+
+		tags[old_tag].live_bytes.fetch_sub((int64_t)old_size, std::memory_order_relaxed);
+
+		int tag = current_tag;
+		h = (Header*)base;
+		h->size = size;
+		h->tag = (uint16_t)tag;
+
+		on_alloc(tag, size);
+		return base + sizeof(Header);
+	}
+
+	// main thread only
+	struct FrameState {
+		int64_t		last_allocs = 0;
+		int64_t		last_bytes = 0;
+		int64_t		frame_allocs = 0;
+		int64_t		frame_bytes = 0;
+		int64_t		budget_allocs = -1;
+		int64_t		budget_bytes = -1;
+		bool		over_budget = false;
+		int64_t		over_budget_frames = 0;
+
+		Counter*	counter_allocs = nullptr;
+		Counter*	counter_live = nullptr;
+	};
+	static FrameState frame_state[MAX_TAGS];
+
+	TagStats get_stats (int tag) {
+		auto& t = tags[tag];
+		auto& f = frame_state[tag];
+
+		TagStats s;
+		s.name = tag_names[tag];
+		s.live_bytes = t.live_bytes.load(std::memory_order_relaxed);
+		s.high_water = t.high_water.load(std::memory_order_relaxed);
+		s.total_allocs = t.allocs.load(std::memory_order_relaxed);
+		s.frame_allocs = f.frame_allocs;
+		s.frame_bytes = f.frame_bytes;
+		s.over_budget_frames = f.over_budget_frames;
+		return s;
+	}
+
+	void set_frame_budget (int tag, int64_t max_allocs, int64_t max_bytes) {
+		frame_state[tag].budget_allocs = max_allocs;
+		frame_state[tag].budget_bytes = max_bytes;
+	}
+
+	void end_frame () {
+		int count = tag_count();
+		for (int i=0; i<count; ++i) {
+			auto& t = tags[i];
+			auto& f = frame_state[i];
+
+			int64_t allocs = t.allocs.load(std::memory_order_relaxed);
+			int64_t bytes = t.alloc_bytes.load(std::memory_order_relaxed);
+			f.frame_allocs = allocs - f.last_allocs;
+			f.frame_bytes = bytes - f.last_bytes;
+			f.last_allocs = allocs;
+			f.last_bytes = bytes;
+
+			bool over = (f.budget_allocs >= 0 && f.frame_allocs > f.budget_allocs) ||
+			            (f.budget_bytes >= 0 && f.frame_bytes > f.budget_bytes);
+			if (over) {
+				f.over_budget_frames++;
+				if (!f.over_budget) // only warn when going over, not every frame
+					fprintf(stderr, "alloc budget of \"%s\" exceeded: %lld allocs, %lld bytes this frame\n", tag_names[i], (long long)f.frame_allocs, (long long)f.frame_bytes);
+			}
+			f.over_budget = over;
+
+			// counters get created on the first frame the tag exists, their names are never freed, like the tags
+			if (!f.counter_allocs) {
+				f.counter_allocs = new Counter((new std::string(std::string("allocs ") + tag_names[i]))->c_str());
+				f.counter_live = new Counter((new std::string(std::string("live bytes ") + tag_names[i]))->c_str(), CT_GAUGE);
+			}
+			f.counter_allocs->set(allocs);
+			f.counter_live->set(t.live_bytes.load(std::memory_order_relaxed));
+		}
+	}
+}
+
+#if ALLOC_TRACKING_ENABLE
+// replace the global allocation functions, all other forms of new / delete call these
+void* operator new (size_t size) {
+	void* ptr = alloc_tracking::alloc(size, sizeof(alloc_tracking::Header));
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+void* operator new[] (size_t size) {
+	return operator new(size);
+}
+void* operator new (size_t size, std::nothrow_t const&) noexcept {
+	return alloc_tracking::alloc(size, sizeof(alloc_tracking::Header));
+}
+void* operator new[] (size_t size, std::nothrow_t const&) noexcept {
+	return alloc_tracking::alloc(size, sizeof(alloc_tracking::Header));
+}
+void* operator new (size_t size, std::align_val_t align) {
+	void* ptr = alloc_tracking::alloc(size, (size_t)align);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+void* operator new[] (size_t size, std::align_val_t align) {
+	return operator new(size, align);
+}
+void* operator new (size_t size, std::align_val_t align, std::nothrow_t const&) noexcept {
+	return alloc_tracking::alloc(size, (size_t)align);
+}
+void* operator new[] (size_t size, std::align_val_t align, std::nothrow_t const&) noexcept {
+	return alloc_tracking::alloc(size, (size_t)align);
+}
+
+void operator delete (void* ptr) noexcept										{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr) noexcept										{ alloc_tracking::dealloc(ptr); }
+void operator delete (void* ptr, size_t) noexcept								{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr, size_t) noexcept								{ alloc_tracking::dealloc(ptr); }
+void operator delete (void* ptr, std::nothrow_t const&) noexcept				{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr, std::nothrow_t const&) noexcept				{ alloc_tracking::dealloc(ptr); }
+void operator delete (void* ptr, std::align_val_t) noexcept						{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr, std::align_val_t) noexcept					{ alloc_tracking::dealloc(ptr); }
+void operator delete (void* ptr, size_t, std::align_val_t) noexcept				{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr, size_t, std::align_val_t) noexcept			{ alloc_tracking::dealloc(ptr); }
+void operator delete (void* ptr, std::align_val_t, std::nothrow_t const&) noexcept		{ alloc_tracking::dealloc(ptr); }
+void operator delete[] (void* ptr, std::align_val_t, std::nothrow_t const&) noexcept	{ alloc_tracking::dealloc(ptr); }
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+#include "stdint.h"
+#include <cstddef>
+#include <atomic>
+
+// set to 0 to not replace global new / delete and make the macros do nothing (alloc_tracking::malloc / free still count into "untagged")
+#ifndef ALLOC_TRACKING_ENABLE
+	#define ALLOC_TRACKING_ENABLE 1
+#endif
+// assert on heap allocations inside NO_ALLOC_SCOPE, else they are only counted in no_alloc_violations
+#ifndef ALLOC_TRACKING_ASSERT_NO_ALLOC
+	#ifdef NDEBUG
+		#define ALLOC_TRACKING_ASSERT_NO_ALLOC 0
+	#else
+		#define ALLOC_TRACKING_ASSERT_NO_ALLOC 1
+	#endif
+#endif
+
+// Heap allocation tracking per subsystem
+//  ALLOC_TAG("meshing") sets the tag for the allocations of the current thread until the end of the scope (tags nest)
+//  global new / delete are replaced and UnsafeVector, UnsafeArray, SmallVector and BlockAllocator use alloc_tracking::malloc / free, so all of them are counted
+//  every allocation gets a 16 byte header with its size and tag, so a free on any thread is subtracted from the tag that allocated it
+//  per tag: live bytes, high water mark, allocations and bytes per frame (see end_frame), optional per frame budgets
+//  NO_ALLOC_SCOPE() marks code that must not allocate (frame hot paths), allocations in it count as violations (and assert in debug builds)
+// Overhead per allocation: two thread local reads and 3 relaxed atomic adds on the cache line of the tag (+ a cas when the high water mark rises)
+namespace alloc_tracking {
+	static constexpr int MAX_TAGS = 32;
+
+	// tag 0 is "untagged"
+	inline thread_local int current_tag = 0;
+	inline thread_local int no_alloc_depth = 0;
+
+	extern std::atomic<int64_t> no_alloc_violations;
+
+	// id of the tag with that name, registered on the first call (name has to stay valid, string literals), does not allocate
+	int get_tag (const char* name);
+	int tag_count ();
+
+	struct TagScope {
+		int prev;
+
+		TagScope (int tag): prev{current_tag} {
+			current_tag = tag;
+		}
+		~TagScope () {
+			current_tag = prev;
+		}
+	};
+	struct NoAllocScope {
+		NoAllocScope () {
+			no_alloc_depth++;
+		}
+		~NoAllocScope () {
+			no_alloc_depth--;
+		}
+	};
+
+	// tracked malloc / free for containers that manage raw memory, do not mix with ::malloc / ::free
+	void* malloc (size_t size);
+	void free (void* ptr);
+	// counts as a free of the old and an allocation of the new size (under the current tag), can grow in place (or via mremap for big blocks on linux)
+	void* realloc (void* ptr, size_t size);
+
+	struct TagStats {
+		const char*	name;
+		int64_t		live_bytes;
+		int64_t		high_water; // max of live_bytes
+		int64_t		total_allocs;
+		int64_t		frame_allocs; // allocations during the last completed frame
+		int64_t		frame_bytes; // bytes allocated during the last completed frame
+		int64_t		over_budget_frames;
+	};
+	TagStats get_stats (int tag);
+
+	// max allocations / bytes per frame for the tag, -1 for no limit, end_frame prints a warning when a tag goes over
+	void set_frame_budget (int tag, int64_t max_allocs, int64_t max_bytes);
+
+	// call once per frame from one thread, computes the per frame stats, checks the budgets and updates the counters (see counters.hpp) of each tag
+	void end_frame ();
+}
+
+#if ALLOC_TRACKING_ENABLE
+	#define _ALLOC_CONCAT2(a, b) a##b
+	#define _ALLOC_CONCAT(a, b) _ALLOC_CONCAT2(a, b)
+
+	#define ALLOC_TAG(name) \
+		static int _ALLOC_CONCAT(_alloc_tag_, __LINE__) = alloc_tracking::get_tag(name); \
+		alloc_tracking::TagScope _ALLOC_CONCAT(_alloc_tag_scope_, __LINE__) (_ALLOC_CONCAT(_alloc_tag_, __LINE__))
+	#define NO_ALLOC_SCOPE() alloc_tracking::NoAllocScope _ALLOC_CONCAT(_no_alloc_scope_, __LINE__)
+#else
+	#define ALLOC_TAG(name)
+	#define NO_ALLOC_SCOPE()
+#endif
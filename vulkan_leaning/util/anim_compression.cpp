@@ -0,0 +1,231 @@
+#include "anim_compression.hpp"
+#include <algorithm>
+
+#if ROTATION_MODE==2
+
+static constexpr float SQRT2 = 1.41421356f;
+
+//// decoding
+
+quat CompressedClip::decode_rot (RotKey const& k) {
+	int largest = (k.a >> 15) | (k.b >> 15) << 1;
+
+	// the other components are in [-1/sqrt2, 1/sqrt2]
+	float a = ((float)(k.a & 0x7fff) * (2.0f / 32767.0f) - 1.0f) * (1.0f / SQRT2);
+	float b = ((float)(k.b & 0x7fff) * (2.0f / 32767.0f) - 1.0f) * (1.0f / SQRT2);
+	float c = ((float)(k.c & 0x7fff) * (2.0f / 32767.0f) - 1.0f) * (1.0f / SQRT2);
+	float l = std::sqrt(std::max(1.0f - (a*a + b*b + c*c), 0.0f));
+
+	switch (largest) {
+		case 0:		return quat(l, a, b, c);
+		case 1:		return quat(a, l, b, c);
+		case 2:		return quat(a, b, l, c);
+		default:	return quat(a, b, c, l);
+	}
+}
+
+// move seg so that it contains t, only decoding the keys that are not decoded yet, returns the interpolation factor in the segment
+template <typename KEY, typename VAL, typename DECODE>
+static float update_segment (DecodedSegment<VAL>& seg, std::vector<KEY> const& keys, CompressedClip const& clip,
+		uint16_t CompressedClip::Block::* block_key, float t, DECODE decode) {
+	int count = (int)keys.size();
+	if (count == 1) {
+		if (seg.left != 0) {
+			seg.left = 0;
+			seg.t0 = seg.t1 = 0;
+			seg.v0 = seg.v1 = decode(keys[0]);
+		}
+		return 0;
+	}
+
+	auto key_t = [&] (int i) { return clip.decode_time(keys[i].t); };
+	// the segment of key i contains t (the last one wraps around to the first key)
+	auto contains = [&] (int i) {
+		if (i == count - 1)
+			return key_t(i) <= t || t < key_t(0);
+		return key_t(i) <= t && t < key_t(i + 1);
+	};
+
+	if (seg.left < 0 || !contains(seg.left)) {
+		int i;
+		if (seg.left >= 0 && seg.left + 1 < count && contains(seg.left + 1)) {
+			// playback moved into the next segment, its left key is the old right key
+			i = seg.left + 1;
+			seg.v0 = seg.v1;
+		} else {
+			// seek: start at the key of the block and go forward
+			int b = std::min(std::max((int)(t / clip.block_duration), 0), (int)clip.blocks.size() - 1);
+			i = clip.blocks[b].*block_key;
+			while (i > 0 && key_t(i) > t) // only if the block start got rounded past t
+				i--;
+			if (key_t(i) > t) {
+				i = count - 1; // before the first key
+			} else {
+				while (i + 1 < count && key_t(i + 1) <= t)
+					i++;
+			}
+			seg.v0 = decode(keys[i]);
+		}
+
+		int r = i + 1;
+		seg.left = i;
+		seg.t0 = key_t(i);
+		if (r == count) {
+			if (clip.loop_interp) {
+				r = 0;
+				seg.t1 = key_t(0) + clip.duration;
+			} else {
+				r = i;
+				seg.t1 = seg.t0;
+			}
+		} else {
+			seg.t1 = key_t(r);
+		}
+		seg.v1 = decode(keys[r]);
+	}
+
+	float local_t = t;
+	if (seg.left == count - 1 && t < seg.t0)
+		local_t += clip.duration; // wrapped around
+	return seg.t1 > seg.t0 ? (local_t - seg.t0) / (seg.t1 - seg.t0) : 0;
+}
+
+AnimPosRot ClipDecoder::sample (CompressedClip const& clip, float t) {
+	float pos_t = update_segment(pos, clip.pos_keys, clip, &CompressedClip::Block::pos_key, t,
+		[&] (CompressedClip::PosKey const& k) { return clip.decode_pos(k); });
+	float rot_t = update_segment(rot, clip.rot_keys, clip, &CompressedClip::Block::rot_key, t,
+		[] (CompressedClip::RotKey const& k) { return CompressedClip::decode_rot(k); });
+
+	float3 p = float3(pos.v0.x + (pos.v1.x - pos.v0.x) * pos_t, pos.v0.y + (pos.v1.y - pos.v0.y) * pos_t, pos.v0.z + (pos.v1.z - pos.v0.z) * pos_t);
+	return { p, { nlerp_inline(rot.v0, rot.v1, rot_t) } };
+}
+
+//// compression
+
+// indices of the keys to keep, error(a, b, k) is the error at key k when interpolating between the keys a and b
+//  greedy: every segment is extended as long as all keys it skips stay within max_error, the first and last key are always kept
+template <typename ERROR>
+static std::vector<int> reduce_keys (int count, ERROR error, float max_error) {
+	std::vector<int> keep = { 0 };
+	int a = 0;
+	while (a < count - 1) {
+		int b = a + 1;
+		while (b + 1 < count) {
+			bool ok = true;
+			for (int k=a+1; k<=b && ok; ++k)
+				ok = error(a, b + 1, k) <= max_error;
+			if (!ok)
+				break;
+			b++;
+		}
+		keep.push_back(b);
+		a = b;
+	}
+	return keep;
+}
+
+static float angle_between (quat a, quat b) {
+	return 2.0f * std::acos(std::min(std::abs(dot(a, b)), 1.0f));
+}
+
+static uint16_t quantize_unorm16 (float val) {
+	return (uint16_t)std::round(std::min(std::max(val, 0.0f), 1.0f) * 65535.0f);
+}
+
+static CompressedClip::RotKey quantize_rot (uint16_t t, quat q) {
+	q = normalize(q);
+
+	int largest = 0;
+	for (int i=1; i<4; ++i) {
+		if (std::abs(q.arr[i]) > std::abs(q.arr[largest]))
+			largest = i;
+	}
+	if (q.arr[largest] < 0)
+		q = -q; // q and -q are the same rotation, so the dropped component is always positive
+
+	uint16_t comp[3];
+	int j = 0;
+	for (int i=0; i<4; ++i) {
+		if (i != largest) {
+			float v = std::min(std::max(q.arr[i] * SQRT2 * 0.5f + 0.5f, 0.0f), 1.0f);
+			comp[j++] = (uint16_t)std::round(v * 32767.0f);
+		}
+	}
+	return { t, (uint16_t)(comp[0] | (largest & 1) << 15), (uint16_t)(comp[1] | (largest >> 1) << 15), comp[2] };
+}
+
+CompressedClip compress_clip (AnimClip const& clip, ClipCompressionSettings const& settings) {
+	int count = clip.keyframe_count();
+	assert(count >= 1 && count <= 65536);
+
+	CompressedClip c;
+	c.duration = clip.duration;
+	c.loop_interp = clip.loop_interp;
+
+	auto& times = clip.times;
+	auto& positions = clip.positions;
+	auto& rotations = clip.rotations;
+
+	auto inter_t = [&] (int a, int b, int k) {
+		return (times[k] - times[a]) / (times[b] - times[a]);
+	};
+	auto quantize_time = [&] (int i) {
+		return quantize_unorm16(times[i] / clip.duration);
+	};
+
+	//// positions
+	float3 lo = positions[0], hi = positions[0];
+	for (auto& p : positions) {
+		lo = min(lo, p);
+		hi = max(hi, p);
+	}
+	c.pos_min = lo;
+	c.pos_scale = (hi - lo) / 65535.0f;
+
+	auto pos_keys = reduce_keys(count, [&] (int a, int b, int k) {
+		return length(lerp(positions[a], positions[b], inter_t(a, b, k)) - positions[k]);
+	}, settings.pos_error);
+
+	for (int i : pos_keys) {
+		uint16_t t = quantize_time(i);
+		if (!c.pos_keys.empty() && c.pos_keys.back().t == t)
+			continue; // keys closer than the time resolution
+
+		float3 p = (positions[i] - lo) / max(hi - lo, float3(1e-30f));
+		c.pos_keys.push_back({ t, quantize_unorm16(p.x), quantize_unorm16(p.y), quantize_unorm16(p.z) });
+	}
+
+	//// rotations
+	auto rot_keys = reduce_keys(count, [&] (int a, int b, int k) {
+		return angle_between(nlerp(rotations[a].q, rotations[b].q, inter_t(a, b, k)), rotations[k].q);
+	}, settings.rot_error);
+
+	for (int i : rot_keys) {
+		uint16_t t = quantize_time(i);
+		if (!c.rot_keys.empty() && c.rot_keys.back().t == t)
+			continue;
+
+		c.rot_keys.push_back(quantize_rot(t, rotations[i].q));
+	}
+
+	//// seek table
+	int block_count = std::max((int)std::ceil(clip.duration / settings.block_duration), 1);
+	c.block_duration = clip.duration / (float)block_count;
+
+	auto block_key = [&] (auto const& keys, float block_t) {
+		int k = 0;
+		for (int i=0; i<(int)keys.size(); ++i) {
+			if (c.decode_time(keys[i].t) <= block_t)
+				k = i;
+		}
+		return (uint16_t)k;
+	};
+	for (int b=0; b<block_count; ++b) {
+		float block_t = (float)b * c.block_duration;
+		c.blocks.push_back({ block_key(c.pos_keys, block_t), block_key(c.rot_keys, block_t) });
+	}
+
+	return c;
+}
+
+#endif
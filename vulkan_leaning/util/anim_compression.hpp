@@ -0,0 +1,80 @@
+#pragma once
+#include "animation.hpp"
+#include "stdint.h"
+
+// CompressedClip stores and decodes quaternion rotations, so it only exists with ROTATION_MODE 2
+#if ROTATION_MODE==2
+
+// Compressed position + rotation clip (made offline by compress_clip)
+//  positions are 16 bit per component in the bounding box of the position track
+//  rotations are smallest-three: the largest quaternion component is dropped (it follows from the normalization), the others get 15 bits each
+//  key times are 16 bit fractions of the duration
+//  keys that linear interpolation of their neighbours reproduces within the error threshold are removed per track, so position and rotation have their own keys
+//  the block table holds the left key of each track at fixed time steps, so seeking is O(1) and from there decoding goes forward through the keys
+struct CompressedClip {
+	struct PosKey {
+		uint16_t	t;
+		uint16_t	x, y, z;
+	};
+	struct RotKey {
+		uint16_t	t;
+		uint16_t	a, b, c; // the three other components in xyzw order, 15 bits each, the top bits of a and b are the index of the dropped component
+	};
+	struct Block {
+		uint16_t	pos_key; // last key with time <= the start time of the block, 0 if there is none
+		uint16_t	rot_key;
+	};
+
+	float	duration = 1;
+	bool	loop_interp = true;
+
+	float3	pos_min;
+	float3	pos_scale; // pos = pos_min + key * pos_scale
+
+	float	block_duration; // duration / blocks.size()
+
+	std::vector<PosKey>	pos_keys;
+	std::vector<RotKey>	rot_keys;
+	std::vector<Block>	blocks;
+
+	float decode_time (uint16_t t) const {
+		return (float)t * (duration / 65535.0f);
+	}
+	float3 decode_pos (PosKey const& k) const {
+		return float3(pos_min.x + (float)k.x * pos_scale.x, pos_min.y + (float)k.y * pos_scale.y, pos_min.z + (float)k.z * pos_scale.z);
+	}
+	static quat decode_rot (RotKey const& k);
+
+	// memory used by the clip including the vectors
+	size_t size_bytes () const {
+		return sizeof(CompressedClip) + pos_keys.size() * sizeof(PosKey) + rot_keys.size() * sizeof(RotKey) + blocks.size() * sizeof(Block);
+	}
+};
+
+struct ClipCompressionSettings {
+	float	pos_error = 0.001f; // max position error of the removed keys (in the units of the clip)
+	float	rot_error = 0.001f; // max rotation error of the removed keys in radians
+	float	block_duration = 0.25f; // time step of the seek table (is rounded to divide the duration)
+};
+
+CompressedClip compress_clip (AnimClip const& clip, ClipCompressionSettings const& settings=ClipCompressionSettings());
+
+// The decoded segment of one track: the keys left and right of the last sampled time
+template <typename VAL>
+struct DecodedSegment {
+	int		left = -1; // key index, -1 if nothing decoded yet
+	float	t0, t1; // t1 is past the duration if the segment wraps around
+	VAL		v0, v1;
+};
+
+// Playback state of one instance of a CompressedClip
+//  moving forward through the clip only decodes the keys that get passed, jumps seek via the block table
+//  reset it (decoder = {}) when switching to a different clip
+struct ClipDecoder {
+	DecodedSegment<float3>	pos;
+	DecodedSegment<quat>	rot;
+
+	AnimPosRot sample (CompressedClip const& clip, float t);
+};
+
+#endif
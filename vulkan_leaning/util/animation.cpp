@@ -0,0 +1,123 @@
+#include "animation.hpp"
+#include "wide_math.hpp"
+#include <algorithm>
+
+// instances per chunk when splitting sample_all over a threadpool
+static constexpr size_t SAMPLE_MIN_CHUNK = 1024;
+
+#if ROTATION_MODE==2
+// kernels always use the widest native lane type, independent of WIDE_WIDTH
+typedef WideLanes<SIMD_MAX_WIDTH>::float_t	F;
+typedef float3_wide<F>						V;
+static constexpr int W = F::WIDTH;
+
+// one tile of keyframe pairs to interpolate in soa, gathered per lane
+//  unused lanes interpolate identity
+struct InterpLanes {
+	alignas(32) float ax[W], ay[W], az[W], aw[W];
+	alignas(32) float bx[W], by[W], bz[W], bw[W];
+	alignas(32) float t[W];
+
+	void set (int lane, quat a, quat b, float inter_t) {
+		ax[lane] = a.x;	ay[lane] = a.y;	az[lane] = a.z;	aw[lane] = a.w;
+		bx[lane] = b.x;	by[lane] = b.y;	bz[lane] = b.z;	bw[lane] = b.w;
+		t[lane] = inter_t;
+	}
+	void set_identity (int lane) {
+		set(lane, quat::identity(), quat::identity(), 0);
+	}
+};
+
+struct QuatW {
+	F x, y, z, w;
+};
+
+// nlerp along the shortest path, not normalized yet
+static SIMD_INLINE QuatW nlerp_unnormalized (InterpLanes const& l) {
+	F ax = F::load(l.ax), ay = F::load(l.ay), az = F::load(l.az), aw = F::load(l.aw);
+	F bx = F::load(l.bx), by = F::load(l.by), bz = F::load(l.bz), bw = F::load(l.bw);
+	F tb = F::load(l.t);
+	F ta = F(1.0f) - tb;
+	F d = ax * bx + ay * by + az * bz + aw * bw;
+	tb = select(d < F(0.0f), -tb, tb);
+
+	return { ax * ta + bx * tb, ay * ta + by * tb, az * ta + bz * tb, aw * ta + bw * tb };
+}
+
+// rotation matrix columns of a not normalized quaternion
+static SIMD_INLINE void to_matrix (QuatW q, V* c0, V* c1, V* c2) {
+	// fold the normalization into the factor 2 of the conversion: x2 = x * 2/len^2 etc.
+	F s = F(2.0f) / (q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w);
+	F x2 = q.x * s, y2 = q.y * s, z2 = q.z * s;
+	F xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+	F xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+	F wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+	*c0 = { F(1.0f) - (yy + zz), xy + wz, xz - wy };
+	*c1 = { xy - wz, F(1.0f) - (xx + zz), yz + wx };
+	*c2 = { xz + wy, yz - wx, F(1.0f) - (xx + yy) };
+}
+
+void sample_rotations (RotationTrack const* tracks, float const* t, float3x3* out, size_t n) {
+	for (size_t i=0; i<n; i += W) {
+		int lanes = (int)std::min(n - i, (size_t)W);
+
+		InterpLanes l;
+		for (int j=0; j<W; ++j) {
+			if (j < lanes) {
+				auto& track = tracks[i + j];
+				int left_i, right_i;
+				float inter_t;
+				track.find_keyframes(t[i + j], &left_i, &right_i, &inter_t);
+				l.set(j, track.keyframes[left_i].val.q, track.keyframes[right_i].val.q, inter_t);
+			} else {
+				l.set_identity(j);
+			}
+		}
+
+		V c0, c1, c2;
+		to_matrix(nlerp_unnormalized(l), &c0, &c1, &c2);
+
+		float3 col[3][W];
+		c0.store(col[0]);
+		c1.store(col[1]);
+		c2.store(col[2]);
+		for (int j=0; j<lanes; ++j) {
+			out[i + j].arr[0] = col[0][j];
+			out[i + j].arr[1] = col[1][j];
+			out[i + j].arr[2] = col[2][j];
+		}
+	}
+}
+#else
+void sample_rotations (RotationTrack const* tracks, float const* t, float3x3* out, size_t n) {
+	for (size_t i=0; i<n; ++i)
+		out[i] = (float3x3)tracks[i].calc(t[i]);
+}
+#endif
+
+static inline AnimRotation lerp_rotation (AnimRotation const& l, AnimRotation const& r, float t) {
+#if ROTATION_MODE==2
+	return { nlerp_inline(l.q, r.q, t) };
+#else
+	return AnimRotation::lerp(l, r, t);
+#endif
+}
+
+// the interpolation is scalar here, unlike sample_rotations there is no matrix conversion to vectorize
+//  and gathering into simd lanes and scattering back to AoS cost as much as the nlerp itself
+void sample_all (AnimClip const* const* clips, float const* times, AnimCursor* cursors, AnimPosRot* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [=] (size_t begin, size_t end) {
+		for (size_t i=begin; i<end; ++i) {
+			AnimClip const& clip = *clips[i];
+			int l, r;
+			float t;
+			clip.find_keyframes(times[i], &l, &r, &t, cursors ? &cursors[i] : nullptr);
+
+			float3 a = clip.positions[l], b = clip.positions[r];
+			out[i].pos = float3(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t);
+			out[i].rot = lerp_rotation(clip.rotations[l], clip.rotations[r], t);
+		}
+	};
+	run_batch(kernel, n, SAMPLE_MIN_CHUNK, pool);
+}
@@ -1,12 +1,85 @@
 #pragma once
 #include "../kissmath.hpp"
+#include "parallel_batch.hpp"
+#include "assert.h"
 #include <vector>
+#include <cmath>
 
 enum AnimInterpMode {
 	AIM_NONE,
 	AIM_LINEAR,
 };
 
+// Cached keyframe segment of one playing instance
+//  playback moves t forward a little each frame, so the segment is usually the same or the next one -> O(1) instead of a search
+struct AnimCursor {
+	int key = -1; // left keyframe of the last sample, -1 if none
+};
+
+// Find the keyframes to interpolate between at time t and the interpolation factor between them
+//  key_time(i) is the time of keyframe i, keyframes need to be sorted by time
+//  before the first keyframe it wraps around to the last one (if loop_interp), past the last one it wraps to the first one
+//  cursor is optional, it is tried first and updated, otherwise (or if t jumped) binary search is used
+template <typename KEY_T>
+inline void find_keyframes (KEY_T key_time, int count, float duration, bool loop_interp, float t, AnimCursor* cursor,
+		int* left_i, int* right_i, float* inter_t) {
+	assert(count >= 1);
+	if (count == 1) {
+		*left_i = 0;
+		*right_i = 0;
+		*inter_t = 0;
+		return;
+	}
+
+	// l is the last keyframe with key_time(l) <= t, or the last keyframe if there is none (wrap around)
+	int l = -1;
+
+	if (cursor && cursor->key >= 0 && cursor->key < count) {
+		for (int c = cursor->key; c < count && c <= cursor->key + 1; ++c) {
+			if (key_time(c) <= t && (c+1 == count || t < key_time(c+1))) {
+				l = c;
+				break;
+			}
+		}
+	}
+
+	if (l < 0) {
+		// first keyframe with key_time > t
+		int lo = 0, hi = count;
+		while (lo < hi) {
+			int mid = (lo + hi) / 2;
+			if (key_time(mid) <= t)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		l = lo == 0 ? count - 1 : lo - 1;
+	}
+
+	if (cursor)
+		cursor->key = l;
+
+	int r = l + 1;
+
+	bool wrapped = false;
+	if (r == count) {
+		if (loop_interp) {
+			r = 0;
+			wrapped = true;
+		} else {
+			r = l;
+		}
+	}
+
+	float right_t = key_time(r);
+	if (wrapped)
+		right_t += duration; // right is wrapped
+
+	*left_i = l;
+	*right_i = r;
+	*inter_t = r == l ? 0 : map(t, key_time(l), right_t);
+}
+
 template <typename VAL_T, AnimInterpMode AIM>
 struct Animation {
 	struct Keyframe {
@@ -14,7 +87,7 @@ struct Animation {
 		VAL_T val;
 	};
 
-	std::vector<Keyframe> keyframes;
+	std::vector<Keyframe> keyframes; // sorted by t
 	float duration = 1;
 	bool loop_interp = true;
 
@@ -22,53 +95,47 @@ struct Animation {
 		assert(this->keyframes.size() >= 1);
 	}
 
-	VAL_T calc (float t) {
-		int count = (int)keyframes.size();
-		
-		assert(count >= 1);
-		if (count == 1) {
-			return keyframes[0].val;
-		}
-
-		int left_i = count - 1; // if no keyframe at 0 then wrap around left to the rightmost keyframe
-
-		for (int i=0; i<count; ++i) {
-			if (keyframes[i].t <= t) {
-				left_i = i;
-			}
-		}
-
-		int right_i = left_i + 1;
+	// keyframes to interpolate between at time t and the interpolation factor between them
+	void find_keyframes (float t, int* left_i, int* right_i, float* inter_t, AnimCursor* cursor=nullptr) const {
+		::find_keyframes([this] (int i) { return keyframes[i].t; }, (int)keyframes.size(), duration, loop_interp, t, cursor,
+			left_i, right_i, inter_t);
+	}
 
-		bool wrapped = false;
-		if (right_i == count) {
-			if (loop_interp) {
-				right_i = 0;
-				wrapped = true;
-			} else {
-				right_i = left_i;
-			}
-		}
+	VAL_T calc (float t, AnimCursor* cursor=nullptr) const {
+		int left_i, right_i;
+		float inter_t;
+		find_keyframes(t, &left_i, &right_i, &inter_t, cursor);
 
-		Keyframe& left  = keyframes[left_i];
-		Keyframe& right = keyframes[right_i];
-		float right_t = right.t;
-		if (wrapped)
-			right_t += duration; // right is wrapped
+		Keyframe const& left  = keyframes[left_i];
+		Keyframe const& right = keyframes[right_i];
 
 		switch (AIM) {
 			case AIM_NONE:
 				return left.val;
 
 			case AIM_LINEAR:
-				float inter_t = map(t, left.t, right_t);
 				return VAL_T::lerp(left.val, right.val, inter_t);
 		}
 		return {};
 	}
 };
 
-#define ROTATION_MODE 0
+// kissmath nlerp, but inline for the batch samplers
+//  without KISSMATH_HEADER_ONLY kissmath nlerp is an out-of-line call (passing quats by value), which costs more than the math
+inline quat nlerp_inline (quat a, quat b, float t) {
+	float tb = a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w < 0 ? -t : t; // flip b to take the shortest path
+	float ta = 1.0f - t;
+	float x = a.x*ta + b.x*tb, y = a.y*ta + b.y*tb, z = a.z*ta + b.z*tb, w = a.w*ta + b.w*tb;
+	float inv_len = 1.0f / std::sqrt(x*x + y*y + z*z + w*w);
+	return quat(x * inv_len, y * inv_len, z * inv_len, w * inv_len);
+}
+
+// 0: euler angles, lerped per component (3 rotate3_* and 2 matrix multiplies per conversion to float3x3)
+// 1: rotation matrix, lerped per cell (not orthonormal between keyframes)
+// 2: quaternion, nlerp along the shortest path and a cheap conversion to float3x3, see sample_rotations() for batches
+#ifndef ROTATION_MODE
+	#define ROTATION_MODE 2
+#endif
 
 struct AnimRotation {
 #if ROTATION_MODE==0
@@ -76,7 +143,7 @@ struct AnimRotation {
 #elif ROTATION_MODE==1
 	float3x3 matrix;
 #else
-	// implement quaternion
+	quat q;
 #endif
 
 	// z * y * x angles (like blender default)
@@ -85,6 +152,8 @@ struct AnimRotation {
 		return { float3(x,y,z) };
 	#elif ROTATION_MODE==1
 		return { rotate3_Z(z) * rotate3_Y(y) * rotate3_X(x) };
+	#else
+		return { rotateQ_euler(float3(x,y,z)) };
 	#endif
 	}
 
@@ -93,14 +162,18 @@ struct AnimRotation {
 		return { ::lerp(l.euler, r.euler, t) };
 	#elif ROTATION_MODE==1
 		return { l.matrix * (1.0f - t) + r.matrix * t };
+	#else
+		return { nlerp(l.q, r.q, t) };
 	#endif
 	}
 
-	operator float3x3 () {
+	operator float3x3 () const {
 	#if ROTATION_MODE==0
 		return rotate3_Z(euler.z) * rotate3_Y(euler.y) * rotate3_X(euler.x);
 	#elif ROTATION_MODE==1
 		return matrix;
+	#else
+		return (float3x3)q;
 	#endif
 	}
 };
@@ -116,3 +189,50 @@ struct AnimPosRot {
 		return ret;
 	}
 };
+
+typedef Animation<AnimRotation, AIM_LINEAR> RotationTrack;
+
+// Sample n rotation tracks at times t[i] into rotation matrices, out[i] = (float3x3)tracks[i].calc(t[i])
+//  the keyframe search is per track, the nlerp and quaternion to matrix conversion run on the tracks in simd lanes (ROTATION_MODE 2)
+void sample_rotations (RotationTrack const* tracks, float const* t, float3x3* out, size_t n);
+
+// Position + rotation clip with SoA keyframes (all times, then all positions, then all rotations)
+//  the keyframe search only touches the times, instead of striding over whole keyframes
+struct AnimClip {
+	std::vector<float>			times; // sorted
+	std::vector<float3>			positions;
+	std::vector<AnimRotation>	rotations;
+	float	duration = 1;
+	bool	loop_interp = true;
+
+	AnimClip () {}
+	AnimClip (Animation<AnimPosRot, AIM_LINEAR> const& anim): duration{anim.duration}, loop_interp{anim.loop_interp} {
+		for (auto& k : anim.keyframes) {
+			times.push_back(k.t);
+			positions.push_back(k.val.pos);
+			rotations.push_back(k.val.rot);
+		}
+	}
+
+	int keyframe_count () const {
+		return (int)times.size();
+	}
+
+	void find_keyframes (float t, int* left_i, int* right_i, float* inter_t, AnimCursor* cursor=nullptr) const {
+		float const* ts = times.data();
+		::find_keyframes([ts] (int i) { return ts[i]; }, keyframe_count(), duration, loop_interp, t, cursor,
+			left_i, right_i, inter_t);
+	}
+
+	AnimPosRot sample (float t, AnimCursor* cursor=nullptr) const {
+		int l, r;
+		float inter_t;
+		find_keyframes(t, &l, &r, &inter_t, cursor);
+		return { ::lerp(positions[l], positions[r], inter_t), AnimRotation::lerp(rotations[l], rotations[r], inter_t) };
+	}
+};
+
+// Sample n clip instances, out[i] = clips[i]->sample(times[i], &cursors[i])
+//  cursors is optional (binary search for every instance without)
+//  large n get split over the pool threads (see run_batch)
+void sample_all (AnimClip const* const* clips, float const* times, AnimCursor* cursors, AnimPosRot* out, size_t n, BatchThreadpool* pool=nullptr);
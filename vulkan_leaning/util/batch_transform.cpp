@@ -0,0 +1,188 @@
+#include "batch_transform.hpp"
+#include "wide_math.hpp"
+#include "../kissmath/simd_backend.hpp"
+
+// kernels always use the widest native lane type, independent of WIDE_WIDTH
+typedef WideLanes<SIMD_MAX_WIDTH>::float_t	F;
+typedef float3_wide<F>						V;
+static constexpr int W = F::WIDTH;
+
+// below this amount of memory traffic per chunk the wakeup of the pool threads costs more than it saves
+static constexpr size_t PARALLEL_MIN_BYTES = 256 * 1024;
+
+// run_batch() with a minimum chunk size by memory traffic and whole tiles per chunk
+template <typename KERNEL>
+static void run_kernel (KERNEL const& kernel, size_t n, size_t bytes_per_elem, BatchThreadpool* pool) {
+	run_batch(kernel, n, PARALLEL_MIN_BYTES / bytes_per_elem, pool, W);
+}
+
+//// points
+
+void transform_points (float3x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [&] (size_t begin, size_t end) {
+		size_t i = begin;
+		for (; i + W <= end; i += W)
+			transform_point(m, V::load(&in[i])).store(&out[i]);
+		if (i < end)
+			transform_point(m, V::load_n(&in[i], (int)(end - i))).store_n(&out[i], (int)(end - i));
+	};
+	run_kernel(kernel, n, sizeof(float3) * 2, pool);
+}
+
+void transform_directions (float3x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [&] (size_t begin, size_t end) {
+		size_t i = begin;
+		for (; i + W <= end; i += W)
+			transform_direction(m, V::load(&in[i])).store(&out[i]);
+		if (i < end)
+			transform_direction(m, V::load_n(&in[i], (int)(end - i))).store_n(&out[i], (int)(end - i));
+	};
+	run_kernel(kernel, n, sizeof(float3) * 2, pool);
+}
+
+void transform_points (float4x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [&] (size_t begin, size_t end) {
+		size_t i = begin;
+		for (; i + W <= end; i += W)
+			transform_point(m, V::load(&in[i])).store(&out[i]);
+		if (i < end) // unused lanes are (0,0,0) -> w = m[3][3], which might be 0, but those lanes are not stored
+			transform_point(m, V::load_n(&in[i], (int)(end - i))).store_n(&out[i], (int)(end - i));
+	};
+	run_kernel(kernel, n, sizeof(float3) * 2, pool);
+}
+
+//// aabbs
+
+// lanes of two tiles of AABB.lo/hi float3  (lo0 hi0 lo1 hi1 ..) (lo2 hi2 ..)  split into the lo and hi lanes
+//  with avx the shuffles work in 128 bit halves, so the AABBs end up in a permuted lane order,
+//  but interleave() undoes exactly that permutation, so this does not matter for per-lane math
+static SIMD_INLINE void deinterleave (simd::f32x4 a, simd::f32x4 b, simd::f32x4* even, simd::f32x4* odd) {
+#if SIMD_HAS_SSE2
+	even->v = _mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(2,0,2,0));
+	odd->v  = _mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(3,1,3,1));
+#else
+	*even = simd::f32x4(a[0], a[2], b[0], b[2]);
+	*odd  = simd::f32x4(a[1], a[3], b[1], b[3]);
+#endif
+}
+static SIMD_INLINE void interleave (simd::f32x4 even, simd::f32x4 odd, simd::f32x4* a, simd::f32x4* b) {
+#if SIMD_HAS_SSE2
+	a->v = _mm_unpacklo_ps(even.v, odd.v);
+	b->v = _mm_unpackhi_ps(even.v, odd.v);
+#else
+	*a = simd::f32x4(even[0], odd[0], even[1], odd[1]);
+	*b = simd::f32x4(even[2], odd[2], even[3], odd[3]);
+#endif
+}
+#if SIMD_HAS_AVX2
+static SIMD_INLINE void deinterleave (simd::f32x8 a, simd::f32x8 b, simd::f32x8* even, simd::f32x8* odd) {
+	even->v = _mm256_shuffle_ps(a.v, b.v, _MM_SHUFFLE(2,0,2,0));
+	odd->v  = _mm256_shuffle_ps(a.v, b.v, _MM_SHUFFLE(3,1,3,1));
+}
+static SIMD_INLINE void interleave (simd::f32x8 even, simd::f32x8 odd, simd::f32x8* a, simd::f32x8* b) {
+	a->v = _mm256_unpacklo_ps(even.v, odd.v);
+	b->v = _mm256_unpackhi_ps(even.v, odd.v);
+}
+#endif
+
+static_assert(sizeof(AABB) == 2 * sizeof(float3), "AABB array is read as a float3 array");
+
+// center and half size get transformed separately, the half size by the absolute values of the rotation/scale part
+static AABB transform_aabb (float3x4 const& m, float3x4 const& abs_m, AABB const& a) {
+	float3 c = transform_point(m, (a.lo + a.hi) * 0.5f);
+	float3 e = transform_direction(abs_m, (a.hi - a.lo) * 0.5f);
+	return { c - e, c + e };
+}
+
+void transform_aabbs (float3x4 const& m, AABB const* in, AABB* out, size_t n, BatchThreadpool* pool) {
+	float3x4 abs_m = m;
+	for (auto& c : abs_m.arr)
+		c = abs(c);
+
+	auto kernel = [&] (size_t begin, size_t end) {
+		size_t i = begin;
+		for (; i + W <= end; i += W) {
+			// W AABBs are 2*W float3
+			V a = V::load(&in[i].lo);
+			V b = V::load(&in[i + W/2].lo);
+
+			V lo, hi;
+			deinterleave(a.x, b.x, &lo.x, &hi.x);
+			deinterleave(a.y, b.y, &lo.y, &hi.y);
+			deinterleave(a.z, b.z, &lo.z, &hi.z);
+
+			V c = transform_point(m, (lo + hi) * F(0.5f));
+			V e = transform_direction(abs_m, (hi - lo) * F(0.5f));
+			lo = c - e;
+			hi = c + e;
+
+			interleave(lo.x, hi.x, &a.x, &b.x);
+			interleave(lo.y, hi.y, &a.y, &b.y);
+			interleave(lo.z, hi.z, &a.z, &b.z);
+			a.store(&out[i].lo);
+			b.store(&out[i + W/2].lo);
+		}
+		for (; i < end; ++i)
+			out[i] = transform_aabb(m, abs_m, in[i]);
+	};
+	run_kernel(kernel, n, sizeof(AABB) * 2, pool);
+}
+
+//// matrices
+// the kissmath simd kernels inlined into the loop, operator* would be one out-of-line call per matrix (without KISSMATH_HEADER_ONLY)
+
+void mul_matrices (float4x4 const* a, float4x4 const* b, float4x4* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [&] (size_t begin, size_t end) {
+		for (size_t i=begin; i<end; ++i) {
+		#if KISSMATH_SIMD
+			float4x4 l = a[i], r = b[i]; // out may alias a or b, the backend needs distinct out
+			kissmath::simd_backend::mat4_mul(&out[i].arr[0].x, &l.arr[0].x, &r.arr[0].x);
+		#else
+			out[i] = a[i] * b[i];
+		#endif
+		}
+	};
+	run_kernel(kernel, n, sizeof(float4x4) * 3, pool);
+}
+void mul_matrices (float3x4 const* a, float3x4 const* b, float3x4* out, size_t n, BatchThreadpool* pool) {
+	auto kernel = [&] (size_t begin, size_t end) {
+		for (size_t i=begin; i<end; ++i) {
+		#if KISSMATH_SIMD
+			float3x4 l = a[i], r = b[i]; // out may alias a or b
+			kissmath::simd_backend::mat34_mul(&out[i].arr[0].x, &l.arr[0].x, &r.arr[0].x);
+		#else
+			out[i] = a[i] * b[i];
+		#endif
+		}
+	};
+	run_kernel(kernel, n, sizeof(float3x4) * 3, pool);
+}
+
+void mul_matrices (float4x4 const& a, float4x4 const* b, float4x4* out, size_t n, BatchThreadpool* pool) {
+	float4x4 l = a; // a may be an element of out
+	auto kernel = [&] (size_t begin, size_t end) {
+		for (size_t i=begin; i<end; ++i) {
+		#if KISSMATH_SIMD
+			float4x4 r = b[i]; // out may alias b
+			kissmath::simd_backend::mat4_mul(&out[i].arr[0].x, &l.arr[0].x, &r.arr[0].x);
+		#else
+			out[i] = l * b[i];
+		#endif
+		}
+	};
+	run_kernel(kernel, n, sizeof(float4x4) * 2, pool);
+}
+void mul_matrices (float3x4 const& a, float3x4 const* b, float3x4* out, size_t n, BatchThreadpool* pool) {
+	float3x4 l = a;
+	auto kernel = [&] (size_t begin, size_t end) {
+		for (size_t i=begin; i<end; ++i) {
+		#if KISSMATH_SIMD
+			float3x4 r = b[i]; // out may alias b
+			kissmath::simd_backend::mat34_mul(&out[i].arr[0].x, &l.arr[0].x, &r.arr[0].x);
+		#else
+			out[i] = l * b[i];
+		#endif
+		}
+	};
+	run_kernel(kernel, n, sizeof(float3x4) * 2, pool);
+}
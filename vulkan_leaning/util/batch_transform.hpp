@@ -0,0 +1,28 @@
+#pragma once
+#include "../kissmath.hpp"
+#include "collision.hpp"
+#include "parallel_batch.hpp"
+
+// Bulk transform kernels for skinning and instance transform prep
+//  one call for n values instead of one out-of-line kissmath call per value, the loops are simd (see wide_math.hpp)
+//  in and out may be the same array (in place), but must not partially overlap
+//
+// Every kernel optionally takes a BatchThreadpool, if n is large enough the range gets split into chunks
+//  that are processed by the pool threads and the calling thread, the call returns once all chunks are done
+
+// out[i] = m * float4(in[i], 1)
+void transform_points (float3x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool=nullptr);
+// out[i] = m * float4(in[i], 0)
+void transform_directions (float3x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool=nullptr);
+// out[i] = m * float4(in[i], 1) with perspective divide
+void transform_points (float4x4 const& m, float3 const* in, float3* out, size_t n, BatchThreadpool* pool=nullptr);
+
+// out[i] = smallest AABB containing the box in[i] transformed by m
+void transform_aabbs (float3x4 const& m, AABB const* in, AABB* out, size_t n, BatchThreadpool* pool=nullptr);
+
+// out[i] = a[i] * b[i]
+void mul_matrices (float4x4 const* a, float4x4 const* b, float4x4* out, size_t n, BatchThreadpool* pool=nullptr);
+void mul_matrices (float3x4 const* a, float3x4 const* b, float3x4* out, size_t n, BatchThreadpool* pool=nullptr);
+// out[i] = a * b[i]  (eg. parent * instance or view_proj * model)
+void mul_matrices (float4x4 const& a, float4x4 const* b, float4x4* out, size_t n, BatchThreadpool* pool=nullptr);
+void mul_matrices (float3x4 const& a, float3x4 const* b, float3x4* out, size_t n, BatchThreadpool* pool=nullptr);
@@ -0,0 +1,33 @@
+#include "benchmarks.hpp"
+#include <stdio.h>
+#include <string.h>
+
+struct Benchmark {
+	const char*	name;
+	const char*	desc;
+	int			(*run) (int argc, char** argv);
+};
+
+static const Benchmark benchmarks[] = {
+	{ "kissmath_simd",	"kissmath matrix and vector ops in Mop/s (rebuild with KISSMATH_NO_SIMD for the scalar numbers)", bench_kissmath_simd },
+	{ "wide_math",		"scalar float3/float4 loops vs float3_w/float4_w at 4, 8 and 16 lanes over 1M vectors", bench_wide_math },
+	{ "virtual_vector",	"<virtual|virtual_thp|unsafe|std> [extra]  push_back 1GB (+extra) of uint64, time, worst stall and peak memory, one vector type per run", bench_virtual_vector },
+	{ "small_vector",	"push_back into short lists with std::vector, UnsafeVector and SmallVector, ns per push and allocations per list", bench_small_vector },
+	{ "slot_map",		"SlotMap vs unordered_map iterate, lookup and erase+insert at 1K, 100K and 1M elements", bench_slot_map },
+	{ "flat_hash_map",	"[max n]  FlatHashMap vs unordered_map insert, hit and miss for int3 and string keys, from 1K up to max n (1M)", bench_flat_hash_map },
+};
+
+int run_benchmark (int argc, char** argv) {
+	const char* name = argc > 0 ? argv[0] : nullptr;
+	for (auto& b : benchmarks) {
+		if (name && strcmp(name, b.name) == 0)
+			return b.run(argc - 1, argv + 1);
+	}
+
+	if (name)
+		fprintf(stderr, "unknown benchmark %s\n", name);
+	fprintf(stderr, "usage: vulkan_leaning --bench <name> [args]\n");
+	for (auto& b : benchmarks)
+		fprintf(stderr, "  %-16s %s\n", b.name, b.desc);
+	return 1;
+}
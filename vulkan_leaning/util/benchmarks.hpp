@@ -0,0 +1,14 @@
+#pragma once
+
+// Micro benchmarks for the math and container code, built into the exe so they run with the same compiler flags as the game
+//  started with  vulkan_leaning --bench <name> [args],  without a name lists them
+//  results go to stdout, a benchmark returns non-zero if one of its correctness checks failed (or its args were wrong)
+//  argv[0] is the benchmark name, a benchmark gets the args after it
+int run_benchmark (int argc, char** argv);
+
+int bench_kissmath_simd (int argc, char** argv);
+int bench_wide_math (int argc, char** argv);
+int bench_virtual_vector (int argc, char** argv);
+int bench_small_vector (int argc, char** argv);
+int bench_slot_map (int argc, char** argv);
+int bench_flat_hash_map (int argc, char** argv);
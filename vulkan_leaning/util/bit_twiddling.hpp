@@ -18,3 +18,62 @@ inline uint64_t upper_power_of_two (uint64_t v) {
 	v++;
 	return v;
 }
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+// index of lowest set bit, v must not be 0
+inline int count_trailing_zeros (uint32_t v) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanForward(&idx, v);
+	return (int)idx;
+#else
+	return __builtin_ctz(v);
+#endif
+}
+inline int count_trailing_zeros (uint64_t v) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanForward64(&idx, v);
+	return (int)idx;
+#else
+	return __builtin_ctzll(v);
+#endif
+}
+
+// index of highest set bit, v must not be 0
+inline int highest_bit_index (uint32_t v) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanReverse(&idx, v);
+	return (int)idx;
+#else
+	return 31 - __builtin_clz(v);
+#endif
+}
+inline int highest_bit_index (uint64_t v) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanReverse64(&idx, v);
+	return (int)idx;
+#else
+	return 63 - __builtin_clzll(v);
+#endif
+}
+
+inline int popcount (uint32_t v) {
+#if defined(_MSC_VER)
+	return (int)__popcnt(v);
+#else
+	return __builtin_popcount(v);
+#endif
+}
+inline int popcount (uint64_t v) {
+#if defined(_MSC_VER)
+	return (int)__popcnt64(v);
+#else
+	return __builtin_popcountll(v);
+#endif
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "stdlib.h"
-#include "optick.h"
+#include "profiler.hpp"
+#include "alloc_tracking.hpp"
 
 // Custom memory allocator that allocates in fixed blocks using a freelist
 // used to avoid malloc and free overhead
@@ -19,10 +20,11 @@ public:
 	// allocate a T (not threadsafe)
 	T* alloc () {
 		if (!freelist) {
-			OPTICK_EVENT();
+			PROFILE_FUNCTION();
 
 			// allocate new blocks as needed
-			freelist = (Block*)malloc(sizeof(Block));
+			freelist = (Block*)alloc_tracking::malloc(sizeof(Block));
+			PROFILE_ALLOC("BlockAllocator", freelist, sizeof(Block));
 			freelist->next = nullptr;
 		}
 
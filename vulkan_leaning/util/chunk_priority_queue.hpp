@@ -0,0 +1,72 @@
+#pragma once
+#include "voxel_occupancy.hpp"
+#include <vector>
+#include <algorithm>
+
+// Min heap of chunks by distance to a moving point (the camera), to schedule chunk work closest first
+//  moving the point does not touch the heap: the key of an entry is its distance when it was last evaluated plus how far the point had travelled by then
+//   the point can not have gotten closer to a chunk by more than it travelled since, so key - travelled is a lower bound of the current distance
+//  pop() re-evaluates the top and only takes it if its current distance is not above the lower bound of the next entry, otherwise it gets its new key and sinks
+//  -> exact closest first order for O(log n) per pop (plus a re-evaluation for entries whose key got too optimistic) instead of re-sorting everything every frame
+//  duplicates are allowed, the user has to skip entries that are not needed anymore when they get popped
+class ChunkPriorityQueue {
+	struct Entry {
+		double		key;
+		chunk_coord	coord;
+	};
+
+	std::vector<Entry>	heap;
+	float3				point = 0;
+	double				travelled = 0;
+
+	// std heap functions make max heaps
+	static bool later (Entry const& l, Entry const& r) {
+		return l.key > r.key;
+	}
+
+	double dist (chunk_coord coord) const {
+		float3 center = ((float3)coord + 0.5f) * (float)CHUNK_SIZE;
+		return (double)length(center - point);
+	}
+
+public:
+	void set_point (float3 p) {
+		travelled += (double)length(p - point);
+		point = p;
+	}
+
+	size_t size () const {
+		return heap.size();
+	}
+	bool empty () const {
+		return heap.empty();
+	}
+	void clear () {
+		heap.clear();
+	}
+
+	void push (chunk_coord coord) {
+		heap.push_back({ dist(coord) + travelled, coord });
+		std::push_heap(heap.begin(), heap.end(), later);
+	}
+
+	// pop the chunk closest to the current point
+	bool pop (chunk_coord* coord) {
+		while (!heap.empty()) {
+			std::pop_heap(heap.begin(), heap.end(), later);
+			Entry& e = heap.back();
+
+			double d = dist(e.coord);
+			if (heap.size() == 1 || d + travelled <= heap.front().key) {
+				*coord = e.coord;
+				heap.pop_back();
+				return true;
+			}
+
+			// got further away than the next entry might be, sink it with the current distance
+			e.key = d + travelled;
+			std::push_heap(heap.begin(), heap.end(), later);
+		}
+		return false;
+	}
+};
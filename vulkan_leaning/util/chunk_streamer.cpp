@@ -0,0 +1,241 @@
+#include "chunk_streamer.hpp"
+#include "timer.hpp"
+#include "alloc_tracking.hpp"
+#include <vector>
+
+ChunkStreamResult ChunkStreamJob::execute () {
+	ALLOC_TAG("terrain");
+
+	ChunkStreamResult res;
+	res.type = type;
+	res.coord = coord;
+	res.ticket = ticket;
+	res.dropped = false;
+	res.time = 0;
+
+	if (!tickets->is_current(coord, ticket)) {
+		res.dropped = true;
+		return res;
+	}
+
+	auto timer = kiss::Timer::start();
+
+	if (type == CSJ_GENERATE) {
+		res.chunk = generator->generate(coord);
+	} else {
+		auto ids = std::make_unique<block_id[]>(CHUNK_VOXELS);
+		for (int i=0; i<CHUNK_VOXELS; ++i)
+			ids[i] = blocks.get(i);
+
+		res.chunk = std::make_unique<Chunk>(coord);
+		res.chunk->set_blocks(ids.get());
+		res.chunk->modified = true; // still differs from what the generator would give
+	}
+
+	res.time = timer.end();
+	return res;
+}
+
+void ChunkStreamer::update (VoxelWorld& world, float3 camera_pos) {
+	ALLOC_TAG("chunk streaming");
+
+	queue.set_point(camera_pos);
+
+	chunk_coord cam = get_chunk_coord(floori(camera_pos));
+	if (first_update || !equal(cam, camera_chunk)) {
+		camera_chunk = cam;
+		first_update = false;
+		update_wanted(world);
+	}
+
+	hold_edits(world);
+	collect_results(world);
+
+	chunk_coord coord;
+	while (jobs_in_flight < max_in_flight && queue.pop(&coord)) {
+		Entry* entry = entries.find(coord);
+		if (!entry || entry->stage != CS_QUEUED)
+			continue; // unloaded since it was pushed, or a duplicate
+
+		Entry& e = *entry;
+		e.stage = CS_IN_FLIGHT;
+		e.ticket = next_ticket++;
+		if (next_ticket == 0) next_ticket = 1; // 0 means no job
+		tickets.slot(coord).store(e.ticket, std::memory_order_relaxed);
+
+		ChunkStreamJob job;
+		job.coord = coord;
+		job.ticket = e.ticket;
+		job.tickets = &tickets;
+		job.generator = &generator;
+
+		ChunkBlocks* s = stored.find(coord);
+		if (s) {
+			job.type = CSJ_LOAD;
+			job.blocks = *s; // stays stored until the result is applied, in case the job gets dropped
+		} else {
+			job.type = CSJ_GENERATE;
+		}
+
+		pool.jobs.push(std::move(job));
+		jobs_in_flight++;
+	}
+}
+
+void ChunkStreamer::collect_results (VoxelWorld& world, bool wait) {
+	if (wait)
+		pool.contribute_work();
+
+	ChunkStreamResult res;
+	while (jobs_in_flight > 0) {
+		if (wait)
+			res = pool.results.pop();
+		else if (!pool.results.try_pop(&res))
+			break;
+
+		apply(world, res);
+	}
+}
+
+void ChunkStreamer::hold_edits (VoxelWorld& world) {
+	auto& edits = world.queued_edits;
+
+	size_t kept = 0;
+	for (size_t i=0; i<edits.size(); ++i) {
+		chunk_coord coord = get_chunk_coord(edits[i].pos);
+		Entry* e = entries.find(coord);
+		if (e && e->stage != CS_READY) {
+			held_edits[coord].push_back(edits[i]);
+			stats.edits_held++;
+		} else {
+			edits[kept++] = edits[i]; // chunk is loaded, or not streamed at all (outside the radius or layers), apply_edits handles it
+		}
+	}
+	edits.resize(kept);
+}
+
+void ChunkStreamer::update_wanted (VoxelWorld& world) {
+	int r2 = radius * radius;
+	int unload_r = radius + unload_margin;
+	int unload_r2 = unload_r * unload_r;
+
+	std::vector<chunk_coord> far;
+	entries.for_each([&] (chunk_coord const& c, Entry&) {
+		int dx = c.x - camera_chunk.x;
+		int dy = c.y - camera_chunk.y;
+		if (dx*dx + dy*dy > unload_r2)
+			far.push_back(c);
+	});
+	for (auto& c : far) {
+		unload(world, c, *entries.find(c));
+		entries.erase(c);
+	}
+
+	for (int z=min_z; z<=max_z; ++z)
+	for (int y=-radius; y<=radius; ++y)
+	for (int x=-radius; x<=radius; ++x) {
+		if (x*x + y*y > r2)
+			continue;
+
+		chunk_coord c = chunk_coord(camera_chunk.x + x, camera_chunk.y + y, z);
+		if (entries.try_emplace(c, Entry{ CS_QUEUED, 0 }).second) {
+			queue.push(c);
+			pending++;
+			stats.requested++;
+		}
+	}
+}
+
+void ChunkStreamer::unload (VoxelWorld& world, chunk_coord coord, Entry& entry) {
+	switch (entry.stage) {
+		case CS_QUEUED: {
+			stats.skipped++; // its queue entry gets skipped when popped
+			pending--;
+			store_held_edits(coord);
+		} break;
+
+		case CS_IN_FLIGHT: {
+			// job drops itself if no worker took it yet, if the slot already got reused by another coord that job stays valid
+			uint32_t t = entry.ticket;
+			tickets.slot(coord).compare_exchange_strong(t, 0, std::memory_order_relaxed);
+			pending--;
+			store_held_edits(coord);
+		} break;
+
+		case CS_READY: {
+			auto chunk = world.remove_chunk(coord);
+			if (chunk && chunk->modified) {
+				chunk->blocks.compact();
+				stored[coord] = std::move(chunk->blocks);
+			}
+			stats.unloaded++;
+		} break;
+	}
+}
+
+void ChunkStreamer::store_held_edits (chunk_coord coord) {
+	std::vector<BlockEdit>* held = held_edits.find(coord);
+	if (!held)
+		return;
+
+	ChunkBlocks* blocks = stored.find(coord);
+	if (!blocks) {
+		// not modified before, start from the generated blocks
+		//  generates on the main thread, but only happens for chunks that got edited and left the radius before they finished loading
+		auto chunk = generator.generate(coord);
+		blocks = stored.try_emplace(coord, chunk ? std::move(chunk->blocks) : ChunkBlocks()).first;
+	}
+
+	for (auto& edit : *held) {
+		int3 p = get_pos_in_chunk(edit.pos);
+		blocks->set(get_voxel_index(p.x, p.y, p.z), edit.id);
+	}
+	blocks->compact();
+
+	held_edits.erase(coord);
+}
+
+void ChunkStreamer::apply (VoxelWorld& world, ChunkStreamResult& res) {
+	jobs_in_flight--;
+
+	Entry* e = entries.find(res.coord);
+	bool current = e && e->stage == CS_IN_FLIGHT && e->ticket == res.ticket;
+
+	if (res.dropped) {
+		stats.dropped++;
+		if (current) {
+			// only looked stale because a newer job of another coord reused the ticket slot
+			e->stage = CS_QUEUED;
+			queue.push(res.coord);
+		}
+		return;
+	}
+
+	if (!current) {
+		stats.wasted++;
+		stats.wasted_time += res.time;
+		return;
+	}
+
+	stats.work_time += res.time;
+	if (res.type == CSJ_LOAD) {
+		stored.erase(res.coord);
+		stats.loaded++;
+	} else {
+		stats.generated++;
+	}
+
+	e->stage = CS_READY;
+	pending--;
+
+	if (res.chunk)
+		world.insert_chunk(std::move(res.chunk));
+
+	// edits made while the chunk was missing get applied with the next VoxelWorld::apply_edits()
+	std::vector<BlockEdit>* held = held_edits.find(res.coord);
+	if (held) {
+		for (auto& edit : *held)
+			world.set_block(edit.pos, edit.id);
+		held_edits.erase(res.coord);
+	}
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include "terrain_gen.hpp"
+#include "threadpool.hpp"
+#include "chunk_priority_queue.hpp"
+#include "flat_hash_map.hpp"
+#include <atomic>
+
+// Per chunk coord slot of the current job ticket, shared by the streamer and its workers
+//  a job is stale once the slot holds a different ticket (chunk was unloaded or the slot got reused by a newer job), then it drops itself before doing any work
+//  coords share slots by hash, a newer job in the slot only makes an older one look stale, the streamer then requeues it
+class ChunkTickets {
+	static constexpr size_t SLOTS = 4096; // power of two
+
+	std::unique_ptr<std::atomic<uint32_t>[]> slots;
+
+public:
+	ChunkTickets (): slots{std::make_unique<std::atomic<uint32_t>[]>(SLOTS)} {
+		for (size_t i=0; i<SLOTS; ++i)
+			slots[i].store(0, std::memory_order_relaxed);
+	}
+
+	std::atomic<uint32_t>& slot (chunk_coord coord) {
+		return slots[ChunkMap::hash(coord) & (SLOTS - 1)];
+	}
+	bool is_current (chunk_coord coord, uint32_t ticket) {
+		return slot(coord).load(std::memory_order_relaxed) == ticket;
+	}
+};
+
+enum ChunkStreamJobType {
+	CSJ_GENERATE,
+	CSJ_LOAD, // rebuild a stored (modified and then unloaded) chunk from its blocks
+};
+
+struct ChunkStreamResult {
+	ChunkStreamJobType		type;
+	chunk_coord				coord;
+	uint32_t				ticket;
+	std::unique_ptr<Chunk>	chunk; // nullptr if generated all air, loaded chunks are always kept (might have been dug out on purpose)
+	bool					dropped; // was stale when a worker took it, nothing was done
+	float					time; // seconds spent on the worker
+};
+
+struct ChunkStreamJob {
+	ChunkStreamJobType		type;
+	chunk_coord				coord;
+	uint32_t				ticket;
+	ChunkTickets*			tickets;
+	TerrainGenerator const*	generator; // for CSJ_GENERATE
+	ChunkBlocks				blocks; // for CSJ_LOAD
+
+	ChunkStreamResult execute ();
+};
+
+// Keeps the chunks around the camera loaded, in three stages:
+//  load:     chunks that were modified are kept as compacted blocks when they get unloaded, and rebuilt from those on a worker when they come back
+//  generate: all other chunks come from the TerrainGenerator on a worker
+//  mesh:     loaded chunks go into the world, which marks them dirty for the ChunkMesher (which has its own priority queue and budget)
+// Scheduling
+//  wanted chunks wait in a ChunkPriorityQueue by distance to the camera, which stays valid as the camera moves without re-sorting
+//  at most max_in_flight jobs are given to the threadpool at once, so the closest chunks at the time a thread gets free are the ones that are queued
+//   (no sorting or cancelling inside the threadsafe queue needed)
+//  chunks that leave the unload radius bump their ticket, so their jobs drop themselves when a worker takes them, results that arrive stale are thrown away
+// Edits
+//  update() has to run before VoxelWorld::apply_edits(), it takes the queued edits of chunks that are requested but not in the world yet (queued or in flight)
+//  and holds them until the chunk is put into the world, otherwise the edit would create an empty chunk that the job result then replaces
+//  if such a chunk gets unloaded before it arrives, its held edits are written into its stored blocks, so it comes back with them
+//  edits of chunks the streamer does not track (outside the radius or the min_z..max_z layers) are left to apply_edits()
+class ChunkStreamer {
+public:
+	int		radius = 8; // horizontal distance in chunks from the camera chunk within which chunks get loaded
+	int		unload_margin = 2; // chunks further than radius + unload_margin get unloaded (so moving back and forth at the border does not reload)
+	int		min_z = 0, max_z = 1; // chunk layers that get loaded
+	int		max_in_flight;
+
+	struct Stats {
+		uint64_t	requested = 0; // chunks that entered the radius
+		uint64_t	generated = 0; // generated and put into the world (or all air)
+		uint64_t	loaded = 0; // rebuilt from stored blocks
+		uint64_t	unloaded = 0;
+		uint64_t	skipped = 0; // left the radius while waiting in the priority queue, never queued
+		uint64_t	dropped = 0; // job was stale when a worker took it, no work done
+		uint64_t	wasted = 0; // job finished but the result was stale
+		uint64_t	edits_held = 0; // edits that waited for their chunk to be loaded (total, not current)
+		double		work_time = 0; // seconds of worker time for results that were used
+		double		wasted_time = 0; // seconds of worker time for wasted results
+	};
+	Stats stats;
+
+	ChunkStreamer (TerrainGenerator const& generator, int thread_count): generator{generator} {
+		pool.start_threads(thread_count, false, "chunk streamer");
+		max_in_flight = thread_count * 4;
+	}
+
+	// request new chunks around camera_pos, unload far ones, apply finished jobs and queue the next ones
+	void update (VoxelWorld& world, float3 camera_pos);
+
+	// chunks within the radius that are not in the world yet
+	size_t pending_count () const {
+		return pending;
+	}
+	// jobs queued or running
+	int in_flight () const {
+		return jobs_in_flight;
+	}
+
+	// apply finished jobs, optionally blocking until all queued jobs are done (main thread helps with the jobs)
+	void collect_results (VoxelWorld& world, bool wait=false);
+
+private:
+	enum Stage {
+		CS_QUEUED, // in the priority queue
+		CS_IN_FLIGHT, // job queued or running
+		CS_READY, // in the world (or all air)
+	};
+	struct Entry {
+		Stage		stage;
+		uint32_t	ticket; // of the job while in flight
+	};
+
+	TerrainGenerator const&		generator;
+
+	ChunkTickets				tickets; // before the pool, workers use it until the pool joins them
+	Threadpool<ChunkStreamJob>	pool;
+	uint32_t					next_ticket = 1;
+	int							jobs_in_flight = 0;
+
+	ChunkPriorityQueue			queue;
+	FlatHashMap<chunk_coord, Entry>			entries; // every chunk within the unload radius that was requested
+	FlatHashMap<chunk_coord, ChunkBlocks>	stored; // blocks of modified chunks that got unloaded
+	FlatHashMap<chunk_coord, std::vector<BlockEdit>>	held_edits; // edits of chunks that are not in the world yet, in order
+	size_t						pending = 0; // entries that are not CS_READY
+
+	chunk_coord					camera_chunk;
+	bool						first_update = true;
+
+	void hold_edits (VoxelWorld& world);
+	void update_wanted (VoxelWorld& world);
+	void unload (VoxelWorld& world, chunk_coord coord, Entry& entry);
+	void store_held_edits (chunk_coord coord);
+	void apply (VoxelWorld& world, ChunkStreamResult& res);
+};
@@ -1,18 +1,55 @@
 #pragma once
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <utility>
+#include <type_traits>
 #include "assert.h"
 
 // like a queue but is just implemented as a flat array, push() pop() like queue, but a push when the size is at it's max capacity will pop() automatically
 //  push() add the items to the "head" of the collection which is accessed via [0] (so everything shifts by one index in the process, but the implementation does not copy anything)
 //  pop() removes the items from the "tail" of the collection which is accessed via [size() - 1]
+//  the array is allocated with the next power of two size and indexed with free running counters & mask instead of %, capacity() stays what was asked for
+//  push_n() / pop_n() copy in at most two spans (memcpy for trivially copyable T)
+// not threadsafe, see SpscRing for a single producer single consumer version
 template <typename T>
 class circular_buffer {
 	std::unique_ptr<T[]> arr = nullptr;
 	size_t cap = 0;
-	size_t head; // next item index to be written
+	size_t mask = 0; // array size - 1
+	size_t head = 0; // total number of pushed items, next item is written to arr[head & mask]
 	size_t cnt = 0;
 
+	// copy n items from src to the ring starting at counter pos, in at most two spans
+	template <typename SRC>
+	void copy_in (size_t pos, SRC* src, size_t n) {
+		size_t i = pos & mask;
+		size_t first = n < mask + 1 - i ? n : mask + 1 - i;
+		copy(&arr[i], src, first);
+		copy(&arr[0], src + first, n - first);
+	}
+	// copy n items starting at counter pos from the ring to dst, in at most two spans
+	void copy_out (T* dst, size_t pos, size_t n, bool move) {
+		size_t i = pos & mask;
+		size_t first = n < mask + 1 - i ? n : mask + 1 - i;
+		if (move && !std::is_trivially_copyable<T>::value) {
+			copy(dst, std::make_move_iterator(&arr[i]), first);
+			copy(dst + first, std::make_move_iterator(&arr[0]), n - first);
+		} else {
+			copy(dst, &arr[i], first);
+			copy(dst + first, &arr[0], n - first);
+		}
+	}
+	template <typename SRC>
+	static void copy (T* dst, SRC src, size_t n) {
+		if constexpr (std::is_trivially_copyable<T>::value && std::is_pointer<SRC>::value) {
+			if (n > 0) memcpy(dst, src, n * sizeof(T));
+		} else {
+			for (size_t i=0; i<n; ++i)
+				dst[i] = *src++;
+		}
+	}
+
 public:
 	circular_buffer () {}
 	circular_buffer (size_t capacity) {
@@ -29,26 +66,33 @@ public:
 		return cnt;
 	}
 
+	// keeps the newest min(count(), new_capacity) items
 	void resize (size_t new_capacity) {
-		auto old = std::move(*this);
+		size_t size = 0;
+		if (new_capacity > 0) {
+			size = 1;
+			while (size < new_capacity)
+				size <<= 1;
+		}
 
-		cap = new_capacity;
-		arr = cap > 0 ? std::make_unique<T[]>(cap) : nullptr;
+		auto new_arr = size > 0 ? std::make_unique<T[]>(size) : nullptr;
 
-		cnt = cap <= old.cnt ? cap : old.cnt;
-		for (int i=0; i<cnt; ++i) {
-			arr[i] = old.arr[(old.head -cnt + old.cap + i) % old.cap];
-		}
+		size_t new_cnt = new_capacity < cnt ? new_capacity : cnt;
+		if (new_cnt > 0)
+			copy_out(new_arr.get(), head - new_cnt, new_cnt, true);
 
-		head = cnt % cap;
+		arr = std::move(new_arr);
+		cap = new_capacity;
+		mask = size > 0 ? size - 1 : 0;
+		head = new_cnt;
+		cnt = new_cnt;
 	}
 
 	void push (T const& item) {
 		assert(cap > 0);
 
 		// write in next free slot or overwrite if count == cap
-		arr[head++] = item;
-		head %= cap;
+		arr[head++ & mask] = item;
 
 		if (cnt < cap)
 			cnt++;
@@ -57,39 +101,52 @@ public:
 		assert(cap > 0);
 
 		// write in next free slot or overwrite if count == cap
-		arr[head++] = std::move(item);
-		head %= cap;
+		arr[head++ & mask] = std::move(item);
 
 		if (cnt < cap)
 			cnt++;
 	}
+	// push n items (items[n-1] is the newest), like n push() calls, only the last capacity() items are kept if n is larger
+	void push_n (T const* items, size_t n) {
+		assert(cap > 0);
+
+		if (n > cap) {
+			items += n - cap;
+			n = cap;
+		}
+		copy_in(head, items, n);
+		head += n;
+
+		cnt = cnt + n < cap ? cnt + n : cap;
+	}
 
 	T pop () {
 		assert(cap > 0 && cnt > 0);
 
-		size_t tail = head + (cap - cnt);
-		tail %= cap;
+		size_t tail = head - cnt;
 
 		cnt--;
-		return std::move( arr[tail] );
+		return std::move( arr[tail & mask] );
+	}
+	// pop up to n of the oldest items into out (out[0] is the oldest), returns how many were popped
+	size_t pop_n (T* out, size_t n) {
+		if (n > cnt)
+			n = cnt;
+		copy_out(out, head - cnt, n, true);
+		cnt -= n;
+		return n;
 	}
 
 	// get ith oldest value
 	T& get_oldest (size_t index) {
 		assert(index >= 0 && index < cnt);
-		size_t i = head + (cap - cnt);
-		i += index;
-		i %= cap;
-		return arr[i];
+		return arr[(head - cnt + index) & mask];
 	}
 
 	// get ith newest value
 	T& get_newest (size_t index) {
 		assert(index >= 0 && index < cnt);
-		size_t i = head + cap - 1;
-		i -= index;
-		i = (i + cap) % cap;
-		return arr[i];
+		return arr[(head - 1 - index) & mask];
 	}
 
 	T& operator [] (size_t index) {
@@ -0,0 +1,110 @@
+#include "counter_reader.hpp"
+#include "counters.hpp"
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+using namespace counters;
+
+struct FrameCopy {
+	uint64_t	index;
+	uint64_t	timestamp;
+	int64_t		values[MAX_COUNTERS];
+};
+
+// copy frame i of the ring, false if it was (being) overwritten
+static bool read_frame (FileHeader* h, uint64_t i, FrameCopy* out) {
+	Frame const& f = get_ring(h)[i & (RING_FRAMES - 1)];
+
+	uint64_t seq = f.seq.load(std::memory_order_acquire);
+	if (seq & 1)
+		return false;
+
+	out->index = f.index;
+	out->timestamp = f.timestamp;
+	memcpy(out->values, f.values, sizeof(f.values));
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return f.seq.load(std::memory_order_relaxed) == seq && out->index == i;
+}
+
+int run_counter_reader (const char* filename, float interval) {
+	FileHeader* h = nullptr;
+	while (!(h = map_for_reading(filename))) {
+		fprintf(stderr, "waiting for %s\n", filename);
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	}
+
+	FrameCopy prev = {}, cur = {};
+	bool have_prev = false;
+	uint64_t next = h->frames_written.load(std::memory_order_acquire);
+
+	std::vector<int64_t> gauge_min (MAX_COUNTERS), gauge_max (MAX_COUNTERS);
+
+	for (;;) {
+		std::this_thread::sleep_for(std::chrono::duration<float>(interval));
+
+		uint64_t written = h->frames_written.load(std::memory_order_acquire);
+		if (written < next) { // writer restarted
+			have_prev = false;
+			next = written;
+			continue;
+		}
+		if (written - next > RING_FRAMES - 1) // fell behind, the oldest frames might be getting overwritten
+			next = written - (RING_FRAMES - 1);
+
+		uint32_t count = h->counter_count.load(std::memory_order_acquire);
+
+		// walk all new frames for the gauge min / max, keep the last valid one
+		bool any = false;
+		for (int i=0; i<(int)count; ++i) {
+			gauge_min[i] = INT64_MAX;
+			gauge_max[i] = INT64_MIN;
+		}
+		for (; next < written; ++next) {
+			FrameCopy f;
+			if (!read_frame(h, next, &f))
+				continue;
+
+			for (int i=0; i<(int)count; ++i) {
+				gauge_min[i] = std::min(gauge_min[i], f.values[i]);
+				gauge_max[i] = std::max(gauge_max[i], f.values[i]);
+			}
+			cur = f;
+			any = true;
+		}
+		if (!any)
+			continue;
+
+		if (!have_prev) {
+			prev = cur;
+			have_prev = true;
+			continue;
+		}
+
+		double frames = (double)(cur.index - prev.index);
+		double seconds = (double)(cur.timestamp - prev.timestamp) / (double)h->timestamp_freq;
+		if (frames <= 0 || seconds <= 0)
+			continue;
+
+		printf("\x1b[H\x1b[J"); // clear the terminal
+		printf("%s  frame %llu  %.1f fps  %.2f ms/frame\n\n", filename, (unsigned long long)cur.index, frames / seconds, seconds / frames * 1000);
+		printf("%-32s %14s %14s %14s\n", "counter", "per frame", "per second", "total");
+		for (int i=0; i<(int)count; ++i) {
+			if (h->types[i] != CT_COUNTER) continue;
+			double delta = (double)(cur.values[i] - prev.values[i]);
+			printf("%-32.*s %14.1f %14.1f %14lld\n", MAX_NAME, h->names[i], delta / frames, delta / seconds, (long long)cur.values[i]);
+		}
+		printf("\n%-32s %14s %14s %14s\n", "gauge", "last", "min", "max");
+		for (int i=0; i<(int)count; ++i) {
+			if (h->types[i] != CT_GAUGE) continue;
+			printf("%-32.*s %14lld %14lld %14lld\n", MAX_NAME, h->names[i], (long long)cur.values[i], (long long)gauge_min[i], (long long)gauge_max[i]);
+		}
+		fflush(stdout);
+
+		prev = cur;
+	}
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Command line viewer for the counters a running process exports with counters::open_shared / counters::snapshot
+//  maps the same file read only and prints the per frame values and rates every interval seconds, until the process gets killed
+//  counters: per frame average and per second rate over the interval, gauges: last value and min / max over the interval
+//  started with  vulkan_leaning --counters [file]
+int run_counter_reader (const char* filename, float interval=0.5f);
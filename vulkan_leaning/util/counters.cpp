@@ -0,0 +1,182 @@
+#undef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include "counters.hpp"
+#include "timer.hpp"
+#include "assert.h"
+#include <mutex>
+#include <cstring>
+
+#if defined(_WIN32)
+	#include "clean_windows_h.hpp"
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace {
+	struct Registry {
+		std::mutex			m;
+		Counter*			list[counters::MAX_COUNTERS];
+		std::atomic<int>	count { 0 };
+	};
+	// function local static, counters register during static initialization in any order
+	Registry& get_registry () {
+		static Registry reg;
+		return reg;
+	}
+}
+
+Counter::Counter (const char* name, CounterType type): name{name}, type{type} {
+	auto& reg = get_registry();
+	std::lock_guard<std::mutex> lock(reg.m);
+
+	int i = reg.count.load(std::memory_order_relaxed);
+	assert(i < counters::MAX_COUNTERS);
+	if (i >= counters::MAX_COUNTERS)
+		return; // not exported
+
+	reg.list[i] = this;
+	reg.count.store(i + 1, std::memory_order_release);
+}
+
+namespace counters {
+	struct Mapping {
+		FileHeader*	header = nullptr;
+	#if defined(_WIN32)
+		HANDLE		file = INVALID_HANDLE_VALUE;
+		HANDLE		mapping = NULL;
+	#endif
+	};
+	static Mapping shared;
+
+	static void* map_file (const char* filename, bool write, Mapping* m) {
+	#if defined(_WIN32)
+		m->file = CreateFileA(filename, write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+			NULL, write ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (m->file == INVALID_HANDLE_VALUE)
+			return nullptr;
+
+		m->mapping = CreateFileMappingA(m->file, NULL, write ? PAGE_READWRITE : PAGE_READONLY, (DWORD)((uint64_t)FILE_SIZE >> 32), (DWORD)FILE_SIZE, NULL);
+		if (!m->mapping) {
+			CloseHandle(m->file);
+			return nullptr;
+		}
+
+		void* ptr = MapViewOfFile(m->mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, FILE_SIZE);
+		if (!ptr) {
+			CloseHandle(m->mapping);
+			CloseHandle(m->file);
+		}
+		return ptr;
+	#else
+		(void)m;
+		int fd = open(filename, write ? O_RDWR | O_CREAT | O_TRUNC : O_RDONLY, 0644);
+		if (fd < 0)
+			return nullptr;
+
+		struct stat st;
+		if (write ? ftruncate(fd, (off_t)FILE_SIZE) != 0 : (fstat(fd, &st) != 0 || (size_t)st.st_size < FILE_SIZE)) {
+			close(fd);
+			return nullptr;
+		}
+
+		void* ptr = mmap(nullptr, FILE_SIZE, write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+		close(fd); // the mapping stays valid
+		return ptr == MAP_FAILED ? nullptr : ptr;
+	#endif
+	}
+
+	static void unmap_file (Mapping* m) {
+		if (!m->header)
+			return;
+	#if defined(_WIN32)
+		UnmapViewOfFile(m->header);
+		CloseHandle(m->mapping);
+		CloseHandle(m->file);
+	#else
+		munmap(m->header, FILE_SIZE);
+	#endif
+		*m = Mapping();
+	}
+
+	bool open_shared (const char* filename) {
+		close_shared();
+
+		void* ptr = map_file(filename, true, &shared);
+		if (!ptr)
+			return false;
+
+		memset(ptr, 0, FILE_SIZE);
+		FileHeader* h = (FileHeader*)ptr;
+		h->max_counters = MAX_COUNTERS;
+		h->ring_frames = RING_FRAMES;
+		h->timestamp_freq = kiss::timestamp_freq;
+		// magic last, a reader that maps the file during the setup sees an invalid file
+		std::atomic_thread_fence(std::memory_order_release);
+		memcpy(h->magic, MAGIC, sizeof(MAGIC));
+
+		shared.header = h;
+		return true;
+	}
+	void close_shared () {
+		unmap_file(&shared);
+	}
+
+	void snapshot () {
+		FileHeader* h = shared.header;
+		if (!h)
+			return;
+
+		auto& reg = get_registry();
+		int count = reg.count.load(std::memory_order_acquire);
+
+		// names of counters that registered since the last snapshot
+		uint32_t known = h->counter_count.load(std::memory_order_relaxed);
+		if ((uint32_t)count != known) {
+			for (int i=(int)known; i<count; ++i) {
+				strncpy(h->names[i], reg.list[i]->name, MAX_NAME - 1);
+				h->types[i] = reg.list[i]->type;
+			}
+			h->counter_count.store((uint32_t)count, std::memory_order_release);
+		}
+
+		uint64_t n = h->frames_written.load(std::memory_order_relaxed);
+		Frame& f = get_ring(h)[n & (RING_FRAMES - 1)];
+
+		uint64_t seq = f.seq.load(std::memory_order_relaxed);
+		f.seq.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		f.index = n;
+		f.timestamp = kiss::get_timestamp();
+		for (int i=0; i<count; ++i)
+			f.values[i] = reg.list[i]->get();
+
+		f.seq.store(seq + 2, std::memory_order_release);
+		h->frames_written.store(n + 1, std::memory_order_release);
+	}
+
+	static Mapping reading; // the reader maps one file at a time
+
+	FileHeader* map_for_reading (const char* filename) {
+		void* ptr = map_file(filename, false, &reading);
+		if (!ptr)
+			return nullptr;
+
+		FileHeader* h = (FileHeader*)ptr;
+		reading.header = h;
+
+		if (memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 || h->max_counters != MAX_COUNTERS || h->ring_frames != RING_FRAMES) {
+			unmap_file(&reading);
+			return nullptr;
+		}
+		return h;
+	}
+	void unmap (FileHeader* header) {
+		if (header == reading.header)
+			unmap_file(&reading);
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "stdint.h"
+#include <cstddef>
+#include <atomic>
+
+// Named performance counters that can be watched from another process
+//  Counter objects need static storage duration (globals or function local statics), they register themselves on construction
+//  counters::snapshot() once per frame copies all values into the next frame of a ring in a memory mapped file
+//   the writer only does plain stores into the mapping (no syscalls), a reader process maps the same file and tails the ring (see counter_reader.hpp)
+//  frames in the ring are written like a seqlock: seq is odd while the frame is being written, the reader retries or skips frames whose seq changed during its copy
+
+enum CounterType : uint8_t {
+	CT_COUNTER, // only ever increases, the reader shows the per frame delta and the rate per second (draw calls, bytes uploaded)
+	CT_GAUGE, // current value, the reader shows it as is (queue depths)
+};
+
+class Counter {
+public:
+	std::atomic<int64_t>	value { 0 };
+	const char*				name;
+	CounterType				type;
+
+	Counter (const char* name, CounterType type=CT_COUNTER);
+
+	// can be called from any thread
+	void add (int64_t n=1) {
+		value.fetch_add(n, std::memory_order_relaxed);
+	}
+	void set (int64_t v) {
+		value.store(v, std::memory_order_relaxed);
+	}
+	int64_t get () const {
+		return value.load(std::memory_order_relaxed);
+	}
+};
+
+namespace counters {
+	static constexpr int		MAX_COUNTERS = 128;
+	static constexpr int		MAX_NAME = 48; // including the null
+	static constexpr uint32_t	RING_FRAMES = 1024; // power of two
+	static constexpr char		MAGIC[8] = { 'K','C','N','T','R','S','0','1' };
+
+	// layout of the mapped file: FileHeader followed by RING_FRAMES Frames
+	struct FileHeader {
+		char					magic[8];
+		uint32_t				max_counters;
+		uint32_t				ring_frames;
+		uint64_t				timestamp_freq; // of Frame::timestamp
+
+		std::atomic<uint32_t>	counter_count; // names and types of the first counter_count counters are valid
+		uint32_t				_pad;
+		std::atomic<uint64_t>	frames_written; // frame i is at ring[i % ring_frames]
+
+		char					names[MAX_COUNTERS][MAX_NAME];
+		CounterType				types[MAX_COUNTERS];
+	};
+
+	struct Frame {
+		std::atomic<uint64_t>	seq; // odd while being written
+		uint64_t				index;
+		uint64_t				timestamp; // kiss::get_timestamp at the snapshot
+		int64_t					values[MAX_COUNTERS];
+	};
+
+	static constexpr size_t FILE_SIZE = sizeof(FileHeader) + sizeof(Frame) * RING_FRAMES;
+
+	inline Frame* get_ring (FileHeader* header) {
+		return (Frame*)(header + 1);
+	}
+
+	// create (or overwrite) the mapped file that snapshot() writes to, returns false on fail (snapshot() does nothing then)
+	bool open_shared (const char* filename="perf_counters.bin");
+	void close_shared ();
+
+	// copy the current value of all counters into the next frame of the ring, call once per frame from one thread
+	void snapshot ();
+
+	// map an existing file for reading, returns nullptr on fail or if it is not a counter file
+	FileHeader* map_for_reading (const char* filename);
+	void unmap (FileHeader* header);
+}
@@ -0,0 +1,396 @@
+#pragma once
+#include "../kissmath.hpp"
+#include "simd.hpp"
+#include "bit_twiddling.hpp"
+#include "alloc_tracking.hpp"
+#include "stdint.h"
+#include "assert.h"
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <new>
+#include <type_traits>
+
+namespace flat_hash {
+	// murmur3 finalizer, all bits of the input affect all bits of the output (FlatHashMap uses the low 7 bits and the rest separately)
+	inline uint64_t mix (uint64_t h) {
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+		return h;
+	}
+
+	// 8 bytes per step, multiply-rotate like xxhash, tail read into one zero padded word
+	inline uint64_t hash_bytes (void const* data, size_t len) {
+		auto step = [] (uint64_t h, uint64_t v) {
+			h ^= v * 0xC2B2AE3D27D4EB4Full;
+			h = (h << 31) | (h >> 33);
+			return h * 0x9E3779B97F4A7C15ull;
+		};
+
+		auto* p = (uint8_t const*)data;
+		uint64_t h = 0x27D4EB2F165667C5ull ^ ((uint64_t)len * 0x9E3779B97F4A7C15ull);
+		for (; len >= 8; len -= 8, p += 8) {
+			uint64_t v;
+			memcpy(&v, p, 8);
+			h = step(h, v);
+		}
+		if (len > 0) {
+			uint64_t v = 0;
+			memcpy(&v, p, len);
+			h = step(h, v);
+		}
+		return mix(h);
+	}
+}
+
+// Hash for FlatHashMap keys: coords, integers, pointers and strings
+//  transparent: std::string, std::string_view and const char* hash the same, so maps with std::string keys can be searched with a string_view
+struct FlatHash {
+	typedef void is_transparent;
+
+	uint64_t operator() (int3 v) const {
+		return flat_hash::mix((uint64_t)(uint32_t)v.x * 0x9E3779B97F4A7C15ull
+		                    ^ (uint64_t)(uint32_t)v.y * 0xC2B2AE3D27D4EB4Full
+		                    ^ (uint64_t)(uint32_t)v.z * 0x165667B19E3779F9ull);
+	}
+	uint64_t operator() (int64v3 v) const {
+		return flat_hash::mix(flat_hash::mix((uint64_t)v.x) * 0x9E3779B97F4A7C15ull
+		                    ^ flat_hash::mix((uint64_t)v.y) * 0xC2B2AE3D27D4EB4Full
+		                    ^ flat_hash::mix((uint64_t)v.z) * 0x165667B19E3779F9ull);
+	}
+
+	uint64_t operator() (std::string_view s) const {
+		return flat_hash::hash_bytes(s.data(), s.size());
+	}
+	uint64_t operator() (std::string const& s) const {
+		return flat_hash::hash_bytes(s.data(), s.size());
+	}
+	uint64_t operator() (const char* s) const {
+		return flat_hash::hash_bytes(s, strlen(s));
+	}
+	// a non-const char buffer is a string too, not a pointer key
+	uint64_t operator() (char* s) const {
+		return flat_hash::hash_bytes(s, strlen(s));
+	}
+
+	template <typename T, typename = std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+	uint64_t operator() (T v) const {
+		return flat_hash::mix((uint64_t)v);
+	}
+	template <typename T>
+	uint64_t operator() (T* ptr) const {
+		return flat_hash::mix((uint64_t)(uintptr_t)ptr);
+	}
+};
+struct FlatEqual {
+	typedef void is_transparent;
+
+	bool operator() (int3 l, int3 r) const {			return equal(l, r); }
+	bool operator() (int64v3 l, int64v3 r) const {		return equal(l, r); }
+
+	template <typename A, typename B>
+	bool operator() (A const& l, B const& r) const {	return l == r; }
+};
+
+// Open addressing hash map in the style of google's swiss table
+//  one control byte per slot: empty, deleted or the low 7 bits of the hash of the key in the slot
+//  slots are probed in groups of 16, one sse2 compare finds all slots in a group whose control byte matches the key, so most lookups touch one control cache line and one slot
+//  groups are probed triangularly (1, 2, 3.. groups further), the table grows at 7/8 load
+//  erase leaves a deleted marker unless the group still has an empty slot (then no probe sequence can have passed it)
+//  keys and values are stored inline (no nodes), pointers to values are only valid until the next insert
+//  lookups are templated, so a key of another type can be used if HASH and EQ support it (string_view for std::string keys)
+//  all lookups have an overload with a precomputed hash (from hash()), eg. to hash a key once for several maps or ahead of a batch
+template <typename K, typename V, typename HASH=FlatHash, typename EQ=FlatEqual>
+class FlatHashMap {
+	static constexpr int		GROUP = 16;
+	static constexpr int8_t		CTRL_EMPTY = -128;
+	static constexpr int8_t		CTRL_DELETED = -2;
+	static constexpr size_t		MIN_CAP = GROUP;
+
+	struct Slot {
+		K	key;
+		V	value;
+	};
+	static_assert(alignof(Slot) <= 16, "alloc_tracking::malloc only aligns to 16 bytes");
+
+	// bitmasks of the slots in a group (bit i -> slot i)
+	struct Group {
+	#if SIMD_HAS_SSE2
+		__m128i ctrl;
+
+		Group (int8_t const* p): ctrl{_mm_loadu_si128((__m128i const*)p)} {}
+
+		uint32_t match (int8_t h2) const {
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
+		}
+		uint32_t match_empty () const {
+			return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(CTRL_EMPTY)));
+		}
+		uint32_t match_empty_or_deleted () const {
+			return (uint32_t)_mm_movemask_epi8(ctrl); // both have the sign bit set
+		}
+	#else
+		int8_t ctrl[GROUP];
+
+		Group (int8_t const* p) {
+			memcpy(ctrl, p, GROUP);
+		}
+
+		uint32_t match (int8_t h2) const {
+			uint32_t bits = 0;
+			for (int i=0; i<GROUP; ++i)
+				bits |= (uint32_t)(ctrl[i] == h2) << i;
+			return bits;
+		}
+		uint32_t match_empty () const {
+			return match(CTRL_EMPTY);
+		}
+		uint32_t match_empty_or_deleted () const {
+			uint32_t bits = 0;
+			for (int i=0; i<GROUP; ++i)
+				bits |= (uint32_t)(ctrl[i] < 0) << i;
+			return bits;
+		}
+	#endif
+	};
+
+	int8_t*		ctrl = nullptr;
+	Slot*		slots = nullptr;
+	size_t		capacity = 0; // power of two and multiple of GROUP (or 0)
+	size_t		count = 0;
+	size_t		growth_left = 0; // empty slots that can still be filled before the 7/8 load is reached
+
+	HASH		hasher;
+	EQ			eq;
+
+	static int8_t h2 (uint64_t hash) {
+		return (int8_t)(hash & 0x7f);
+	}
+	static size_t max_load (size_t cap) {
+		return cap - cap / 8;
+	}
+
+	template <typename Q>
+	size_t find_index (Q const& key, uint64_t hash) const {
+		if (capacity == 0)
+			return (size_t)-1;
+
+		size_t group_mask = capacity / GROUP - 1;
+		size_t g = (size_t)(hash >> 7) & group_mask;
+		int8_t h = h2(hash);
+
+		for (size_t i=1;; ++i) {
+			Group grp (ctrl + g * GROUP);
+
+			for (uint32_t bits = grp.match(h); bits; bits &= bits - 1) {
+				size_t idx = g * GROUP + count_trailing_zeros(bits);
+				if (eq(slots[idx].key, key))
+					return idx;
+			}
+			if (grp.match_empty())
+				return (size_t)-1;
+
+			g = (g + i) & group_mask;
+		}
+	}
+
+	// first empty or deleted slot in the probe sequence of hash, there always is one because of the max load
+	size_t find_insert_index (uint64_t hash) const {
+		size_t group_mask = capacity / GROUP - 1;
+		size_t g = (size_t)(hash >> 7) & group_mask;
+
+		for (size_t i=1;; ++i) {
+			uint32_t bits = Group(ctrl + g * GROUP).match_empty_or_deleted();
+			if (bits)
+				return g * GROUP + count_trailing_zeros(bits);
+
+			g = (g + i) & group_mask;
+		}
+	}
+
+	void rehash (size_t new_cap) {
+		int8_t* old_ctrl = ctrl;
+		Slot* old_slots = slots;
+		size_t old_cap = capacity;
+
+		ctrl = (int8_t*)alloc_tracking::malloc(new_cap);
+		slots = (Slot*)alloc_tracking::malloc(new_cap * sizeof(Slot));
+		memset(ctrl, CTRL_EMPTY, new_cap);
+		capacity = new_cap;
+		growth_left = max_load(new_cap) - count;
+
+		for (size_t i=0; i<old_cap; ++i) {
+			if (old_ctrl[i] < 0)
+				continue;
+
+			uint64_t hash = hasher(old_slots[i].key);
+			size_t idx = find_insert_index(hash);
+			ctrl[idx] = h2(hash);
+			new (&slots[idx]) Slot(std::move(old_slots[i]));
+			old_slots[i].~Slot();
+		}
+
+		if (old_ctrl) {
+			alloc_tracking::free(old_ctrl);
+			alloc_tracking::free(old_slots);
+		}
+	}
+
+	// make room for one more element
+	void grow () {
+		// mostly deleted markers -> rehash in place to clean them up, else double
+		if (capacity > 0 && count < max_load(capacity) / 2)
+			rehash(capacity);
+		else
+			rehash(capacity ? capacity * 2 : MIN_CAP);
+	}
+
+public:
+	FlatHashMap () {}
+	~FlatHashMap () {
+		clear();
+		if (ctrl) {
+			alloc_tracking::free(ctrl);
+			alloc_tracking::free(slots);
+		}
+	}
+
+	size_t size () const {
+		return count;
+	}
+	bool empty () const {
+		return count == 0;
+	}
+
+	// grow so that count elements fit without rehashing
+	void reserve (size_t count) {
+		size_t cap = capacity ? capacity : MIN_CAP;
+		while (max_load(cap) < count)
+			cap *= 2;
+		if (cap != capacity)
+			rehash(cap);
+	}
+
+	// keeps the memory
+	void clear () {
+		for (size_t i=0; i<capacity; ++i) {
+			if (ctrl[i] >= 0)
+				slots[i].~Slot();
+		}
+		if (ctrl)
+			memset(ctrl, CTRL_EMPTY, capacity);
+		count = 0;
+		growth_left = max_load(capacity);
+	}
+
+	template <typename Q>
+	uint64_t hash (Q const& key) const {
+		return hasher(key);
+	}
+
+	// nullptr if not found
+	template <typename Q>
+	V* find (Q const& key, uint64_t hash) {
+		size_t idx = find_index(key, hash);
+		return idx != (size_t)-1 ? &slots[idx].value : nullptr;
+	}
+	template <typename Q>
+	V const* find (Q const& key, uint64_t hash) const {
+		size_t idx = find_index(key, hash);
+		return idx != (size_t)-1 ? &slots[idx].value : nullptr;
+	}
+	template <typename Q>
+	V* find (Q const& key) {					return find(key, hasher(key)); }
+	template <typename Q>
+	V const* find (Q const& key) const {		return find(key, hasher(key)); }
+
+	template <typename Q>
+	bool contains (Q const& key) const {		return find_index(key, hasher(key)) != (size_t)-1; }
+
+	// inserts (key, val) if key is not in the map yet, returns the value in the map and if it was inserted
+	std::pair<V*, bool> try_emplace (K key, V val, uint64_t hash) {
+		size_t idx = find_index(key, hash);
+		if (idx != (size_t)-1)
+			return { &slots[idx].value, false };
+
+		if (capacity == 0)
+			grow();
+		idx = find_insert_index(hash);
+		if (growth_left == 0 && ctrl[idx] == CTRL_EMPTY) {
+			grow();
+			idx = find_insert_index(hash);
+		}
+
+		if (ctrl[idx] == CTRL_EMPTY)
+			growth_left--;
+		ctrl[idx] = h2(hash);
+		new (&slots[idx]) Slot{ std::move(key), std::move(val) };
+		count++;
+		return { &slots[idx].value, true };
+	}
+	std::pair<V*, bool> try_emplace (K key, V val=V()) {
+		uint64_t h = hasher(key);
+		return try_emplace(std::move(key), std::move(val), h);
+	}
+
+	V& operator[] (K key) {
+		return *try_emplace(std::move(key)).first;
+	}
+
+	// returns false if key was not in the map
+	template <typename Q>
+	bool erase (Q const& key, uint64_t hash) {
+		size_t idx = find_index(key, hash);
+		if (idx == (size_t)-1)
+			return false;
+
+		slots[idx].~Slot();
+		count--;
+
+		if (Group(ctrl + (idx & ~(size_t)(GROUP-1))).match_empty()) {
+			ctrl[idx] = CTRL_EMPTY;
+			growth_left++;
+		} else {
+			ctrl[idx] = CTRL_DELETED;
+		}
+		return true;
+	}
+	template <typename Q>
+	bool erase (Q const& key) {					return erase(key, hasher(key)); }
+
+	template <typename FUNC>
+	void for_each (FUNC func) { // 'void func (K const& key, V& val)', do not insert or erase inside
+		for (size_t i=0; i<capacity; ++i) {
+			if (ctrl[i] >= 0)
+				func((K const&)slots[i].key, slots[i].value);
+		}
+	}
+	template <typename FUNC>
+	void for_each (FUNC func) const { // 'void func (K const& key, V const& val)'
+		for (size_t i=0; i<capacity; ++i) {
+			if (ctrl[i] >= 0)
+				func((K const&)slots[i].key, (V const&)slots[i].value);
+		}
+	}
+
+	// copy
+	FlatHashMap (FlatHashMap const& r) = delete;
+	FlatHashMap& operator= (FlatHashMap const& r) = delete;
+	// move
+	FlatHashMap (FlatHashMap&& r) {				swap(*this, r); }
+	FlatHashMap& operator= (FlatHashMap&& r) {	swap(*this, r); return *this; }
+
+	static void swap (FlatHashMap& l, FlatHashMap& r) {
+		std::swap(l.ctrl, r.ctrl);
+		std::swap(l.slots, r.slots);
+		std::swap(l.capacity, r.capacity);
+		std::swap(l.count, r.count);
+		std::swap(l.growth_left, r.growth_left);
+		std::swap(l.hasher, r.hasher);
+		std::swap(l.eq, r.eq);
+	}
+};
@@ -0,0 +1,168 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "flat_hash_map.hpp"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+
+// FlatHashMap vs std::unordered_map, ns per op
+//  int3 keys (chunk coords): insert, hit in shuffled order, miss; unordered_map gets the same FlatHash so only the table layout differs
+//  std::string keys: insert and hit looked up by string_view (unordered_map has to build a std::string for the lookup)
+//  plus a random insert / erase churn checked against unordered_map (tombstones, regrowth)
+namespace {
+	struct StringViewHash {
+		typedef void is_transparent;
+		size_t operator() (std::string_view s) const {	return std::hash<std::string_view>()(s); }
+	};
+	struct StringViewEqual {
+		typedef void is_transparent;
+		bool operator() (std::string_view l, std::string_view r) const {	return l == r; }
+	};
+
+	double ns_per_op (double sec, size_t ops) {
+		return sec / (double)ops * 1e9;
+	}
+
+	void bench_int3 (int n, long long& sum) {
+		std::mt19937 rng (n);
+		std::vector<int3> keys, missing;
+		for (int i=0; i<n; ++i)
+			keys.push_back(int3((int)(rng() % 4096) - 2048, (int)(rng() % 4096) - 2048, i));
+		for (int i=0; i<n; ++i)
+			missing.push_back(int3((int)(rng() % 4096) - 2048, (int)(rng() % 4096) - 2048, -1 - i));
+
+		std::vector<int3> order = keys;
+		std::shuffle(order.begin(), order.end(), rng);
+
+		int R = std::max(1, 10000000 / n); // lookup repetitions
+		int IR = std::min(R, 10); // insert repetitions (fresh map each time)
+
+		double ins_f = 0, hit_f = 0, miss_f = 0;
+		for (int r=0; r<IR; ++r) {
+			FlatHashMap<int3, int> f;
+			auto t = kiss::Timer::start();
+			for (int i=0; i<n; ++i)
+				f.try_emplace(keys[i], i);
+			ins_f += t.end();
+
+			if (r == 0) {
+				t = kiss::Timer::start();
+				for (int k=0; k<R; ++k)
+					for (auto& c : order) sum += *f.find(c);
+				hit_f = t.end() / R;
+
+				t = kiss::Timer::start();
+				for (int k=0; k<R; ++k)
+					for (auto& c : missing) sum += f.find(c) != nullptr;
+				miss_f = t.end() / R;
+			}
+		}
+
+		double ins_u = 0, hit_u = 0, miss_u = 0;
+		for (int r=0; r<IR; ++r) {
+			std::unordered_map<int3, int, FlatHash, FlatEqual> u;
+			auto t = kiss::Timer::start();
+			for (int i=0; i<n; ++i)
+				u.try_emplace(keys[i], i);
+			ins_u += t.end();
+
+			if (r == 0) {
+				t = kiss::Timer::start();
+				for (int k=0; k<R; ++k)
+					for (auto& c : order) sum += u.find(c)->second;
+				hit_u = t.end() / R;
+
+				t = kiss::Timer::start();
+				for (int k=0; k<R; ++k)
+					for (auto& c : missing) sum += u.find(c) != u.end();
+				miss_u = t.end() / R;
+			}
+		}
+
+		printf("int3   n=%8d  insert %6.1f / %6.1f ns  hit %6.1f / %6.1f ns  miss %6.1f / %6.1f ns\n", n,
+			ns_per_op(ins_f / IR, n), ns_per_op(ins_u / IR, n), ns_per_op(hit_f, n), ns_per_op(hit_u, n), ns_per_op(miss_f, n), ns_per_op(miss_u, n));
+	}
+
+	void bench_string (int n, long long& sum) {
+		std::mt19937 rng (n);
+		std::vector<std::string> keys;
+		for (int i=0; i<n; ++i)
+			keys.push_back("chunk_mesh_" + std::to_string(rng()) + "_" + std::to_string(i));
+
+		std::vector<std::string_view> order (keys.begin(), keys.end());
+		std::shuffle(order.begin(), order.end(), rng);
+
+		int R = std::max(1, 10000000 / n);
+
+		FlatHashMap<std::string, int> f;
+		std::unordered_map<std::string, int, StringViewHash, StringViewEqual> u;
+
+		auto t = kiss::Timer::start();
+		for (int i=0; i<n; ++i)
+			f.try_emplace(keys[i], i);
+		double ins_f = t.end();
+
+		t = kiss::Timer::start();
+		for (int i=0; i<n; ++i)
+			u.try_emplace(keys[i], i);
+		double ins_u = t.end();
+
+		t = kiss::Timer::start();
+		for (int k=0; k<R; ++k)
+			for (auto s : order) sum += *f.find(s);
+		double hit_f = t.end() / R;
+
+		t = kiss::Timer::start();
+		for (int k=0; k<R; ++k)
+			for (auto s : order) sum += u.find(std::string(s))->second;
+		double hit_u = t.end() / R;
+
+		printf("string n=%8d  insert %6.1f / %6.1f ns  hit (string_view) %6.1f / %6.1f ns\n", n,
+			ns_per_op(ins_f, n), ns_per_op(ins_u, n), ns_per_op(hit_f, n), ns_per_op(hit_u, n));
+	}
+
+	// random inserts and erases on few keys, so tombstones get created, reused and cleaned up by regrowth
+	int check_churn () {
+		FlatHashMap<int, int> f;
+		std::unordered_map<int, int> u;
+		std::mt19937 rng (5);
+
+		for (int i=0; i<2000000; ++i) {
+			int k = rng() % 5000;
+			if (rng() % 2) {
+				f[k] = i;
+				u[k] = i;
+			} else {
+				f.erase(k);
+				u.erase(k);
+			}
+		}
+
+		bool ok = f.size() == u.size();
+		for (auto& it : u) {
+			int* val = f.find(it.first);
+			ok = ok && val && *val == it.second;
+		}
+		printf("erase churn %s (%zu entries)\n", ok ? "ok" : "FAILED", f.size());
+		return ok ? 0 : 1;
+	}
+}
+
+int bench_flat_hash_map (int argc, char** argv) {
+	int max_n = argc > 0 ? atoi(argv[0]) : 1000000;
+
+	printf("flat / unordered_map\n");
+	long long sum = 0;
+	for (int n = 1000; n <= max_n; n *= 10) {
+		bench_int3(n, sum);
+		if (n <= 1000000)
+			bench_string(n, sum);
+	}
+	printf("(%lld)\n", sum);
+
+	return check_churn();
+}
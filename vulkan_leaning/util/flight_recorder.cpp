@@ -0,0 +1,70 @@
+#include "flight_recorder.hpp"
+#include "string.hpp"
+
+bool FlightRecorder::frame (float dt) {
+	bool spike = dt > threshold;
+
+	frame_times.push(dt);
+
+	if ((int)frame_times.count() >= min_history)
+		threshold = std::max(frame_times.calc_percentile(percentile) * spike_factor, min_spike_time);
+
+	if (!spike)
+		return false;
+	spikes++;
+
+	uint64_t now = kiss::get_timestamp();
+	if (dumping.load(std::memory_order_acquire))
+		return false;
+	if (last_dump != 0 && (float)(now - last_dump) / (float)kiss::timestamp_freq < cooldown)
+		return false;
+
+	last_dump = now;
+	dumping.store(true, std::memory_order_relaxed);
+
+	{
+		std::lock_guard<std::mutex> lock(m);
+		dump_filename = kiss::prints("%s%d.json", filename_prefix.c_str(), spikes);
+		dump_seconds = window;
+	}
+	c.notify_one();
+	return true;
+}
+
+FlightRecorder::FlightRecorder (int history_frames): frame_times{history_frames} {
+	// not named and without zones, it would only take up a profiler ring
+	dump_thread = std::thread(&FlightRecorder::dump_thread_main, this);
+}
+FlightRecorder::~FlightRecorder () {
+	{
+		std::lock_guard<std::mutex> lock(m);
+		shutdown = true;
+	}
+	c.notify_one();
+	dump_thread.join();
+}
+
+void FlightRecorder::dump_thread_main () {
+	for (;;) {
+		std::string filename;
+		float seconds;
+		{
+			std::unique_lock<std::mutex> lock(m);
+			while (!shutdown && dump_filename.empty())
+				c.wait(lock);
+			if (dump_filename.empty())
+				return; // shutdown, but finish a requested dump first
+
+			filename = std::move(dump_filename);
+			dump_filename.clear();
+			seconds = dump_seconds;
+		}
+
+		if (profiler::write_chrome_trace(filename.c_str(), seconds))
+			dumps.fetch_add(1, std::memory_order_relaxed);
+		else
+			failed_dumps.fetch_add(1, std::memory_order_relaxed);
+
+		dumping.store(false, std::memory_order_release);
+	}
+}
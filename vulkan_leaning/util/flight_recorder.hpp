@@ -0,0 +1,68 @@
+#pragma once
+#include "profiler.hpp"
+#include "running_average.hpp"
+#include <thread>
+#include <atomic>
+#include <string>
+#include <limits>
+#include <mutex>
+#include <condition_variable>
+
+// Always-on flight recorder, dumps a trace of the last seconds when a frame spikes
+//  the profiler rings of every thread always hold the recent zones, allocations and gpu timings, so there is nothing extra to record
+//  a frame spikes when it takes longer than spike_factor * the percentile of the recent frame times (so a steady low framerate does not count, only hitches)
+//  the dump runs on a thread of the recorder (waiting on a condition variable), the frame thread only pushes its frame time, compares it to the threshold and wakes that thread
+//   the rings keep getting written during the dump, the export drops the oldest events if they get overwritten meanwhile, the spike frame is among the newest
+class FlightRecorder {
+public:
+	float		window = 2.0f; // seconds of history in the trace (threads that record more than ThreadBuffer::RING_SIZE events in that time have less)
+	float		percentile = 0.95f;
+	float		spike_factor = 2.0f;
+	float		min_spike_time = 1.0f / 30; // seconds, frames faster than this never count as spikes
+	int			min_history = 120; // frames needed before spikes get detected
+	float		cooldown = 10.0f; // seconds after a dump started before the next one can start
+	std::string	filename_prefix = "hitch_"; // dumps go to <prefix><spike number>.json
+
+	struct Stats {
+		int		spikes = 0;
+		int		dumps = 0;
+		int		failed_dumps = 0;
+		float	threshold = 0; // current spike threshold in seconds
+	};
+
+	FlightRecorder (int history_frames=600);
+	~FlightRecorder (); // finishes a running dump
+
+	// call once per frame with the frame time in seconds, returns true if the frame was a spike and a dump was started
+	bool frame (float dt);
+
+	// stats are written by the dump thread as well
+	Stats get_stats () const {
+		Stats s;
+		s.spikes = spikes;
+		s.dumps = dumps.load(std::memory_order_relaxed);
+		s.failed_dumps = failed_dumps.load(std::memory_order_relaxed);
+		s.threshold = threshold;
+		return s;
+	}
+
+private:
+	RunningAverage<float>	frame_times;
+	float					threshold = std::numeric_limits<float>::infinity(); // until min_history frames were seen
+
+	int						spikes = 0;
+	uint64_t				last_dump = 0; // kiss::get_timestamp
+
+	std::thread				dump_thread;
+	std::mutex				m;
+	std::condition_variable	c;
+	std::string				dump_filename; // set by the frame thread to request a dump, empty while none is requested
+	float					dump_seconds;
+	bool					shutdown = false;
+
+	std::atomic<bool>		dumping { false }; // requested or running
+	std::atomic<int>		dumps { 0 };
+	std::atomic<int>		failed_dumps { 0 };
+
+	void dump_thread_main ();
+};
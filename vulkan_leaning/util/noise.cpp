@@ -0,0 +1,308 @@
+#include "noise.hpp"
+#include "random.hpp"
+#include "wide_math.hpp"
+
+// kernels always use the widest native lane type
+typedef WideLanes<SIMD_MAX_WIDTH>::float_t	F;
+typedef F::int_t							I;
+typedef F::mask_t							M;
+static constexpr int W = F::WIDTH;
+
+Noise::Noise (uint64_t seed) {
+	Pcg32 rng (seed);
+	for (int i=0; i<256; ++i)
+		perm[i] = i;
+	for (int i=255; i>0; --i) // fisher-yates
+		std::swap(perm[i], perm[bits_to_range(rng(), (uint32_t)i + 1)]);
+	for (int i=0; i<256; ++i)
+		perm[256 + i] = perm[i];
+}
+
+// flip the sign of v where bit 0 of bit is set
+static SIMD_INLINE F flip_sign (F v, I bit) {
+	return as_float(as_int(v) ^ (bit << 31));
+}
+
+// 6t^5 - 15t^4 + 10t^3
+static SIMD_INLINE F fade (F t) {
+	return t * t * t * (t * (t * F(6.0f) - F(15.0f)) + F(10.0f));
+}
+
+//// simplex (Gustavson's reference implementation, with the gradient selection of improved perlin noise)
+
+static SIMD_INLINE F grad2 (I hash, F x, F y) {
+	// (+-1, +-2) and (+-2, +-1)
+	M h_lt4 = (hash & I(4)) == I(0);
+	F u = select(h_lt4, x, y);
+	F v = select(h_lt4, y, x);
+	return flip_sign(u, hash & I(1)) + flip_sign(v + v, srl(hash & I(2), 1));
+}
+
+static SIMD_INLINE F corner2 (I hash, F x, F y) {
+	F t = max(F(0.5f) - x*x - y*y, F(0.0f));
+	t = t * t;
+	return t * t * grad2(hash, x, y);
+}
+
+static SIMD_INLINE F simplex2 (int const* perm, F x, F y) {
+	const float F2 = 0.36602540378f; // (sqrt(3) - 1) / 2
+	const float G2 = 0.21132486540f; // (3 - sqrt(3)) / 6
+
+	// skew into the simplex grid to find the cell
+	F s = (x + y) * F(F2);
+	F xs = floor(x + s);
+	F ys = floor(y + s);
+	F t = (xs + ys) * F(G2);
+	F x0 = x - (xs - t);
+	F y0 = y - (ys - t);
+
+	// which of the two triangles
+	M lower = x0 > y0;
+	F i1 = mask(lower, F(1.0f));
+	F j1 = F(1.0f) - i1;
+
+	F x1 = x0 - i1 + F(G2);
+	F y1 = y0 - j1 + F(G2);
+	F x2 = x0 - F(1.0f - 2.0f * G2);
+	F y2 = y0 - F(1.0f - 2.0f * G2);
+
+	I ii = to_int(xs) & I(255);
+	I jj = to_int(ys) & I(255);
+	I ii1 = mask(lower, I(1));
+
+	I h0 = gather(perm, ii +           gather(perm, jj));
+	I h1 = gather(perm, ii + ii1 +     gather(perm, jj + I(1) - ii1));
+	I h2 = gather(perm, ii + I(1) +    gather(perm, jj + I(1)));
+
+	return (corner2(h0, x0, y0) + corner2(h1, x1, y1) + corner2(h2, x2, y2)) * F(45.0f);
+}
+
+static SIMD_INLINE F grad3 (I hash, F x, F y, F z) {
+	// the 12 cube edge directions (4 of them twice)
+	I h = hash & I(15);
+	F u = select(h < I(8), x, y);
+	F v = select(h < I(4), y, select((h == I(12)) | (h == I(14)), x, z));
+	return flip_sign(u, h & I(1)) + flip_sign(v, srl(h & I(2), 1));
+}
+
+static SIMD_INLINE F corner3 (I hash, F x, F y, F z) {
+	F t = max(F(0.6f) - x*x - y*y - z*z, F(0.0f));
+	t = t * t;
+	return t * t * grad3(hash, x, y, z);
+}
+
+static SIMD_INLINE F simplex3 (int const* perm, F x, F y, F z) {
+	const float F3 = 1.0f / 3.0f;
+	const float G3 = 1.0f / 6.0f;
+
+	F s = (x + y + z) * F(F3);
+	F xs = floor(x + s);
+	F ys = floor(y + s);
+	F zs = floor(z + s);
+	F t = (xs + ys + zs) * F(G3);
+	F x0 = x - (xs - t);
+	F y0 = y - (ys - t);
+	F z0 = z - (zs - t);
+
+	// which of the 6 tetrahedra: the second corner steps along the largest axis, the third along the two largest
+	M x_ge_y = x0 >= y0;
+	M y_ge_z = y0 >= z0;
+	M x_ge_z = x0 >= z0;
+
+	M i1 = x_ge_y & x_ge_z;
+	M j1 = andnot(y_ge_z, x_ge_y);
+	M k1 = ~(x_ge_z | y_ge_z);
+	M i2 = x_ge_y | x_ge_z;
+	M j2 = ~x_ge_y | y_ge_z;
+	M k2 = ~(x_ge_z & y_ge_z);
+
+	F x1 = x0 - mask(i1, F(1.0f)) + F(G3);
+	F y1 = y0 - mask(j1, F(1.0f)) + F(G3);
+	F z1 = z0 - mask(k1, F(1.0f)) + F(G3);
+	F x2 = x0 - mask(i2, F(1.0f)) + F(2.0f * G3);
+	F y2 = y0 - mask(j2, F(1.0f)) + F(2.0f * G3);
+	F z2 = z0 - mask(k2, F(1.0f)) + F(2.0f * G3);
+	F x3 = x0 - F(1.0f - 3.0f * G3);
+	F y3 = y0 - F(1.0f - 3.0f * G3);
+	F z3 = z0 - F(1.0f - 3.0f * G3);
+
+	I ii = to_int(xs) & I(255);
+	I jj = to_int(ys) & I(255);
+	I kk = to_int(zs) & I(255);
+
+	I h0 = gather(perm, ii +                 gather(perm, jj +                 gather(perm, kk)));
+	I h1 = gather(perm, ii + mask(i1, I(1)) + gather(perm, jj + mask(j1, I(1)) + gather(perm, kk + mask(k1, I(1)))));
+	I h2 = gather(perm, ii + mask(i2, I(1)) + gather(perm, jj + mask(j2, I(1)) + gather(perm, kk + mask(k2, I(1)))));
+	I h3 = gather(perm, ii + I(1) +          gather(perm, jj + I(1) +          gather(perm, kk + I(1))));
+
+	return (corner3(h0, x0, y0, z0) + corner3(h1, x1, y1, z1) + corner3(h2, x2, y2, z2) + corner3(h3, x3, y3, z3)) * F(32.0f);
+}
+
+//// value noise (random value per lattice point, quintic interpolation)
+
+static SIMD_INLINE F lattice_value (I hash) {
+	return to_float(hash) * F(2.0f / 255.0f) - F(1.0f);
+}
+
+static SIMD_INLINE F value2 (int const* perm, F x, F y) {
+	F xs = floor(x), ys = floor(y);
+	F fx = fade(x - xs), fy = fade(y - ys);
+
+	I ii = to_int(xs) & I(255);
+	I jj = to_int(ys) & I(255);
+
+	I a = gather(perm, jj);
+	I b = gather(perm, jj + I(1));
+
+	F v00 = lattice_value(gather(perm, ii + a));
+	F v10 = lattice_value(gather(perm, ii + I(1) + a));
+	F v01 = lattice_value(gather(perm, ii + b));
+	F v11 = lattice_value(gather(perm, ii + I(1) + b));
+
+	return simd::lerp(simd::lerp(v00, v10, fx), simd::lerp(v01, v11, fx), fy);
+}
+
+static SIMD_INLINE F value3 (int const* perm, F x, F y, F z) {
+	F xs = floor(x), ys = floor(y), zs = floor(z);
+	F fx = fade(x - xs), fy = fade(y - ys), fz = fade(z - zs);
+
+	I ii = to_int(xs) & I(255);
+	I jj = to_int(ys) & I(255);
+	I kk = to_int(zs) & I(255);
+
+	I c0 = gather(perm, kk);
+	I c1 = gather(perm, kk + I(1));
+	I b00 = gather(perm, jj + c0);
+	I b10 = gather(perm, jj + I(1) + c0);
+	I b01 = gather(perm, jj + c1);
+	I b11 = gather(perm, jj + I(1) + c1);
+
+	auto row = [&] (I b) {
+		return simd::lerp(lattice_value(gather(perm, ii + b)), lattice_value(gather(perm, ii + I(1) + b)), fx);
+	};
+	return simd::lerp(simd::lerp(row(b00), row(b10), fy), simd::lerp(row(b01), row(b11), fy), fz);
+}
+
+//// fbm
+
+// offset in noise space per octave (and per warp axis), so that the octaves do not all have a lattice point at the origin
+static constexpr float OCTAVE_OFFS_X = 17.31f, OCTAVE_OFFS_Y = 41.57f, OCTAVE_OFFS_Z = 73.19f;
+static constexpr int WARP_OCTAVE_BASE = 100;
+
+static FbmSettings warp_settings (FbmSettings const& s) {
+	FbmSettings w;
+	w.type = NOISE_SIMPLEX;
+	w.octaves = s.warp_octaves;
+	w.frequency = s.warp_frequency;
+	return w;
+}
+
+static SIMD_INLINE F fbm2_raw (int const* perm, F x, F y, FbmSettings const& s, int octave_base) {
+	F sum = F(0.0f);
+	float amp = 1, freq = s.frequency, norm = 0;
+	for (int o=0; o<s.octaves; ++o) {
+		float offs = (float)(octave_base + o);
+		F px = x * F(freq) + F(offs * OCTAVE_OFFS_X);
+		F py = y * F(freq) + F(offs * OCTAVE_OFFS_Y);
+		F n = s.type == NOISE_VALUE ? value2(perm, px, py) : simplex2(perm, px, py);
+		sum = sum + n * F(amp);
+		norm += amp;
+		amp *= s.gain;
+		freq *= s.lacunarity;
+	}
+	return norm > 0 ? sum * F(1.0f / norm) : sum;
+}
+static SIMD_INLINE F fbm3_raw (int const* perm, F x, F y, F z, FbmSettings const& s, int octave_base) {
+	F sum = F(0.0f);
+	float amp = 1, freq = s.frequency, norm = 0;
+	for (int o=0; o<s.octaves; ++o) {
+		float offs = (float)(octave_base + o);
+		F px = x * F(freq) + F(offs * OCTAVE_OFFS_X);
+		F py = y * F(freq) + F(offs * OCTAVE_OFFS_Y);
+		F pz = z * F(freq) + F(offs * OCTAVE_OFFS_Z);
+		F n = s.type == NOISE_VALUE ? value3(perm, px, py, pz) : simplex3(perm, px, py, pz);
+		sum = sum + n * F(amp);
+		norm += amp;
+		amp *= s.gain;
+		freq *= s.lacunarity;
+	}
+	return norm > 0 ? sum * F(1.0f / norm) : sum;
+}
+
+static SIMD_INLINE F fbm2 (int const* perm, F x, F y, FbmSettings const& s) {
+	if (s.warp_amplitude != 0) {
+		FbmSettings w = warp_settings(s);
+		F wx = fbm2_raw(perm, x, y, w, WARP_OCTAVE_BASE);
+		F wy = fbm2_raw(perm, x, y, w, WARP_OCTAVE_BASE * 2);
+		x = x + wx * F(s.warp_amplitude);
+		y = y + wy * F(s.warp_amplitude);
+	}
+	return fbm2_raw(perm, x, y, s, 0);
+}
+static SIMD_INLINE F fbm3 (int const* perm, F x, F y, F z, FbmSettings const& s) {
+	if (s.warp_amplitude != 0) {
+		FbmSettings w = warp_settings(s);
+		F wx = fbm3_raw(perm, x, y, z, w, WARP_OCTAVE_BASE);
+		F wy = fbm3_raw(perm, x, y, z, w, WARP_OCTAVE_BASE * 2);
+		F wz = fbm3_raw(perm, x, y, z, w, WARP_OCTAVE_BASE * 3);
+		x = x + wx * F(s.warp_amplitude);
+		y = y + wy * F(s.warp_amplitude);
+		z = z + wz * F(s.warp_amplitude);
+	}
+	return fbm3_raw(perm, x, y, z, s, 0);
+}
+
+//// single samples, lane 0 of the simd kernels
+
+float Noise::simplex (float2 p) const {			return simplex2(perm, F(p.x), F(p.y))[0]; }
+float Noise::simplex (float3 p) const {			return simplex3(perm, F(p.x), F(p.y), F(p.z))[0]; }
+float Noise::value (float2 p) const {			return value2(perm, F(p.x), F(p.y))[0]; }
+float Noise::value (float3 p) const {			return value3(perm, F(p.x), F(p.y), F(p.z))[0]; }
+
+float Noise::fbm (float2 p, FbmSettings const& s) const {	return fbm2(perm, F(p.x), F(p.y), s)[0]; }
+float Noise::fbm (float3 p, FbmSettings const& s) const {	return fbm3(perm, F(p.x), F(p.y), F(p.z), s)[0]; }
+
+//// grid fills
+
+static F lane_index () {
+	alignas(32) float idx[W];
+	for (int j=0; j<W; ++j)
+		idx[j] = (float)j;
+	return F::load(idx);
+}
+
+// store the first n lanes
+static SIMD_INLINE void store_row (F v, float* out, int n) {
+	if (n >= W) {
+		v.store(out);
+	} else {
+		alignas(32) float tmp[W];
+		v.store(tmp);
+		memcpy(out, tmp, n * sizeof(float));
+	}
+}
+
+void Noise::fill_fbm (float2 origin, float step, int2 size, FbmSettings const& s, float* out) const {
+	F lanes = lane_index();
+	for (int y=0; y<size.y; ++y) {
+		F py = F(origin.y + (float)y * step);
+		for (int x=0; x<size.x; x += W) {
+			F px = F(origin.x) + (F((float)x) + lanes) * F(step);
+			store_row(fbm2(perm, px, py, s), &out[y * size.x + x], size.x - x);
+		}
+	}
+}
+
+void Noise::fill_fbm (float3 origin, float step, int3 size, FbmSettings const& s, float* out) const {
+	F lanes = lane_index();
+	for (int z=0; z<size.z; ++z) {
+		F pz = F(origin.z + (float)z * step);
+		for (int y=0; y<size.y; ++y) {
+			F py = F(origin.y + (float)y * step);
+			for (int x=0; x<size.x; x += W) {
+				F px = F(origin.x) + (F((float)x) + lanes) * F(step);
+				store_row(fbm3(perm, px, py, pz, s), &out[(z * size.y + y) * size.x + x], size.x - x);
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "../kissmath.hpp"
+#include "stdint.h"
+
+enum NoiseType {
+	NOISE_SIMPLEX,
+	NOISE_VALUE,
+};
+
+// Fractal brownian motion: octaves of noise with increasing frequency and decreasing amplitude, normalized to about [-1,1]
+struct FbmSettings {
+	NoiseType	type = NOISE_SIMPLEX;
+	int			octaves = 4;
+	float		frequency = 1.0f / 64; // of the first octave (1 / feature size in voxels)
+	float		lacunarity = 2.0f; // frequency multiplier per octave
+	float		gain = 0.5f; // amplitude multiplier per octave
+
+	// domain warp: positions get offset by warp_amplitude * simplex fbm (warp_octaves at warp_frequency) before sampling, 0 disables it
+	float		warp_amplitude = 0;
+	float		warp_frequency = 1.0f / 128;
+	int			warp_octaves = 2;
+};
+
+// Seeded gradient (simplex) and value noise
+//  the fill functions evaluate a whole grid with simd kernels (8 lanes with avx2, 4 with sse2) along x, eg. the rows of a chunk
+//  every value is a pure function of the seed and its position, so it does not matter which thread fills which part of the world in which order
+class Noise {
+public:
+	// permutation of 0-255 repeated once, so that nested lookups perm[i + perm[j]] need no wrap, int for simd gathers
+	int perm[512];
+
+	Noise (uint64_t seed=0);
+
+	// single samples in about [-1,1]
+	float simplex (float2 p) const;
+	float simplex (float3 p) const;
+	float value (float2 p) const;
+	float value (float3 p) const;
+
+	float fbm (float2 p, FbmSettings const& s) const;
+	float fbm (float3 p, FbmSettings const& s) const;
+
+	// out[y * size.x + x] = fbm(origin + float2(x,y) * step)
+	void fill_fbm (float2 origin, float step, int2 size, FbmSettings const& s, float* out) const;
+	// out[(z * size.y + y) * size.x + x] = fbm(origin + float3(x,y,z) * step)
+	void fill_fbm (float3 origin, float step, int3 size, FbmSettings const& s, float* out) const;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "threadpool.hpp"
+#include <algorithm>
+
+// Threadpool for splitting batch kernels (see batch_transform.hpp, animation.hpp)
+//  the pool must not be used by other code at the same time (results of all jobs go into the same queue)
+struct BatchJob {
+	void	(*func)(void const* kernel, size_t begin, size_t end);
+	void const*	kernel;
+	size_t	begin, end;
+
+	int execute () {
+		func(kernel, begin, end);
+		return 0;
+	}
+};
+typedef Threadpool<BatchJob> BatchThreadpool;
+
+// run kernel(begin, end) over [0, n), split into chunks over the pool threads and this thread if there are at least 2*min_chunk elements
+//  chunk boundaries are multiples of align (eg. the simd width, so that only the last chunk has a tail)
+//  returns once all chunks are done
+template <typename KERNEL>
+inline void run_batch (KERNEL const& kernel, size_t n, size_t min_chunk, BatchThreadpool* pool, size_t align=1) {
+	int threads = pool ? pool->thread_count() : 0;
+
+	if (threads == 0 || n < min_chunk * 2) {
+		kernel((size_t)0, n);
+		return;
+	}
+
+	// a few chunks per thread, so that a preempted thread does not hold up the whole batch
+	size_t chunks = std::min((size_t)(threads + 1) * 2, n / min_chunk);
+	size_t chunk_size = (n + chunks - 1) / chunks;
+	chunk_size = (chunk_size + align - 1) / align * align;
+
+	auto func = [] (void const* k, size_t begin, size_t end) {
+		(*(KERNEL const*)k)(begin, end);
+	};
+
+	int count = 0;
+	for (size_t begin=0; begin < n; begin += chunk_size) {
+		pool->jobs.push({ func, &kernel, begin, std::min(begin + chunk_size, n) });
+		count++;
+	}
+
+	pool->contribute_work();
+
+	for (int i=0; i<count; ++i)
+		pool->results.pop();
+}
@@ -0,0 +1,182 @@
+#undef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include "profiler.hpp"
+#include "alloc_tracking.hpp"
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <stdio.h>
+
+namespace profiler {
+	struct ThreadInfo {
+		std::unique_ptr<ThreadBuffer>	buf;
+		std::string						name;
+	};
+
+	struct Registry {
+		std::mutex				m;
+		std::vector<ThreadInfo>	threads;
+
+		// ticks and kiss::get_timestamp at startup, to calibrate the tick rate at export
+		uint64_t				start_ticks;
+		uint64_t				start_timestamp;
+
+		Registry (): start_ticks{ticks()}, start_timestamp{kiss::get_timestamp()} {}
+	};
+
+	// never destroyed, threads might still record zones during static destruction
+	static Registry& get_registry () {
+		static Registry* reg = new Registry();
+		return *reg;
+	}
+	// start the calibration at startup and not on the first zone
+	static Registry& _init_registry = get_registry();
+
+	static ThreadBuffer* add_thread (Registry& reg, std::string name) {
+		ALLOC_TAG("profiler"); // not to whatever the thread was doing when it recorded its first event
+
+		auto buf = std::make_unique<ThreadBuffer>();
+		thread_buffer = buf.get();
+
+		if (name.empty())
+			name = "thread " + std::to_string(reg.threads.size());
+		reg.threads.push_back({ std::move(buf), std::move(name) });
+		return thread_buffer;
+	}
+
+	ThreadBuffer* register_thread () {
+		auto& reg = get_registry();
+		std::lock_guard<std::mutex> lock(reg.m);
+		return add_thread(reg, "");
+	}
+
+	void set_thread_name (std::string_view name) {
+		auto& reg = get_registry();
+		std::lock_guard<std::mutex> lock(reg.m);
+
+		if (!thread_buffer) {
+			add_thread(reg, std::string(name));
+			return;
+		}
+		for (auto& t : reg.threads) {
+			if (t.buf.get() == thread_buffer)
+				t.name = name;
+		}
+	}
+
+	double ticks_per_second () {
+		auto& reg = get_registry();
+		uint64_t now_ticks = ticks();
+		uint64_t now_timestamp = kiss::get_timestamp();
+
+		double seconds = (double)(now_timestamp - reg.start_timestamp) / (double)kiss::timestamp_freq;
+		return seconds > 0 ? (double)(now_ticks - reg.start_ticks) / seconds : 1e9;
+	}
+
+	static void write_json_string (FILE* f, const char* str) {
+		fputc('"', f);
+		for (const char* c = str; *c; ++c) {
+			if (*c == '"' || *c == '\\')
+				fputc('\\', f);
+			if ((unsigned char)*c >= 0x20)
+				fputc(*c, f);
+		}
+		fputc('"', f);
+	}
+
+	struct ThreadSnapshot {
+		std::string			name;
+		std::vector<Event>	events;
+	};
+
+	// copy the ring, then drop what the thread might have overwritten during the copy (like a seqlock read)
+	static void snapshot_ring (ThreadBuffer const& buf, std::vector<Event>* out) {
+		uint64_t head = buf.head.load(std::memory_order_acquire);
+		uint64_t begin = head - std::min(head, ThreadBuffer::RING_SIZE);
+
+		out->resize((size_t)(head - begin));
+		for (uint64_t i=begin; i<head; ++i)
+			(*out)[(size_t)(i - begin)] = buf.events[i & (ThreadBuffer::RING_SIZE - 1)];
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64_t head_after = buf.head.load(std::memory_order_relaxed);
+
+		// the event at head_after might be in the middle of being written
+		uint64_t valid_begin = head_after + 1 > ThreadBuffer::RING_SIZE ? head_after + 1 - ThreadBuffer::RING_SIZE : 0;
+		if (valid_begin > begin)
+			out->erase(out->begin(), out->begin() + (size_t)std::min(valid_begin - begin, head - begin));
+	}
+
+	bool write_chrome_trace (const char* filename, float last_seconds) {
+		auto& reg = get_registry();
+
+		double tps = ticks_per_second();
+		double ticks_per_us = tps * 1e-6;
+		uint64_t now = ticks();
+		uint64_t since = 0;
+		if (last_seconds > 0 && (double)(now - reg.start_ticks) > last_seconds * tps)
+			since = now - (uint64_t)(last_seconds * tps);
+
+		// only hold the lock for the copies, not the file writes
+		std::vector<ThreadSnapshot> threads;
+		{
+			std::lock_guard<std::mutex> lock(reg.m);
+			threads.resize(reg.threads.size());
+			for (size_t i=0; i<reg.threads.size(); ++i) {
+				threads[i].name = reg.threads[i].name;
+				snapshot_ring(*reg.threads[i].buf, &threads[i].events);
+			}
+		}
+
+		FILE* f = fopen(filename, "wb");
+		if (!f)
+			return false;
+
+		size_t gpu_tid = threads.size(); // gpu events of all threads go onto one extra track
+		auto us = [&] (uint64_t t) { return (double)(int64_t)(t - reg.start_ticks) / ticks_per_us; };
+
+		fprintf(f, "{\"traceEvents\":[\n");
+		fprintf(f, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":\"gpu\"}}", gpu_tid);
+
+		for (size_t tid=0; tid<threads.size(); ++tid) {
+			auto& t = threads[tid];
+
+			fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":", tid);
+			write_json_string(f, t.name.c_str());
+			fprintf(f, "}}");
+
+			for (auto& e : t.events) {
+				bool has_end = e.type == EV_ZONE || e.type == EV_GPU;
+				if ((has_end ? e.value : e.begin) < since)
+					continue;
+
+				fprintf(f, ",\n{\"name\":");
+				write_json_string(f, e.name);
+
+				switch (e.type) {
+					case EV_ZONE:
+					case EV_GPU: {
+						fprintf(f, ",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+							e.type == EV_GPU ? gpu_tid : tid, us(e.begin), (double)(e.value - e.begin) / ticks_per_us);
+					} break;
+
+					case EV_ALLOC: {
+						fprintf(f, ",\"cat\":\"alloc\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"args\":{\"size\":%llu,\"ptr\":\"%p\"}}",
+							tid, us(e.begin), (unsigned long long)e.value, e.ptr);
+					} break;
+
+					case EV_FREE: {
+						fprintf(f, ",\"cat\":\"free\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"args\":{\"ptr\":\"%p\"}}",
+							tid, us(e.begin), e.ptr);
+					} break;
+				}
+			}
+		}
+
+		fprintf(f, "\n]}\n");
+		return fclose(f) == 0;
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include "stdint.h"
+#include <atomic>
+#include <string_view>
+#include "timer.hpp"
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+// set to 0 to compile all profiler macros to nothing
+#ifndef PROFILER_ENABLE
+	#define PROFILER_ENABLE 1
+#endif
+
+// Low overhead cpu profiler
+//  PROFILE_SCOPED("name") / PROFILE_FUNCTION() record a zone from there to the end of the scope
+//  PROFILE_FRAME() records a "frame" zone since the last call on the same thread
+//  PROFILE_ALLOC("name", ptr, size) / PROFILE_FREE("name", ptr) record allocations, profiler::gpu_zone() records gpu timings
+//  threads get their name from set_thread_description (threadpool threads get theirs from the threadpool)
+//  profiler::write_chrome_trace() writes all recorded events as json for chrome://tracing or https://ui.perfetto.dev
+// Recording
+//  each thread owns a ring of the last RING_SIZE events, only that thread writes to it, so there are no locks or atomic read-modify-writes
+//  zones take a timestamp (rdtsc where available) on construction and on destruction and write the finished zone in the destructor (~10-15ns per zone)
+//  the rings always hold the recent history, which is what the FlightRecorder dumps when a frame spikes
+//  event names are not copied, they have to stay valid until the export (string literals)
+namespace profiler {
+	// raw timestamp of events, converted to time at export by calibrating against kiss::get_timestamp
+	inline uint64_t ticks () {
+	#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+		return __rdtsc(); // invariant tsc on any cpu of the last decade, ~20 cycles vs ~20-30ns for QueryPerformanceCounter / clock_gettime
+	#else
+		return kiss::get_timestamp();
+	#endif
+	}
+
+	// ticks per second, from the ticks since startup
+	double ticks_per_second ();
+
+	enum EventType : uint32_t {
+		EV_ZONE,
+		EV_ALLOC,
+		EV_FREE,
+		EV_GPU, // gpu work, exported as its own track
+	};
+
+	struct Event {
+		uint64_t	begin;
+		uint64_t	value; // EV_ZONE / EV_GPU: end ticks  EV_ALLOC: size in bytes
+		const char*	name;
+		void const*	ptr; // EV_ALLOC / EV_FREE
+		EventType	type;
+	};
+
+	struct ThreadBuffer {
+		static constexpr uint64_t RING_SIZE = 1 << 16; // power of two
+
+		// events written in total, event i is at events[i % RING_SIZE] until it gets overwritten by event i + RING_SIZE
+		std::atomic<uint64_t>	head { 0 };
+		uint64_t				last_frame = 0;
+		Event					events[RING_SIZE];
+
+		void push (Event const& e) {
+			uint64_t h = head.load(std::memory_order_relaxed);
+			events[h & (RING_SIZE - 1)] = e;
+			head.store(h + 1, std::memory_order_release); // publish to the exporting thread
+		}
+	};
+
+	// inline, so that the compiler sees the constant initialization and accesses it directly instead of through a tls wrapper function
+	inline thread_local ThreadBuffer* thread_buffer = nullptr;
+
+	// allocate the buffer of the current thread on its first zone
+	ThreadBuffer* register_thread ();
+
+	inline ThreadBuffer* get_thread_buffer () {
+		ThreadBuffer* buf = thread_buffer;
+		if (!buf)
+			buf = register_thread();
+		return buf;
+	}
+
+	struct ScopedZone {
+		const char*	name;
+		uint64_t	begin;
+
+		ScopedZone (const char* name): name{name}, begin{ticks()} {}
+		~ScopedZone () {
+			uint64_t end = ticks();
+			get_thread_buffer()->push({ begin, end, name, nullptr, EV_ZONE });
+		}
+	};
+
+	inline void frame () {
+		uint64_t now = ticks();
+		ThreadBuffer* buf = get_thread_buffer();
+		if (buf->last_frame != 0)
+			buf->push({ buf->last_frame, now, "frame", nullptr, EV_ZONE });
+		buf->last_frame = now;
+	}
+
+	inline void record_alloc (const char* name, void const* ptr, size_t size) {
+		get_thread_buffer()->push({ ticks(), (uint64_t)size, name, ptr, EV_ALLOC });
+	}
+	inline void record_free (const char* name, void const* ptr) {
+		get_thread_buffer()->push({ ticks(), 0, name, ptr, EV_FREE });
+	}
+
+	// gpu work that started at begin_ticks (cpu ticks, gpu timestamps have to be mapped by the caller, eg. the submit time) and took seconds on the gpu
+	inline void gpu_zone (const char* name, uint64_t begin_ticks, double seconds) {
+		uint64_t end = begin_ticks + (uint64_t)(seconds * ticks_per_second());
+		get_thread_buffer()->push({ begin_ticks, end, name, nullptr, EV_GPU });
+	}
+
+	// name of the current thread in the trace (called by set_thread_description)
+	void set_thread_name (std::string_view name);
+
+	// write the events currently in the rings of all threads as chrome trace event json
+	//  last_seconds > 0 only writes events that ended within the last seconds
+	//  can be called while other threads are still recording (from any thread), events that get overwritten during the export are left out
+	bool write_chrome_trace (const char* filename, float last_seconds=0);
+}
+
+#if PROFILER_ENABLE
+	#define _PROFILE_CONCAT2(a, b) a##b
+	#define _PROFILE_CONCAT(a, b) _PROFILE_CONCAT2(a, b)
+
+	#define PROFILE_SCOPED(name)	profiler::ScopedZone _PROFILE_CONCAT(_profile_zone_, __LINE__) (name)
+	#define PROFILE_FUNCTION()		PROFILE_SCOPED(__FUNCTION__)
+	#define PROFILE_FRAME()			profiler::frame()
+	#define PROFILE_ALLOC(name, ptr, size)	profiler::record_alloc(name, ptr, size)
+	#define PROFILE_FREE(name, ptr)			profiler::record_free(name, ptr)
+#else
+	#define PROFILE_SCOPED(name)
+	#define PROFILE_FUNCTION()
+	#define PROFILE_FRAME()
+	#define PROFILE_ALLOC(name, ptr, size)
+	#define PROFILE_FREE(name, ptr)
+#endif
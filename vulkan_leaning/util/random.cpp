@@ -1,5 +1,6 @@
 #include "random.hpp"
 #include "timer.hpp"
+#include "wide_math.hpp"
 
 // seed global rng with time
 uint64_t _get_initial_random_seed () {
@@ -7,3 +8,197 @@ uint64_t _get_initial_random_seed () {
 }
 
 Random random = Random( _get_initial_random_seed() );
+
+// bulk generation always uses the widest native lane type
+typedef WideLanes<SIMD_MAX_WIDTH>::float_t	F;
+typedef F::int_t							I;
+typedef float3_wide<F>						V;
+static constexpr int W = F::WIDTH;
+
+static_assert(W <= BulkRandom::MAX_LANES, "");
+
+//// BulkRandom
+
+// xoshiro128+ (Blackman & Vigna) in every lane, the top bits are used for floats, the low 4 bits are weak
+struct XoshiroLanes {
+	I s0, s1, s2, s3;
+
+	SIMD_INLINE XoshiroLanes (BulkRandom const& r):
+		s0{I::load((int const*)r.s[0])}, s1{I::load((int const*)r.s[1])}, s2{I::load((int const*)r.s[2])}, s3{I::load((int const*)r.s[3])} {}
+
+	SIMD_INLINE void save (BulkRandom& r) const {
+		s0.store((int*)r.s[0]);
+		s1.store((int*)r.s[1]);
+		s2.store((int*)r.s[2]);
+		s3.store((int*)r.s[3]);
+	}
+
+	SIMD_INLINE I next () {
+		I result = s0 + s3;
+		I t = s1 << 9;
+
+		s2 = s2 ^ s0;
+		s3 = s3 ^ s1;
+		s1 = s1 ^ s2;
+		s0 = s0 ^ s3;
+		s2 = s2 ^ t;
+		s3 = (s3 << 11) | srl(s3, 21);
+
+		return result;
+	}
+};
+
+// [0,1) from the top 23 bits, like bits_to_float01
+static SIMD_INLINE F to_float01 (I bits) {
+	return as_float(srl(bits, 9) | I(0x3f800000)) - F(1.0f);
+}
+
+BulkRandom::BulkRandom (uint64_t seed) {
+	for (int lane=0; lane<MAX_LANES; lane += 2) {
+		for (int k=0; k<4; ++k) {
+			uint64_t x = splitmix64(&seed);
+			s[k][lane    ] = (uint32_t)x;
+			s[k][lane + 1] = (uint32_t)(x >> 32);
+		}
+	}
+}
+
+void BulkRandom::fill_u32 (uint32_t* out, size_t n) {
+	XoshiroLanes r (*this);
+	size_t i = 0;
+	for (; i + W <= n; i += W)
+		r.next().store((int*)&out[i]);
+	if (i < n) {
+		alignas(32) int tmp[W];
+		r.next().store(tmp);
+		memcpy(&out[i], tmp, (n - i) * sizeof(uint32_t));
+	}
+	r.save(*this);
+}
+
+void BulkRandom::fill_uniform (float* out, size_t n, float min, float max) {
+	XoshiroLanes r (*this);
+	F offs = F(min), scale = F(max - min);
+	size_t i = 0;
+	for (; i + W <= n; i += W)
+		(offs + to_float01(r.next()) * scale).store(&out[i]);
+	if (i < n) {
+		alignas(32) float tmp[W];
+		(offs + to_float01(r.next()) * scale).store(tmp);
+		memcpy(&out[i], tmp, (n - i) * sizeof(float));
+	}
+	r.save(*this);
+}
+
+// uniform z gives a uniform distribution on the sphere (archimedes), the angle around z only needs a quarter circle:
+//  cos/sin of [-pi/4, pi/4) by taylor polynomials (error < 3e-7), then 2 random bits swap x/y and flip the sign of the cos part
+static SIMD_INLINE V on_sphere (XoshiroLanes& r, F radius) {
+	I r0 = r.next();
+	I r1 = r.next();
+
+	F z = to_float01(r0) * F(2.0f) - F(1.0f);
+	F ang = to_float01(r1) * F(PI * 0.5f) - F(PI * 0.25f);
+
+	F a2 = ang * ang;
+	F s = ang * (F(1.0f) + a2 * (F(-1.0f/6) + a2 * (F(1.0f/120) + a2 * F(-1.0f/5040))));
+	F c = F(1.0f) + a2 * (F(-1.0f/2) + a2 * (F(1.0f/24) + a2 * (F(-1.0f/720) + a2 * F(1.0f/40320))));
+
+	F rxy = sqrt(max(F(1.0f) - z * z, F(0.0f))) * radius;
+	F a = rxy * c;
+	F b = rxy * s;
+
+	// bits 7 and 8 are not used by z
+	a = as_float(as_int(a) ^ ((r0 << 24) & I((int)0x80000000)));
+	auto swap = (r0 & I(1 << 8)) == I(1 << 8);
+
+	return { select(swap, b, a), select(swap, a, b), z * radius };
+}
+
+void BulkRandom::fill_on_sphere (float3* out, size_t n, float radius) {
+	XoshiroLanes r (*this);
+	F rad = F(radius);
+	size_t i = 0;
+	for (; i + W <= n; i += W)
+		on_sphere(r, rad).store(&out[i]);
+	if (i < n)
+		on_sphere(r, rad).store_n(&out[i], (int)(n - i));
+	r.save(*this);
+}
+
+//// Philox
+
+// full 32x32 -> 64 bit multiply of every lane with m
+#if SIMD_HAS_AVX2
+static SIMD_INLINE void mulhilo (simd::i32x8 a, uint32_t m, simd::i32x8* hi, simd::i32x8* lo) {
+	__m256i mv = _mm256_set1_epi32((int)m);
+	__m256i even = _mm256_mul_epu32(a.v, mv); // products of lanes 0 2 4 6 as 64 bit
+	__m256i odd  = _mm256_mul_epu32(_mm256_srli_epi64(a.v, 32), mv); // lanes 1 3 5 7
+	__m256i low_mask = _mm256_set1_epi64x(0xffffffff);
+	lo->v = _mm256_or_si256(_mm256_and_si256(even, low_mask), _mm256_slli_epi64(odd, 32));
+	hi->v = _mm256_or_si256(_mm256_srli_epi64(even, 32), _mm256_andnot_si256(low_mask, odd));
+}
+#endif
+#if SIMD_HAS_SSE2
+static SIMD_INLINE void mulhilo (simd::i32x4 a, uint32_t m, simd::i32x4* hi, simd::i32x4* lo) {
+	__m128i mv = _mm_set1_epi32((int)m);
+	__m128i even = _mm_mul_epu32(a.v, mv);
+	__m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a.v, 32), mv);
+	__m128i low_mask = _mm_set_epi32(0, -1, 0, -1);
+	lo->v = _mm_or_si128(_mm_and_si128(even, low_mask), _mm_slli_epi64(odd, 32));
+	hi->v = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(low_mask, odd));
+}
+#else
+static inline void mulhilo (simd::i32x4 a, uint32_t m, simd::i32x4* hi, simd::i32x4* lo) {
+	for (int i=0; i<4; ++i)
+		Philox::mulhilo((uint32_t)a.v[i], m, (uint32_t*)&hi->v[i], (uint32_t*)&lo->v[i]);
+}
+#endif
+
+// Philox::block() for the W consecutive counters starting at counter, word k of lane j in c[k][j]
+static SIMD_INLINE void philox_lanes (uint64_t key, uint64_t counter, I c[4]) {
+	alignas(32) int ctr_lo[W], ctr_hi[W];
+	for (int j=0; j<W; ++j) {
+		ctr_lo[j] = (int)(uint32_t)(counter + j);
+		ctr_hi[j] = (int)(uint32_t)((counter + j) >> 32);
+	}
+
+	I c0 = I::load(ctr_lo), c1 = I::load(ctr_hi), c2 = I(0), c3 = I(0);
+	uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+	for (int r=0; r<10; ++r) {
+		I hi0, lo0, hi1, lo1;
+		mulhilo(c0, 0xD2511F53u, &hi0, &lo0);
+		mulhilo(c2, 0xCD9E8D57u, &hi1, &lo1);
+		c0 = hi1 ^ c1 ^ I((int)k0);
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ I((int)k1);
+		c3 = lo0;
+		k0 += 0x9E3779B9u;
+		k1 += 0xBB67AE85u;
+	}
+	c[0] = c0;	c[1] = c1;	c[2] = c2;	c[3] = c3;
+}
+
+void Philox::fill_uniform (float* out, size_t n, uint64_t first, float min, float max) const {
+	size_t j = 0;
+	// scalar up to the start of a group of 16 values
+	for (; j < n && ((first + j) & 15) != 0; ++j)
+		out[j] = uniform(first + j, min, max);
+
+	// the W lanes are W/4 groups, lanes 4g..4g+3 are the counters of group g and their word k are the values 16g+4k..16g+4k+3
+	F offs = F(min), scale = F(max - min);
+	for (; j + 4*W <= n; j += 4*W) {
+		I c[4];
+		philox_lanes(key, (first + j) / 4, c);
+
+		alignas(32) float vals[4][W];
+		for (int k=0; k<4; ++k)
+			(offs + to_float01(c[k]) * scale).store(vals[k]);
+		for (int g=0; g<W/4; ++g) {
+			for (int k=0; k<4; ++k)
+				memcpy(&out[j + 16*g + 4*k], &vals[k][4*g], 4 * sizeof(float));
+		}
+	}
+
+	for (; j < n; ++j)
+		out[j] = uniform(first + j, min, max);
+}
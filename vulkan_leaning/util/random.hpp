@@ -1,13 +1,168 @@
 #pragma once
 #include "../kissmath.hpp"
+#include "stdint.h"
 #include <random>
+#include <cstring>
+#include <algorithm>
+
+//// Engines
+// small state generators, both are UniformRandomBitGenerators, so they also work with the std distributions
+
+// seed expansion, gives well mixed state from any seed (including 0)
+inline uint64_t splitmix64 (uint64_t* state) {
+	uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+	return z ^ (z >> 31);
+}
+
+// xoshiro256++ (Blackman & Vigna), 256 bit state, 64 bit output
+struct Xoshiro256pp {
+	typedef uint64_t result_type;
+
+	uint64_t s[4];
+
+	Xoshiro256pp (uint64_t seed=0) {
+		for (auto& x : s)
+			x = splitmix64(&seed);
+	}
+
+	static constexpr result_type min () { return 0; }
+	static constexpr result_type max () { return UINT64_MAX; }
+
+	static inline uint64_t rotl (uint64_t x, int k) {
+		return (x << k) | (x >> (64 - k));
+	}
+
+	inline uint64_t operator() () {
+		uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+		uint64_t t = s[1] << 17;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 45);
+
+		return result;
+	}
+};
+
+// PCG32 XSH RR (O'Neill), 64 bit state, 32 bit output
+//  for when a lot of generators are needed (eg. one per chunk or entity), generators with the same seed but different streams give independent sequences
+struct Pcg32 {
+	typedef uint32_t result_type;
+
+	uint64_t state;
+	uint64_t inc; // always odd
+
+	Pcg32 (uint64_t seed=0, uint64_t stream=0): state{0}, inc{(stream << 1) | 1} {
+		(*this)();
+		state += seed;
+		(*this)();
+	}
+
+	static constexpr result_type min () { return 0; }
+	static constexpr result_type max () { return UINT32_MAX; }
+
+	inline uint32_t operator() () {
+		uint64_t old = state;
+		state = old * 6364136223846793005ull + inc;
+		uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+		uint32_t rot = (uint32_t)(old >> 59);
+		return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+	}
+};
+
+//// Mapping random bits to ranges, branchless
+
+// [0,1) from the top 23 bits (exponent of 1.0 + random mantissa - 1)
+inline float bits_to_float01 (uint32_t bits) {
+	uint32_t i = (bits >> 9) | 0x3f800000u;
+	float f;
+	memcpy(&f, &i, sizeof(f));
+	return f - 1.0f;
+}
+// [0,range) by a fixed point multiply (Lemire) instead of modulo or a rejection loop
+//  biased by at most range / 2^32, which does not matter for the ranges used in games
+inline uint32_t bits_to_range (uint32_t bits, uint32_t range) {
+	return (uint32_t)(((uint64_t)bits * range) >> 32);
+}
+
+//// Bulk generation (simd, see random.cpp)
+
+// xoshiro128+ with an independent state per simd lane, generates a full register of values per step
+//  for filling large arrays, which is much faster than calling _Random per value
+struct BulkRandom {
+	static constexpr int MAX_LANES = 8;
+
+	alignas(32) uint32_t s[4][MAX_LANES];
+
+	BulkRandom (uint64_t seed);
+
+	void fill_u32 (uint32_t* out, size_t n);
+	// out[i] in [min,max)
+	void fill_uniform (float* out, size_t n, float min=0, float max=1);
+	// out[i] uniformly distributed on the sphere (z uniform and a polynomial sin/cos of a uniform angle, no rejection)
+	void fill_on_sphere (float3* out, size_t n, float radius=1);
+};
+
+// Philox 4x32-10 (Salmon et al.), counter based: value i is a pure function of (key, i), there is no state to advance
+//  so threads can generate any part of one sequence independently and the result does not depend on how the work was split
+//  value i is word (i/4)%4 of the block of counter (i/16)*4 + i%4, so that simd lanes of consecutive counters store contiguously
+struct Philox {
+	uint64_t key;
+
+	Philox (uint64_t key): key{key} {}
+
+	static inline void mulhilo (uint32_t a, uint32_t b, uint32_t* hi, uint32_t* lo) {
+		uint64_t p = (uint64_t)a * b;
+		*hi = (uint32_t)(p >> 32);
+		*lo = (uint32_t)p;
+	}
+
+	inline void block (uint64_t counter, uint32_t out[4]) const {
+		uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32), c2 = 0, c3 = 0;
+		uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+		for (int r=0; r<10; ++r) {
+			uint32_t hi0, lo0, hi1, lo1;
+			mulhilo(0xD2511F53u, c0, &hi0, &lo0);
+			mulhilo(0xCD9E8D57u, c2, &hi1, &lo1);
+			c0 = hi1 ^ c1 ^ k0;
+			c1 = lo1;
+			c2 = hi0 ^ c3 ^ k1;
+			c3 = lo0;
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		out[0] = c0;	out[1] = c1;	out[2] = c2;	out[3] = c3;
+	}
+
+	inline uint32_t u32 (uint64_t i) const {
+		uint32_t b[4];
+		block((i >> 4) * 4 + (i & 3), b);
+		return b[(i >> 2) & 3];
+	}
+	inline float uniform (uint64_t i, float min=0, float max=1) const {
+		return min + (max - min) * bits_to_float01(u32(i));
+	}
+
+	// out[j] = uniform(first + j)
+	void fill_uniform (float* out, size_t n, uint64_t first=0, float min=0, float max=1) const;
+};
+
+//// Generator with the usual distributions
 
 template <typename ENGINE>
 struct _Random {
 	ENGINE generator;
 
+	static_assert(ENGINE::min() == 0 && (ENGINE::max() == UINT32_MAX || ENGINE::max() == UINT64_MAX), "engine needs to produce full 32 or 64 bit values");
+	static constexpr bool ENGINE_64 = ENGINE::max() == UINT64_MAX;
+
 	_Random (); // seed with random value from global rng
-	_Random (uint64_t seed): generator{(unsigned int)seed} {} // seed with value
+	_Random (uint64_t seed): generator(seed) {} // seed with value
 
 	template <typename DISTRIBUTION>
 	inline auto generate (DISTRIBUTION distr) {
@@ -15,65 +170,63 @@ struct _Random {
 	}
 
 	inline uint32_t uniform_u32 () {
-		static_assert(sizeof(uint32_t) == sizeof(int), "");
-		std::uniform_int_distribution<int> distribution (std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
-		return (uint32_t)generate(distribution);
+		if constexpr (ENGINE_64)
+			return (uint32_t)(generator() >> 32); // upper bits are the better ones for xoshiro
+		else
+			return (uint32_t)generator();
 	}
 	inline uint64_t uniform_u64 () {
-		return (uint64_t)uniform_u32() << 32ull | (uint64_t)uniform_u32();
+		if constexpr (ENGINE_64)
+			return (uint64_t)generator();
+		else
+			return (uint64_t)uniform_u32() << 32ull | (uint64_t)uniform_u32();
 	}
 
 	inline bool chance (float prob=0.5f) {
-		std::bernoulli_distribution	distribution (prob);
-		return generate(distribution);
+		return uniform() < prob;
 	}
 
+	// [min,max)
 	inline int uniform (int min, int max) {
-		std::uniform_int_distribution<int> distribution (min, max -1);
-		return generate(distribution);
+		return min + (int)bits_to_range(uniform_u32(), (uint32_t)(max - min));
 	}
 
+	// [min,max)
 	inline float uniform (float min=0, float max=1) {
-		std::uniform_real_distribution<float>	distribution (min, max);
-		return generate(distribution);
+		return min + (max - min) * bits_to_float01(uniform_u32());
 	}
 
+	// box-muller (only the cos half, so no state is kept between calls)
 	inline float normal (float stddev, float mean=0) {
-		std::normal_distribution<float> distribution (mean, stddev);
-		return generate(distribution);
+		float u0 = 1.0f - uniform(); // (0,1] for the log
+		float u1 = uniform();
+		return mean + stddev * std::sqrt(-2.0f * std::log(u0)) * std::cos(2.0f * PI * u1);
 	}
 
-	inline bool2  chance2  (float2 prob=0.5f            ) { return bool2( uniform(prob)        , uniform(prob)        ); }
-	inline int2   uniform2 (int2   min  ,  int2   max   ) { return int2(  uniform(min, max)    , uniform(min, max)    ); }
-	inline float  uniform2 (int2   min=0,  float2 max=1 ) { return int2(  uniform(min, max)    , uniform(min, max)    ); }
-	inline float2 normal2  (float2 stddev, float2 mean=0) { return float2(uniform(stddev, mean), uniform(stddev, mean)); }
+	inline bool2  chance2  (float2 prob=0.5f             ) { return bool2( chance(prob.x)               , chance(prob.y)               ); }
+	inline int2   uniform2 (int2   min  ,  int2   max    ) { return int2(  uniform(min.x, max.x)        , uniform(min.y, max.y)        ); }
+	inline float2 uniform2 (float2 min=0,  float2 max=1  ) { return float2(uniform(min.x, max.x)        , uniform(min.y, max.y)        ); }
+	inline float2 normal2  (float2 stddev, float2 mean=0 ) { return float2(normal(stddev.x, mean.x)     , normal(stddev.y, mean.y)     ); }
 
-	inline bool3  chance3  (float3 prob=0.5f            ) { return bool3( uniform(prob)        , uniform(prob)        , uniform(prob)        ); }
-	inline int3   uniform3 (int3   min  ,  int3   max   ) { return int3(  uniform(min, max)    , uniform(min, max)    , uniform(min, max)    ); }
-	inline float  uniform3 (int3   min=0,  float3 max=1 ) { return int3(  uniform(min, max)    , uniform(min, max)    , uniform(min, max)    ); }
-	inline float3 normal3  (float3 stddev, float3 mean=0) { return float3(uniform(stddev, mean), uniform(stddev, mean), uniform(stddev, mean)); }
+	inline bool3  chance3  (float3 prob=0.5f             ) { return bool3( chance(prob.x)               , chance(prob.y)               , chance(prob.z)               ); }
+	inline int3   uniform3 (int3   min  ,  int3   max    ) { return int3(  uniform(min.x, max.x)        , uniform(min.y, max.y)        , uniform(min.z, max.z)        ); }
+	inline float3 uniform3 (float3 min=0,  float3 max=1  ) { return float3(uniform(min.x, max.x)        , uniform(min.y, max.y)        , uniform(min.z, max.z)        ); }
+	inline float3 normal3  (float3 stddev, float3 mean=0 ) { return float3(normal(stddev.x, mean.x)     , normal(stddev.y, mean.y)     , normal(stddev.z, mean.z)     ); }
 
-	inline bool4  chance4  (float4 prob=0.5f            ) { return bool4( uniform(prob)        , uniform(prob)        , uniform(prob)        , uniform(prob)        ); }
-	inline int4   uniform4 (int4   min  ,  int4   max   ) { return int4(  uniform(min, max)    , uniform(min, max)    , uniform(min, max)    , uniform(min, max)    ); }
-	inline float  uniform4 (int4   min=0,  float4 max=1 ) { return int4(  uniform(min, max)    , uniform(min, max)    , uniform(min, max)    , uniform(min, max)    ); }
-	inline float4 normal4  (float4 stddev, float4 mean=0) { return float4(uniform(stddev, mean), uniform(stddev, mean), uniform(stddev, mean), uniform(stddev, mean)); }
+	inline bool4  chance4  (float4 prob=0.5f             ) { return bool4( chance(prob.x)               , chance(prob.y)               , chance(prob.z)               , chance(prob.w)               ); }
+	inline int4   uniform4 (int4   min  ,  int4   max    ) { return int4(  uniform(min.x, max.x)        , uniform(min.y, max.y)        , uniform(min.z, max.z)        , uniform(min.w, max.w)        ); }
+	inline float4 uniform4 (float4 min=0,  float4 max=1  ) { return float4(uniform(min.x, max.x)        , uniform(min.y, max.y)        , uniform(min.z, max.z)        , uniform(min.w, max.w)        ); }
+	inline float4 normal4  (float4 stddev, float4 mean=0 ) { return float4(normal(stddev.x, mean.x)     , normal(stddev.y, mean.y)     , normal(stddev.z, mean.z)     , normal(stddev.w, mean.w)     ); }
 
-	inline float3 uniform_in_sphere (float radius) {
-		float3 pos;
-		do {
-			pos = uniform3(-radius, +radius);
-		} while (length_sqr(pos) > radius*radius);
-		return pos;
-	}
+	// uniform z and angle around z (archimedes), no rejection loop
 	inline float3 uniform_on_sphere (float radius) {
-		float3 pos;
-		float len;
-		do {
-			pos = uniform3(-radius, +radius);
-			len = length_sqr(pos);
-		} while (len > 1 || len == 0.0f);
-		
-		return pos / sqrt(len) * radius;
+		float z = uniform(-1.0f, +1.0f);
+		float ang = uniform(0.0f, 2.0f * PI);
+		float r = std::sqrt(std::max(1.0f - z*z, 0.0f));
+		return float3(r * std::cos(ang), r * std::sin(ang), z) * radius;
+	}
+	inline float3 uniform_in_sphere (float radius) {
+		return uniform_on_sphere(radius * std::cbrt(uniform()));
 	}
 
 	inline float3 uniform_direction () {
@@ -82,33 +235,20 @@ struct _Random {
 	inline float3 uniform_vector (float min_magnitude=0, float max_magnitude=1) {
 		return uniform_direction() * uniform(min_magnitude, max_magnitude);
 	}
+
+	// bulk versions, the simd generator is seeded from this one, so a seeded _Random still gives reproducible results
+	inline void fill_uniform (float* out, size_t n, float min=0, float max=1) {
+		BulkRandom(uniform_u64()).fill_uniform(out, n, min, max);
+	}
+	inline void fill_on_sphere (float3* out, size_t n, float radius=1) {
+		BulkRandom(uniform_u64()).fill_on_sphere(out, n, radius);
+	}
 };
 
-typedef _Random<std::default_random_engine> Random;
+typedef _Random<Xoshiro256pp> Random;
 
 // Global random number generator
 extern Random random;
 
 template <typename T>
-_Random<T>::_Random (): _Random(random.uniform_u32()) {} // just use 32 bits because engine only takes u32 seed anyway
-
-#if 0
-struct Fast_Rand {
-	int seed;
-	static constexpr int rand_max = 0x7FFF;
-
-	Fast_Rand (int seed): seed{seed} {}
-
-	inline int fastrand() { 
-		// https://stackoverflow.com/questions/1640258/need-a-fast-random-generator-for-c
-		seed = (214013*seed+2531011); 
-		return (seed>>16)&0x7FFF; 
-	} 
-
-	inline float uniform (float min, float max) {
-		int i = fastrand();
-		float f = (float)i / (float)rand_max;
-		return lerp(min, max, f);
-	}
-};
-#endif
+_Random<T>::_Random (): _Random(random.uniform_u64()) {}
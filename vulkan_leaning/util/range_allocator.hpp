@@ -0,0 +1,66 @@
+#pragma once
+#include "stdint.h"
+#include "assert.h"
+#include <vector>
+
+// Sub-allocates ranges of one big buffer, eg. the faces of each chunk in one gpu buffer, in units of elements (not bytes)
+//  sizes are rounded up to a power of two (at least MIN_SIZE), freed ranges go into a free list of their size and get reused by the next range of the same size
+//  new ranges are appended at end(), the buffer needs to be at least end() elements big
+//  no splitting or merging, so up to half of a range and the free ranges are wasted, fine for many ranges of similar sizes that get reallocated often
+class RangeAllocator {
+public:
+	static constexpr uint32_t MIN_SIZE = 64;
+
+	struct Range {
+		uint32_t	offset = 0;
+		uint32_t	size = 0; // 0 -> nothing allocated
+	};
+
+	static uint32_t round_size (uint32_t count) {
+		if (count == 0)
+			return 0;
+		uint32_t size = MIN_SIZE;
+		while (size < count)
+			size <<= 1;
+		return size;
+	}
+
+	Range alloc (uint32_t count) {
+		Range r;
+		r.size = round_size(count);
+		if (r.size == 0)
+			return r;
+
+		auto& list = free_lists[size_index(r.size)];
+		if (!list.empty()) {
+			r.offset = list.back();
+			list.pop_back();
+		} else {
+			r.offset = end_offset;
+			end_offset += r.size;
+		}
+		return r;
+	}
+	void free (Range r) {
+		if (r.size == 0)
+			return;
+		free_lists[size_index(r.size)].push_back(r.offset);
+	}
+
+	// elements used by ranges and free lists
+	uint32_t end () const {
+		return end_offset;
+	}
+
+private:
+	std::vector<uint32_t>	free_lists[32]; // offsets of free ranges, by log2 of their size
+	uint32_t				end_offset = 0;
+
+	static int size_index (uint32_t size) {
+		assert(size >= MIN_SIZE && (size & (size - 1)) == 0);
+		int i = 0;
+		while ((1u << i) < size)
+			i++;
+		return i;
+	}
+};
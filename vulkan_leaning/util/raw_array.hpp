@@ -1,13 +1,17 @@
 #pragma once
 #include "stdlib.h"
 #include "assert.h"
-#include "optick.h"
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include "profiler.hpp"
+#include "alloc_tracking.hpp"
 
 namespace {
-	size_t _min (size_t a, size_t b) {
+	inline size_t _min (size_t a, size_t b) {
 		return a < b ? a : b;
 	}
-	size_t _max (size_t a, size_t b) {
+	inline size_t _max (size_t a, size_t b) {
 		return a > b ? a : b;
 	}
 }
@@ -24,33 +28,29 @@ struct UnsafeArray {
 	inline UnsafeArray () {}
 
 	inline UnsafeArray (size_t size) {
-		ptr = (T*)malloc(size * sizeof(T));
+		ptr = (T*)alloc_tracking::malloc(size * sizeof(T));
 		this->size = size;
+		PROFILE_ALLOC("UnsafeArray", ptr, size * sizeof(T));
 	}
 	inline ~UnsafeArray () {
-		if (ptr)
-			free(ptr);
+		if (ptr) {
+			PROFILE_FREE("UnsafeArray", ptr);
+			alloc_tracking::free(ptr);
+		}
 	}
 
+	// keeps the first min(size, new_size) elements, realloc can resize in place
 	inline void resize (size_t new_size) {
 		if (new_size == size)
 			return;
 
-		// get old
-		T* old_ptr = ptr;
-		T* old_size = size;
+		if (ptr) {
+			PROFILE_FREE("UnsafeArray", ptr);
+		}
 
-		// alloc new
-		ptr = (T*)malloc(new_size * sizeof(T));
+		ptr = (T*)alloc_tracking::realloc(ptr, new_size * sizeof(T));
 		size = new_size;
-
-		if (old_ptr) {
-			// copy old elements into new
-			memcpy(ptr, old_ptr, _min(size, old_size) * sizeof(T));
-
-			// free old
-			free(old_ptr);
-		}
+		PROFILE_ALLOC("UnsafeArray", ptr, new_size * sizeof(T));
 	}
 
 	inline T const& operator[] (size_t index) const {
@@ -86,58 +86,54 @@ struct UnsafeVector {
 
 	// empty vector, with initial allocation
 	inline UnsafeVector (size_t capacity, float grow_fac=DEFAULT_GROW_FAC) {
-		OPTICK_EVENT("alloc UnsafeVector::malloc");
+		PROFILE_SCOPED("alloc UnsafeVector::malloc");
 
 		capacity = _max(capacity, MIN_CAP);
 
 		this->capacity = capacity;
-		_grow_capacity(size);
 
-		this->ptr = (T*)malloc(this->capacity * sizeof(T));
+		this->ptr = (T*)alloc_tracking::malloc(this->capacity * sizeof(T));
 		this->grow_fac = grow_fac;
+		PROFILE_ALLOC("UnsafeVector", this->ptr, this->capacity * sizeof(T));
 	}
 	inline ~UnsafeVector () {
-		OPTICK_EVENT("alloc UnsafeVector::free");
+		PROFILE_SCOPED("alloc UnsafeVector::free");
 
-		if (ptr)
-			free(ptr);
+		if (ptr) {
+			PROFILE_FREE("UnsafeVector", ptr);
+			alloc_tracking::free(ptr);
+		}
 	}
 
 private:
-	// grow capacity to fit new size
-	inline void _grow_capacity (size_t new_size) {
-		while (capacity < new_size)
-			capacity = (size_t)roundf( (float)capacity * grow_fac );
+	// capacity that fits new_size
+	inline size_t _grown_capacity (size_t new_size) {
+		size_t cap = _max(capacity, MIN_CAP);
+		while (cap < new_size)
+			cap = _max((size_t)((float)cap * grow_fac), cap + 1);
+		return cap;
 	}
 
+	// elements are moved with memcpy (T has to be trivially copyable anyway), so realloc can move them instead
+	//  which grows in place when the memory after the block is free and uses mremap for big blocks on linux, ie. no copy at all
 	inline void _change_capacity (size_t new_cap) {
 		if (new_cap == capacity)
 			return;
-		
-		// get old
-		T* old_ptr = ptr;
-		size_t old_cap = capacity;
 
-		// alloc new
+		if (ptr) {
+			PROFILE_FREE("UnsafeVector", ptr);
+		}
+
 		if (new_cap == 0) {
+			alloc_tracking::free(ptr);
 			ptr = nullptr;
 		} else {
-			OPTICK_EVENT("alloc UnsafeVector::_change_capacity.malloc");
-			ptr = (T*)malloc(new_cap * sizeof(T));
+			PROFILE_SCOPED("alloc UnsafeVector::_change_capacity.realloc");
+			ptr = (T*)alloc_tracking::realloc(ptr, new_cap * sizeof(T));
+			PROFILE_ALLOC("UnsafeVector", ptr, new_cap * sizeof(T));
 		}
 
 		capacity = new_cap;
-
-		if (old_ptr) {
-			{
-				OPTICK_EVENT("alloc UnsafeVector::_change_capacity.memcpy");
-				// copy old elements into new
-				memcpy(ptr, old_ptr, _min(capacity, old_cap) * sizeof(T));
-			}
-			OPTICK_EVENT("alloc UnsafeVector::_change_capacity.free");
-			// free old
-			free(old_ptr);
-		}
 	}
 public:
 
@@ -146,20 +142,19 @@ public:
 		this->size = new_size;
 
 		if (new_size > capacity) {
-			OPTICK_EVENT("alloc UnsafeVector::resize");
+			PROFILE_SCOPED("alloc UnsafeVector::resize");
 
-			_grow_capacity(new_size);
-			_change_capacity(capacity);
+			_change_capacity(_grown_capacity(new_size));
 		}
 	}
 	inline void shrink_to_fit () {
-		OPTICK_EVENT("alloc UnsafeVector::shrink_to_fit");
+		PROFILE_SCOPED("alloc UnsafeVector::shrink_to_fit");
 
 		_change_capacity(size);
 	}
 
 	inline void push_back (T val) {
-		int old_size = size;
+		size_t old_size = size;
 		resize(size + 1);
 		ptr[old_size] = std::move(val);
 	}
@@ -187,3 +182,136 @@ public:
 	inline UnsafeVector (UnsafeVector&& r) {			swap(*this, r); }
 	inline UnsafeVector& operator= (UnsafeVector&& r) {	swap(*this, r); return *this; }
 };
+
+// std::vector style array that stores up to N elements inline and only allocates when it grows past that
+// for short lists (chunk palettes, per object components) where the heap allocation would cost more than the list itself
+// WARNING: like UnsafeVector does not call constructors or destructors, T has to be trivially copyable
+template <typename T, size_t N>
+struct SmallVector {
+	static_assert(std::is_trivially_copyable<T>::value, "SmallVector only supports trivially copyable types");
+	static_assert(N > 0, "");
+
+	T* ptr = (T*)inline_storage;
+	size_t size = 0;
+	size_t capacity = N;
+	alignas(T) char inline_storage[N * sizeof(T)];
+
+	inline SmallVector () {}
+	inline ~SmallVector () {
+		if (!is_inline()) {
+			PROFILE_FREE("SmallVector", ptr);
+			alloc_tracking::free(ptr);
+		}
+	}
+
+	inline bool is_inline () const {
+		return ptr == (T const*)inline_storage;
+	}
+
+private:
+	inline void _change_capacity (size_t new_cap) {
+		if (new_cap <= N) {
+			// back to inline storage
+			if (!is_inline()) {
+				T* old_ptr = ptr;
+				memcpy(inline_storage, old_ptr, size * sizeof(T));
+				ptr = (T*)inline_storage;
+
+				PROFILE_FREE("SmallVector", old_ptr);
+				alloc_tracking::free(old_ptr);
+			}
+			capacity = N;
+			return;
+		}
+
+		PROFILE_SCOPED("alloc SmallVector::_change_capacity");
+		if (is_inline()) {
+			ptr = (T*)alloc_tracking::malloc(new_cap * sizeof(T));
+			memcpy(ptr, inline_storage, size * sizeof(T));
+		} else {
+			PROFILE_FREE("SmallVector", ptr);
+			ptr = (T*)alloc_tracking::realloc(ptr, new_cap * sizeof(T));
+		}
+		PROFILE_ALLOC("SmallVector", ptr, new_cap * sizeof(T));
+		capacity = new_cap;
+	}
+public:
+
+	// never shrinks capacity
+	inline void resize (size_t new_size) {
+		if (new_size > capacity)
+			_change_capacity(_max(new_size, capacity * 2));
+		size = new_size;
+	}
+	inline void clear () {
+		size = 0;
+	}
+	// frees the heap memory if the elements fit inline again
+	inline void shrink_to_fit () {
+		_change_capacity(size);
+	}
+
+	inline void push_back (T val) {
+		if (size == capacity)
+			_change_capacity(capacity * 2);
+		ptr[size++] = val;
+	}
+	inline void pop_back () {
+		assert(size > 0);
+		size--;
+	}
+
+	inline T const& operator[] (size_t index) const {
+		assert(index < size);
+		return ptr[index];
+	}
+	inline T& operator[] (size_t index) {
+		assert(index < size);
+		return ptr[index];
+	}
+
+	inline T* begin () { return ptr; }
+	inline T* end () { return ptr + size; }
+	inline T const* begin () const { return ptr; }
+	inline T const* end () const { return ptr + size; }
+
+	// copy
+	inline SmallVector (SmallVector const& r) {
+		*this = r;
+	}
+	inline SmallVector& operator= (SmallVector const& r) {
+		if (this != &r) {
+			size = 0;
+			resize(r.size);
+			memcpy(ptr, r.ptr, r.size * sizeof(T));
+		}
+		return *this;
+	}
+	// move, steals the heap memory, inline elements have to be copied
+	inline SmallVector (SmallVector&& r) {
+		*this = std::move(r);
+	}
+	inline SmallVector& operator= (SmallVector&& r) {
+		if (this == &r)
+			return *this;
+
+		if (r.is_inline()) {
+			size = 0;
+			resize(r.size);
+			memcpy(ptr, r.ptr, r.size * sizeof(T));
+		} else {
+			if (!is_inline()) {
+				PROFILE_FREE("SmallVector", ptr);
+				alloc_tracking::free(ptr);
+			}
+			ptr = r.ptr;
+			capacity = r.capacity;
+			size = r.size;
+
+			r.ptr = (T*)r.inline_storage;
+			r.capacity = N;
+		}
+		r.size = 0;
+		return *this;
+	}
+};
@@ -1,66 +1,50 @@
 #pragma once
-#include "circular_buffer.hpp"
+#include "streaming_stats.hpp"
 
-// Running average with circular buffer
+// Running average over the last values
 //  resize allowed (although the array loses it's values then)
-//  avg is simply sum(values) / count
+//  all stats are updated on push (see StreamingStats), so calc_avg and calc_percentile are O(1) no matter the count
 //  T should probably be a float type
 template <typename T=float>
 class RunningAverage {
-	circular_buffer<T> buf;
+	StreamingStats<T> stats;
 public:
 
 	T* data () {
-		return buf.data();
+		return stats.values().data();
 	}
 	size_t capacity () {
-		return buf.capacity();
+		return stats.capacity();
 	}
 	size_t count () {
-		return buf.count();
+		return stats.count();
 	}
 
-	RunningAverage (int initial_count) {
-		buf.resize(initial_count);
-	}
+	RunningAverage (int initial_count): stats{(size_t)initial_count} {}
 
 	void resize (int new_count) {
-		buf.resize(new_count);
+		stats.resize((size_t)new_count);
 	}
 
 	void push (T val) {
-		buf.push(val);
+		stats.push(val);
 	}
 
 	T calc_avg (T* out_min=nullptr, T* out_max=nullptr, T* out_std_dev=nullptr) {
-		T total = 0;
-
-		for (size_t i=0; i<buf.count(); ++i) {
-			auto val = buf.get_oldest(i);
-			total += val;
+		if (stats.count() > 0) {
+			if (out_min) *out_min = stats.min();
+			if (out_max) *out_max = stats.max();
 		}
+		if (out_std_dev) *out_std_dev = stats.std_dev();
+		return stats.mean();
+	}
 
-		T mean = total / (T)buf.count();
-
-		if (out_min || out_max || out_std_dev) {
-			T min = +INF;
-			T max = -INF;
-			T variance = 0;
-
-			for (size_t i=0; i<buf.count(); ++i) {
-				auto val = buf.get_oldest(i);
-
-				min = std::min(min, val);
-				max = std::max(max, val);
-
-				T tmp = val - mean;
-				variance += tmp*tmp;
-			}
+	// approximate value that the fraction p (0-1) of the values are at or below (see LogHistogram)
+	T calc_percentile (float p) {
+		return stats.count() > 0 ? stats.percentile(p) : (T)0;
+	}
 
-			if (out_min) *out_min = min;
-			if (out_max) *out_max = max;
-			if (out_std_dev) *out_std_dev = std::sqrt(variance / ((T)buf.count() - 1));
-		}
-		return mean;
+	StreamingStats<T> const& get_stats () const {
+		return stats;
 	}
 };
@@ -0,0 +1,488 @@
+#pragma once
+#include "stdint.h"
+
+// Thin wrappers around simd registers, so that batch kernels can be written with operators instead of raw intrinsics
+//  f32x4 / i32x4 / m32x4  are 4 lanes of float / int / lane mask (always available, sse2 or scalar fallback)
+//  f32x8 / i32x8 / m32x8  are 8 lanes (only if compiled with avx2, check SIMD_HAS_AVX2)
+//  f32x16                 is 16 lanes as a f32_pair of two 8 lane (or four 4 lane) registers
+// every lane type has  WIDTH, int_t, float_t and mask_t  so templated kernels can be written once and instantiated for both widths
+// masks are all-ones or all-zero per lane like the sse compare instructions produce them, bits() packs them into an int like movemask
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define SIMD_HAS_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define SIMD_HAS_SSE2 0 // scalar fallback (NEON could be added here)
+	#include <cmath>
+	#include <cstring>
+#endif
+
+#if defined(__AVX2__)
+	#define SIMD_HAS_AVX2 1
+	#include <immintrin.h>
+#else
+	#define SIMD_HAS_AVX2 0
+#endif
+
+// widest lane count available for float kernels
+#define SIMD_MAX_WIDTH (SIMD_HAS_AVX2 ? 8 : 4)
+
+#if defined(_MSC_VER)
+	#define SIMD_INLINE __forceinline
+#else
+	#define SIMD_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace simd {
+	struct f32x4;
+	struct i32x4;
+	struct m32x4;
+
+#if SIMD_HAS_SSE2
+	struct m32x4 {
+		__m128 v;
+
+		static constexpr int WIDTH = 4;
+
+		SIMD_INLINE m32x4 () = default;
+		SIMD_INLINE m32x4 (__m128 v): v{v} {}
+		SIMD_INLINE m32x4 (__m128i v): v{_mm_castsi128_ps(v)} {}
+
+		SIMD_INLINE static m32x4 all_true () {	return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+		SIMD_INLINE static m32x4 all_false () {	return _mm_setzero_ps(); }
+		// lane i is true if bit i is set
+		SIMD_INLINE static m32x4 from_bits (int bits) {
+			__m128i lane_bits = _mm_set_epi32(8,4,2,1);
+			return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(bits), lane_bits), lane_bits);
+		}
+
+		SIMD_INLINE int bits () const {	return _mm_movemask_ps(v); }
+		SIMD_INLINE __m128i as_int () const { return _mm_castps_si128(v); }
+	};
+
+	SIMD_INLINE m32x4 operator& (m32x4 l, m32x4 r) {	return _mm_and_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator| (m32x4 l, m32x4 r) {	return _mm_or_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator^ (m32x4 l, m32x4 r) {	return _mm_xor_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator~ (m32x4 m) {			return _mm_xor_ps(m.v, m32x4::all_true().v); }
+	// l & ~r
+	SIMD_INLINE m32x4 andnot (m32x4 l, m32x4 r) {	return _mm_andnot_ps(r.v, l.v); }
+
+	struct f32x4 {
+		__m128 v;
+
+		static constexpr int WIDTH = 4;
+		typedef float	scalar_t;
+		typedef f32x4	float_t;
+		typedef i32x4	int_t;
+		typedef m32x4	mask_t;
+
+		SIMD_INLINE f32x4 () = default;
+		SIMD_INLINE f32x4 (__m128 v): v{v} {}
+		SIMD_INLINE f32x4 (float all): v{_mm_set1_ps(all)} {}
+		SIMD_INLINE f32x4 (float a, float b, float c, float d): v{_mm_setr_ps(a,b,c,d)} {}
+
+		SIMD_INLINE static f32x4 load (float const* p) {	return _mm_loadu_ps(p); }
+		SIMD_INLINE void store (float* p) const {			_mm_storeu_ps(p, v); }
+
+		SIMD_INLINE float operator[] (int i) const {
+			alignas(16) float tmp[4];
+			_mm_store_ps(tmp, v);
+			return tmp[i];
+		}
+	};
+
+	SIMD_INLINE f32x4 operator- (f32x4 v) {				return _mm_xor_ps(v.v, _mm_set1_ps(-0.0f)); }
+	SIMD_INLINE f32x4 operator+ (f32x4 l, f32x4 r) {	return _mm_add_ps(l.v, r.v); }
+	SIMD_INLINE f32x4 operator- (f32x4 l, f32x4 r) {	return _mm_sub_ps(l.v, r.v); }
+	SIMD_INLINE f32x4 operator* (f32x4 l, f32x4 r) {	return _mm_mul_ps(l.v, r.v); }
+	SIMD_INLINE f32x4 operator/ (f32x4 l, f32x4 r) {	return _mm_div_ps(l.v, r.v); }
+
+	SIMD_INLINE m32x4 operator<  (f32x4 l, f32x4 r) {	return _mm_cmplt_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator<= (f32x4 l, f32x4 r) {	return _mm_cmple_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator>  (f32x4 l, f32x4 r) {	return _mm_cmpgt_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator>= (f32x4 l, f32x4 r) {	return _mm_cmpge_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator== (f32x4 l, f32x4 r) {	return _mm_cmpeq_ps(l.v, r.v); }
+	SIMD_INLINE m32x4 operator!= (f32x4 l, f32x4 r) {	return _mm_cmpneq_ps(l.v, r.v); }
+
+	SIMD_INLINE f32x4 min (f32x4 l, f32x4 r) {			return _mm_min_ps(l.v, r.v); }
+	SIMD_INLINE f32x4 max (f32x4 l, f32x4 r) {			return _mm_max_ps(l.v, r.v); }
+	SIMD_INLINE f32x4 abs (f32x4 v) {					return _mm_andnot_ps(_mm_set1_ps(-0.0f), v.v); }
+	SIMD_INLINE f32x4 sqrt (f32x4 v) {					return _mm_sqrt_ps(v.v); }
+
+	// componentwise ternary (c ? l : r)
+	SIMD_INLINE f32x4 select (m32x4 c, f32x4 l, f32x4 r) {
+		return _mm_or_ps(_mm_and_ps(c.v, l.v), _mm_andnot_ps(c.v, r.v));
+	}
+	// zero lanes where c is false
+	SIMD_INLINE f32x4 mask (m32x4 c, f32x4 v) {		return _mm_and_ps(c.v, v.v); }
+
+	SIMD_INLINE f32x4 floor (f32x4 v) {
+		// sse2 has no round instruction, truncate and correct negative values (only valid for |v| < 2^31)
+		__m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(v.v));
+		return _mm_sub_ps(t, _mm_and_ps(_mm_cmplt_ps(v.v, t), _mm_set1_ps(1.0f)));
+	}
+
+	struct i32x4 {
+		__m128i v;
+
+		static constexpr int WIDTH = 4;
+		typedef int		scalar_t;
+		typedef f32x4	float_t;
+		typedef i32x4	int_t;
+		typedef m32x4	mask_t;
+
+		SIMD_INLINE i32x4 () = default;
+		SIMD_INLINE i32x4 (__m128i v): v{v} {}
+		SIMD_INLINE i32x4 (int all): v{_mm_set1_epi32(all)} {}
+		SIMD_INLINE i32x4 (int a, int b, int c, int d): v{_mm_setr_epi32(a,b,c,d)} {}
+
+		SIMD_INLINE static i32x4 load (int const* p) {	return _mm_loadu_si128((__m128i const*)p); }
+		SIMD_INLINE void store (int* p) const {			_mm_storeu_si128((__m128i*)p, v); }
+
+		SIMD_INLINE int operator[] (int i) const {
+			alignas(16) int tmp[4];
+			_mm_store_si128((__m128i*)tmp, v);
+			return tmp[i];
+		}
+	};
+
+	SIMD_INLINE i32x4 operator+ (i32x4 l, i32x4 r) {	return _mm_add_epi32(l.v, r.v); }
+	SIMD_INLINE i32x4 operator- (i32x4 l, i32x4 r) {	return _mm_sub_epi32(l.v, r.v); }
+	SIMD_INLINE i32x4 operator& (i32x4 l, i32x4 r) {	return _mm_and_si128(l.v, r.v); }
+	SIMD_INLINE i32x4 operator| (i32x4 l, i32x4 r) {	return _mm_or_si128(l.v, r.v); }
+	SIMD_INLINE i32x4 operator^ (i32x4 l, i32x4 r) {	return _mm_xor_si128(l.v, r.v); }
+	SIMD_INLINE i32x4 operator>> (i32x4 l, int r) {		return _mm_srai_epi32(l.v, r); }
+	SIMD_INLINE i32x4 operator<< (i32x4 l, int r) {		return _mm_slli_epi32(l.v, r); }
+	SIMD_INLINE i32x4 srl (i32x4 l, int r) {			return _mm_srli_epi32(l.v, r); } // logical shift right
+
+	SIMD_INLINE m32x4 operator== (i32x4 l, i32x4 r) {	return _mm_cmpeq_epi32(l.v, r.v); }
+	SIMD_INLINE m32x4 operator<  (i32x4 l, i32x4 r) {	return _mm_cmplt_epi32(l.v, r.v); }
+	SIMD_INLINE m32x4 operator>  (i32x4 l, i32x4 r) {	return _mm_cmpgt_epi32(l.v, r.v); }
+
+	SIMD_INLINE i32x4 select (m32x4 c, i32x4 l, i32x4 r) {
+		__m128i ci = c.as_int();
+		return _mm_or_si128(_mm_and_si128(ci, l.v), _mm_andnot_si128(ci, r.v));
+	}
+	SIMD_INLINE i32x4 mask (m32x4 c, i32x4 v) {		return _mm_and_si128(c.as_int(), v.v); }
+
+	// float -> int with truncation
+	SIMD_INLINE i32x4 to_int (f32x4 v) {				return _mm_cvttps_epi32(v.v); }
+	SIMD_INLINE f32x4 to_float (i32x4 v) {			return _mm_cvtepi32_ps(v.v); }
+	// reinterpret bits
+	SIMD_INLINE i32x4 as_int (f32x4 v) {				return _mm_castps_si128(v.v); }
+	SIMD_INLINE f32x4 as_float (i32x4 v) {			return _mm_castsi128_ps(v.v); }
+
+	// table lookup per lane, base[idx[i]]
+	SIMD_INLINE i32x4 gather (int const* base, i32x4 idx) {
+		alignas(16) int i[4];
+		_mm_store_si128((__m128i*)i, idx.v);
+		return _mm_setr_epi32(base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+	}
+#else
+	//// Scalar fallback, same interface, lets the compiler vectorize if it can
+
+	struct m32x4 {
+		int32_t v[4];
+
+		static constexpr int WIDTH = 4;
+
+		static m32x4 all_true () {	return {{-1,-1,-1,-1}}; }
+		static m32x4 all_false () {	return {{0,0,0,0}}; }
+		static m32x4 from_bits (int bits) {
+			return {{ -(bits & 1), -((bits >> 1) & 1), -((bits >> 2) & 1), -((bits >> 3) & 1) }};
+		}
+
+		int bits () const {	return (v[0] & 1) | (v[1] & 2) | (v[2] & 4) | (v[3] & 8); }
+	};
+
+	inline m32x4 operator& (m32x4 l, m32x4 r) {	m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] & r.v[i]; return o; }
+	inline m32x4 operator| (m32x4 l, m32x4 r) {	m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] | r.v[i]; return o; }
+	inline m32x4 operator^ (m32x4 l, m32x4 r) {	m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] ^ r.v[i]; return o; }
+	inline m32x4 operator~ (m32x4 m) {			m32x4 o; for (int i=0; i<4; ++i) o.v[i] = ~m.v[i]; return o; }
+	inline m32x4 andnot (m32x4 l, m32x4 r) {	m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] & ~r.v[i]; return o; }
+
+	struct f32x4 {
+		float v[4];
+
+		static constexpr int WIDTH = 4;
+		typedef float	scalar_t;
+		typedef f32x4	float_t;
+		typedef i32x4	int_t;
+		typedef m32x4	mask_t;
+
+		f32x4 () = default;
+		f32x4 (float all): v{all,all,all,all} {}
+		f32x4 (float a, float b, float c, float d): v{a,b,c,d} {}
+
+		static f32x4 load (float const* p) {	return f32x4(p[0], p[1], p[2], p[3]); }
+		void store (float* p) const {			for (int i=0; i<4; ++i) p[i] = v[i]; }
+
+		float operator[] (int i) const {		return v[i]; }
+	};
+
+	#define _SIMD_F_OP(op) inline f32x4 operator op (f32x4 l, f32x4 r) { f32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] op r.v[i]; return o; }
+	#define _SIMD_F_CMP(op) inline m32x4 operator op (f32x4 l, f32x4 r) { m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] op r.v[i] ? -1 : 0; return o; }
+	_SIMD_F_OP(+) _SIMD_F_OP(-) _SIMD_F_OP(*) _SIMD_F_OP(/)
+	_SIMD_F_CMP(<) _SIMD_F_CMP(<=) _SIMD_F_CMP(>) _SIMD_F_CMP(>=) _SIMD_F_CMP(==) _SIMD_F_CMP(!=)
+	#undef _SIMD_F_OP
+	#undef _SIMD_F_CMP
+
+	inline f32x4 operator- (f32x4 v) {			f32x4 o; for (int i=0; i<4; ++i) o.v[i] = -v.v[i]; return o; }
+	inline f32x4 min (f32x4 l, f32x4 r) {		f32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] < r.v[i] ? l.v[i] : r.v[i]; return o; }
+	inline f32x4 max (f32x4 l, f32x4 r) {		f32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] > r.v[i] ? l.v[i] : r.v[i]; return o; }
+	inline f32x4 abs (f32x4 v) {				f32x4 o; for (int i=0; i<4; ++i) o.v[i] = v.v[i] < 0 ? -v.v[i] : v.v[i]; return o; }
+	inline f32x4 sqrt (f32x4 v) {				f32x4 o; for (int i=0; i<4; ++i) o.v[i] = std::sqrt(v.v[i]); return o; }
+	inline f32x4 floor (f32x4 v) {				f32x4 o; for (int i=0; i<4; ++i) o.v[i] = std::floor(v.v[i]); return o; }
+	inline f32x4 select (m32x4 c, f32x4 l, f32x4 r) { f32x4 o; for (int i=0; i<4; ++i) o.v[i] = c.v[i] ? l.v[i] : r.v[i]; return o; }
+	inline f32x4 mask (m32x4 c, f32x4 v) {		return select(c, v, 0.0f); }
+
+	struct i32x4 {
+		int v[4];
+
+		static constexpr int WIDTH = 4;
+		typedef int		scalar_t;
+		typedef f32x4	float_t;
+		typedef i32x4	int_t;
+		typedef m32x4	mask_t;
+
+		i32x4 () = default;
+		i32x4 (int all): v{all,all,all,all} {}
+		i32x4 (int a, int b, int c, int d): v{a,b,c,d} {}
+
+		static i32x4 load (int const* p) {		return i32x4(p[0], p[1], p[2], p[3]); }
+		void store (int* p) const {				for (int i=0; i<4; ++i) p[i] = v[i]; }
+
+		int operator[] (int i) const {			return v[i]; }
+	};
+
+	#define _SIMD_I_OP(op) inline i32x4 operator op (i32x4 l, i32x4 r) { i32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] op r.v[i]; return o; }
+	#define _SIMD_I_CMP(op) inline m32x4 operator op (i32x4 l, i32x4 r) { m32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] op r.v[i] ? -1 : 0; return o; }
+	_SIMD_I_OP(+) _SIMD_I_OP(-) _SIMD_I_OP(&) _SIMD_I_OP(|) _SIMD_I_OP(^)
+	_SIMD_I_CMP(==) _SIMD_I_CMP(<) _SIMD_I_CMP(>)
+	#undef _SIMD_I_OP
+	#undef _SIMD_I_CMP
+
+	inline i32x4 operator>> (i32x4 l, int r) {	i32x4 o; for (int i=0; i<4; ++i) o.v[i] = l.v[i] >> r; return o; }
+	inline i32x4 operator<< (i32x4 l, int r) {	i32x4 o; for (int i=0; i<4; ++i) o.v[i] = (int)((uint32_t)l.v[i] << r); return o; }
+	inline i32x4 srl (i32x4 l, int r) {			i32x4 o; for (int i=0; i<4; ++i) o.v[i] = (int)((uint32_t)l.v[i] >> r); return o; }
+	inline i32x4 select (m32x4 c, i32x4 l, i32x4 r) { i32x4 o; for (int i=0; i<4; ++i) o.v[i] = c.v[i] ? l.v[i] : r.v[i]; return o; }
+	inline i32x4 mask (m32x4 c, i32x4 v) {		return select(c, v, 0); }
+
+	inline i32x4 to_int (f32x4 v) {				i32x4 o; for (int i=0; i<4; ++i) o.v[i] = (int)v.v[i]; return o; }
+	inline f32x4 to_float (i32x4 v) {			f32x4 o; for (int i=0; i<4; ++i) o.v[i] = (float)v.v[i]; return o; }
+	inline i32x4 as_int (f32x4 v) {				i32x4 o; memcpy(o.v, v.v, sizeof(o.v)); return o; }
+	inline f32x4 as_float (i32x4 v) {			f32x4 o; memcpy(o.v, v.v, sizeof(o.v)); return o; }
+	inline i32x4 gather (int const* base, i32x4 idx) {	i32x4 o; for (int i=0; i<4; ++i) o.v[i] = base[idx.v[i]]; return o; }
+#endif
+
+#if SIMD_HAS_AVX2
+	struct f32x8;
+	struct i32x8;
+
+	struct m32x8 {
+		__m256 v;
+
+		static constexpr int WIDTH = 8;
+
+		SIMD_INLINE m32x8 () = default;
+		SIMD_INLINE m32x8 (__m256 v): v{v} {}
+		SIMD_INLINE m32x8 (__m256i v): v{_mm256_castsi256_ps(v)} {}
+
+		SIMD_INLINE static m32x8 all_true () {	return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+		SIMD_INLINE static m32x8 all_false () {	return _mm256_setzero_ps(); }
+		SIMD_INLINE static m32x8 from_bits (int bits) {
+			__m256i lane_bits = _mm256_setr_epi32(1,2,4,8,16,32,64,128);
+			return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(bits), lane_bits), lane_bits);
+		}
+
+		SIMD_INLINE int bits () const {	return _mm256_movemask_ps(v); }
+		SIMD_INLINE __m256i as_int () const { return _mm256_castps_si256(v); }
+	};
+
+	SIMD_INLINE m32x8 operator& (m32x8 l, m32x8 r) {	return _mm256_and_ps(l.v, r.v); }
+	SIMD_INLINE m32x8 operator| (m32x8 l, m32x8 r) {	return _mm256_or_ps(l.v, r.v); }
+	SIMD_INLINE m32x8 operator^ (m32x8 l, m32x8 r) {	return _mm256_xor_ps(l.v, r.v); }
+	SIMD_INLINE m32x8 operator~ (m32x8 m) {			return _mm256_xor_ps(m.v, m32x8::all_true().v); }
+	SIMD_INLINE m32x8 andnot (m32x8 l, m32x8 r) {	return _mm256_andnot_ps(r.v, l.v); }
+
+	struct f32x8 {
+		__m256 v;
+
+		static constexpr int WIDTH = 8;
+		typedef float	scalar_t;
+		typedef f32x8	float_t;
+		typedef i32x8	int_t;
+		typedef m32x8	mask_t;
+
+		SIMD_INLINE f32x8 () = default;
+		SIMD_INLINE f32x8 (__m256 v): v{v} {}
+		SIMD_INLINE f32x8 (float all): v{_mm256_set1_ps(all)} {}
+
+		SIMD_INLINE static f32x8 load (float const* p) {	return _mm256_loadu_ps(p); }
+		SIMD_INLINE void store (float* p) const {			_mm256_storeu_ps(p, v); }
+
+		SIMD_INLINE float operator[] (int i) const {
+			alignas(32) float tmp[8];
+			_mm256_store_ps(tmp, v);
+			return tmp[i];
+		}
+	};
+
+	SIMD_INLINE f32x8 operator- (f32x8 v) {				return _mm256_xor_ps(v.v, _mm256_set1_ps(-0.0f)); }
+	SIMD_INLINE f32x8 operator+ (f32x8 l, f32x8 r) {	return _mm256_add_ps(l.v, r.v); }
+	SIMD_INLINE f32x8 operator- (f32x8 l, f32x8 r) {	return _mm256_sub_ps(l.v, r.v); }
+	SIMD_INLINE f32x8 operator* (f32x8 l, f32x8 r) {	return _mm256_mul_ps(l.v, r.v); }
+	SIMD_INLINE f32x8 operator/ (f32x8 l, f32x8 r) {	return _mm256_div_ps(l.v, r.v); }
+
+	SIMD_INLINE m32x8 operator<  (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_LT_OQ); }
+	SIMD_INLINE m32x8 operator<= (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_LE_OQ); }
+	SIMD_INLINE m32x8 operator>  (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_GT_OQ); }
+	SIMD_INLINE m32x8 operator>= (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_GE_OQ); }
+	SIMD_INLINE m32x8 operator== (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_EQ_OQ); }
+	SIMD_INLINE m32x8 operator!= (f32x8 l, f32x8 r) {	return _mm256_cmp_ps(l.v, r.v, _CMP_NEQ_UQ); }
+
+	SIMD_INLINE f32x8 min (f32x8 l, f32x8 r) {			return _mm256_min_ps(l.v, r.v); }
+	SIMD_INLINE f32x8 max (f32x8 l, f32x8 r) {			return _mm256_max_ps(l.v, r.v); }
+	SIMD_INLINE f32x8 abs (f32x8 v) {					return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v.v); }
+	SIMD_INLINE f32x8 sqrt (f32x8 v) {					return _mm256_sqrt_ps(v.v); }
+	SIMD_INLINE f32x8 floor (f32x8 v) {					return _mm256_floor_ps(v.v); }
+
+	SIMD_INLINE f32x8 select (m32x8 c, f32x8 l, f32x8 r) {	return _mm256_blendv_ps(r.v, l.v, c.v); }
+	SIMD_INLINE f32x8 mask (m32x8 c, f32x8 v) {				return _mm256_and_ps(c.v, v.v); }
+
+	struct i32x8 {
+		__m256i v;
+
+		static constexpr int WIDTH = 8;
+		typedef int		scalar_t;
+		typedef f32x8	float_t;
+		typedef i32x8	int_t;
+		typedef m32x8	mask_t;
+
+		SIMD_INLINE i32x8 () = default;
+		SIMD_INLINE i32x8 (__m256i v): v{v} {}
+		SIMD_INLINE i32x8 (int all): v{_mm256_set1_epi32(all)} {}
+
+		SIMD_INLINE static i32x8 load (int const* p) {	return _mm256_loadu_si256((__m256i const*)p); }
+		SIMD_INLINE void store (int* p) const {			_mm256_storeu_si256((__m256i*)p, v); }
+
+		SIMD_INLINE int operator[] (int i) const {
+			alignas(32) int tmp[8];
+			_mm256_store_si256((__m256i*)tmp, v);
+			return tmp[i];
+		}
+	};
+
+	SIMD_INLINE i32x8 operator+ (i32x8 l, i32x8 r) {	return _mm256_add_epi32(l.v, r.v); }
+	SIMD_INLINE i32x8 operator- (i32x8 l, i32x8 r) {	return _mm256_sub_epi32(l.v, r.v); }
+	SIMD_INLINE i32x8 operator& (i32x8 l, i32x8 r) {	return _mm256_and_si256(l.v, r.v); }
+	SIMD_INLINE i32x8 operator| (i32x8 l, i32x8 r) {	return _mm256_or_si256(l.v, r.v); }
+	SIMD_INLINE i32x8 operator^ (i32x8 l, i32x8 r) {	return _mm256_xor_si256(l.v, r.v); }
+	SIMD_INLINE i32x8 operator>> (i32x8 l, int r) {		return _mm256_srai_epi32(l.v, r); }
+	SIMD_INLINE i32x8 operator<< (i32x8 l, int r) {		return _mm256_slli_epi32(l.v, r); }
+	SIMD_INLINE i32x8 srl (i32x8 l, int r) {			return _mm256_srli_epi32(l.v, r); }
+
+	SIMD_INLINE m32x8 operator== (i32x8 l, i32x8 r) {	return _mm256_cmpeq_epi32(l.v, r.v); }
+	SIMD_INLINE m32x8 operator<  (i32x8 l, i32x8 r) {	return _mm256_cmpgt_epi32(r.v, l.v); }
+	SIMD_INLINE m32x8 operator>  (i32x8 l, i32x8 r) {	return _mm256_cmpgt_epi32(l.v, r.v); }
+
+	SIMD_INLINE i32x8 select (m32x8 c, i32x8 l, i32x8 r) {	return _mm256_blendv_epi8(r.v, l.v, c.as_int()); }
+	SIMD_INLINE i32x8 mask (m32x8 c, i32x8 v) {				return _mm256_and_si256(c.as_int(), v.v); }
+
+	SIMD_INLINE i32x8 to_int (f32x8 v) {				return _mm256_cvttps_epi32(v.v); }
+	SIMD_INLINE f32x8 to_float (i32x8 v) {				return _mm256_cvtepi32_ps(v.v); }
+	SIMD_INLINE i32x8 as_int (f32x8 v) {				return _mm256_castps_si256(v.v); }
+	SIMD_INLINE f32x8 as_float (i32x8 v) {				return _mm256_castsi256_ps(v.v); }
+
+	SIMD_INLINE i32x8 gather (int const* base, i32x8 idx) {	return _mm256_i32gather_epi32(base, idx.v, 4); }
+#endif
+
+	//// Two registers as one lane type of twice the width (eg. 16 lanes as 2x f32x8)
+	//  only float and mask lanes, every op is just done on both halves, which also gives the cpu two independent dependency chains
+
+	template <typename M>
+	struct m32_pair {
+		M lo, hi;
+
+		static constexpr int WIDTH = M::WIDTH * 2;
+
+		SIMD_INLINE m32_pair () = default;
+		SIMD_INLINE m32_pair (M lo, M hi): lo{lo}, hi{hi} {}
+
+		SIMD_INLINE static m32_pair all_true () {	return { M::all_true(), M::all_true() }; }
+		SIMD_INLINE static m32_pair all_false () {	return { M::all_false(), M::all_false() }; }
+		SIMD_INLINE static m32_pair from_bits (int bits) {
+			return { M::from_bits(bits & ((1 << M::WIDTH) -1)), M::from_bits(bits >> M::WIDTH) };
+		}
+
+		SIMD_INLINE int bits () const {	return lo.bits() | hi.bits() << M::WIDTH; }
+
+		friend SIMD_INLINE m32_pair operator& (m32_pair l, m32_pair r) {	return { l.lo & r.lo, l.hi & r.hi }; }
+		friend SIMD_INLINE m32_pair operator| (m32_pair l, m32_pair r) {	return { l.lo | r.lo, l.hi | r.hi }; }
+		friend SIMD_INLINE m32_pair operator^ (m32_pair l, m32_pair r) {	return { l.lo ^ r.lo, l.hi ^ r.hi }; }
+		friend SIMD_INLINE m32_pair operator~ (m32_pair m) {				return { ~m.lo, ~m.hi }; }
+		friend SIMD_INLINE m32_pair andnot (m32_pair l, m32_pair r) {		return { andnot(l.lo, r.lo), andnot(l.hi, r.hi) }; }
+	};
+
+	template <typename F>
+	struct f32_pair {
+		F lo, hi;
+
+		static constexpr int WIDTH = F::WIDTH * 2;
+		typedef float							scalar_t;
+		typedef f32_pair						float_t;
+		typedef m32_pair<typename F::mask_t>	mask_t;
+
+		SIMD_INLINE f32_pair () = default;
+		SIMD_INLINE f32_pair (F lo, F hi): lo{lo}, hi{hi} {}
+		SIMD_INLINE f32_pair (float all): lo{all}, hi{all} {}
+
+		SIMD_INLINE static f32_pair load (float const* p) {	return { F::load(p), F::load(p + F::WIDTH) }; }
+		SIMD_INLINE void store (float* p) const {			lo.store(p); hi.store(p + F::WIDTH); }
+
+		SIMD_INLINE float operator[] (int i) const {		return i < F::WIDTH ? lo[i] : hi[i - F::WIDTH]; }
+
+		friend SIMD_INLINE f32_pair operator- (f32_pair v) {				return { -v.lo, -v.hi }; }
+		friend SIMD_INLINE f32_pair operator+ (f32_pair l, f32_pair r) {	return { l.lo + r.lo, l.hi + r.hi }; }
+		friend SIMD_INLINE f32_pair operator- (f32_pair l, f32_pair r) {	return { l.lo - r.lo, l.hi - r.hi }; }
+		friend SIMD_INLINE f32_pair operator* (f32_pair l, f32_pair r) {	return { l.lo * r.lo, l.hi * r.hi }; }
+		friend SIMD_INLINE f32_pair operator/ (f32_pair l, f32_pair r) {	return { l.lo / r.lo, l.hi / r.hi }; }
+
+		friend SIMD_INLINE mask_t operator<  (f32_pair l, f32_pair r) {	return { l.lo <  r.lo, l.hi <  r.hi }; }
+		friend SIMD_INLINE mask_t operator<= (f32_pair l, f32_pair r) {	return { l.lo <= r.lo, l.hi <= r.hi }; }
+		friend SIMD_INLINE mask_t operator>  (f32_pair l, f32_pair r) {	return { l.lo >  r.lo, l.hi >  r.hi }; }
+		friend SIMD_INLINE mask_t operator>= (f32_pair l, f32_pair r) {	return { l.lo >= r.lo, l.hi >= r.hi }; }
+		friend SIMD_INLINE mask_t operator== (f32_pair l, f32_pair r) {	return { l.lo == r.lo, l.hi == r.hi }; }
+		friend SIMD_INLINE mask_t operator!= (f32_pair l, f32_pair r) {	return { l.lo != r.lo, l.hi != r.hi }; }
+
+		friend SIMD_INLINE f32_pair min (f32_pair l, f32_pair r) {			return { min(l.lo, r.lo), min(l.hi, r.hi) }; }
+		friend SIMD_INLINE f32_pair max (f32_pair l, f32_pair r) {			return { max(l.lo, r.lo), max(l.hi, r.hi) }; }
+		friend SIMD_INLINE f32_pair abs (f32_pair v) {						return { abs(v.lo), abs(v.hi) }; }
+		friend SIMD_INLINE f32_pair sqrt (f32_pair v) {						return { sqrt(v.lo), sqrt(v.hi) }; }
+		friend SIMD_INLINE f32_pair floor (f32_pair v) {					return { floor(v.lo), floor(v.hi) }; }
+
+		friend SIMD_INLINE f32_pair select (mask_t c, f32_pair l, f32_pair r) {	return { select(c.lo, l.lo, r.lo), select(c.hi, l.hi, r.hi) }; }
+		friend SIMD_INLINE f32_pair mask (mask_t c, f32_pair v) {					return { mask(c.lo, v.lo), mask(c.hi, v.hi) }; }
+	};
+
+#if SIMD_HAS_AVX2
+	typedef f32_pair<f32x8>				f32x16;
+#else
+	typedef f32_pair<f32_pair<f32x4>>	f32x16;
+#endif
+
+	//// Width independent helpers
+
+	// true if any lane is set
+	template <typename M> SIMD_INLINE bool any (M m) {	return m.bits() != 0; }
+	// true if all lanes are set
+	template <typename M> SIMD_INLINE bool all (M m) {	return m.bits() == (1 << M::WIDTH) -1; }
+
+	template <typename F> SIMD_INLINE F clamp (F x, F lo, F hi) {	return min(max(x, lo), hi); }
+	template <typename F> SIMD_INLINE F lerp (F a, F b, F t) {		return a + (b - a) * t; }
+
+	// mask with the first n lanes set (for loop tails)
+	template <typename M> SIMD_INLINE M first_n (int n) {
+		return M::from_bits(n >= M::WIDTH ? (1 << M::WIDTH) -1 : (1 << n) -1);
+	}
+}
@@ -0,0 +1,79 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "kissmath.hpp"
+#include <vector>
+#include <random>
+#include <stdio.h>
+
+// kissmath ops on 1024 element arrays (fits in L1/L2, so this measures the kernels, not memory)
+//  compare against a KISSMATH_NO_SIMD build for the scalar numbers, and an /arch:AVX2 build for the 256 bit 4x4 mul
+namespace {
+	const int N = 1024;
+	const int REPS = 2000;
+
+	std::mt19937 rng (3);
+
+	float rf () { return std::uniform_real_distribution<float>(-1, 1)(rng); }
+	float4 r4 () { return float4(rf(), rf(), rf(), rf()); }
+	float3 r3 () { return float3(rf(), rf(), rf()); }
+	// + identity*3 to keep the matrices well conditioned for inverse
+	float4x4 rm44 () { return float4x4::columns(r4(), r4(), r4(), r4()) + float4x4::identity() * 3; }
+	float3x4 rm34 () { return float3x4::columns(r3(), r3(), r3(), r3()); }
+	float3x3 rm33 () { return float3x3::columns(r3(), r3(), r3()) + float3x3::identity() * 3; }
+
+	template <typename FUNC> void run (char const* name, FUNC f) {
+		f(); // warm up
+
+		auto t = kiss::Timer::start();
+		for (int r=0; r<REPS; ++r)
+			f();
+		double sec = t.end();
+
+		printf("%-22s %8.1f Mop/s\n", name, (double)N * REPS / sec / 1e6);
+	}
+}
+
+int bench_kissmath_simd (int argc, char** argv) {
+#if defined(KISSMATH_NO_SIMD)
+	printf("kissmath: scalar (KISSMATH_NO_SIMD)\n");
+#else
+	printf("kissmath: simd backend\n");
+#endif
+
+	std::vector<float4x4> a44(N), b44(N), o44(N);
+	std::vector<float3x4> a34(N), b34(N), o34(N);
+	std::vector<float3x3> a33(N), b33(N), o33(N);
+	std::vector<float4> v4(N), ov4(N);
+	std::vector<float3> v3(N), w3(N), ov3(N);
+	std::vector<float> of(N);
+
+	for (int i=0; i<N; ++i) {
+		a44[i] = rm44();	b44[i] = rm44();	v4[i] = r4();
+		a34[i] = rm34();	b34[i] = rm34();	v3[i] = r3();	w3[i] = r3();
+		a33[i] = rm33();	b33[i] = rm33();
+	}
+
+	run("float4x4 * float4x4",	[&] { for (int i=0; i<N; ++i) o44[i] = a44[i] * b44[i]; });
+	run("float4x4 * float4",	[&] { for (int i=0; i<N; ++i) ov4[i] = a44[i] * v4[i]; });
+	run("float4 * float4x4",	[&] { for (int i=0; i<N; ++i) ov4[i] = v4[i] * a44[i]; });
+	run("transpose(float4x4)",	[&] { for (int i=0; i<N; ++i) o44[i] = transpose(a44[i]); });
+	run("inverse(float4x4)",	[&] { for (int i=0; i<N; ++i) o44[i] = inverse(a44[i]); });
+	run("float3x4 * float3x4",	[&] { for (int i=0; i<N; ++i) o34[i] = a34[i] * b34[i]; });
+	run("float3x4 * float3",	[&] { for (int i=0; i<N; ++i) ov3[i] = a34[i] * v3[i]; });
+	run("float3x3 * float3x3",	[&] { for (int i=0; i<N; ++i) o33[i] = a33[i] * b33[i]; });
+	run("float3x3 * float3",	[&] { for (int i=0; i<N; ++i) ov3[i] = a33[i] * v3[i]; });
+	run("inverse(float3x3)",	[&] { for (int i=0; i<N; ++i) o33[i] = inverse(a33[i]); });
+	run("dot(float4)",			[&] { for (int i=0; i<N; ++i) of[i] = dot(v4[i], ov4[i]); });
+	run("dot(float3)",			[&] { for (int i=0; i<N; ++i) of[i] = dot(v3[i], w3[i]); });
+	run("cross(float3)",		[&] { for (int i=0; i<N; ++i) ov3[i] = cross(v3[i], w3[i]); });
+	run("transform_point 4x4",	[&] { for (int i=0; i<N; ++i) ov3[i] = transform_point(a44[i], v3[i]); });
+	run("transform_point 3x4",	[&] { for (int i=0; i<N; ++i) ov3[i] = transform_point(a34[i], v3[i]); });
+	run("transform_dir 3x4",	[&] { for (int i=0; i<N; ++i) ov3[i] = transform_direction(a34[i], v3[i]); });
+
+	// use the results, so the loops can not be optimized away
+	double sum = 0;
+	for (int i=0; i<N; ++i)
+		sum += o44[i].arr[1].y + o34[i].arr[3].x + o33[i].arr[2].z + ov3[i].x + ov4[i].w + of[i];
+	printf("checksum %f\n", sum);
+	return 0;
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "stdint.h"
+#include "assert.h"
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+// 32 bit handle into a SlotMap: slot index in the low INDEX_BITS, generation of the slot in the high bits
+//  the generation changes every time the slot gets erased, so handles to erased elements are detected instead of aliasing a new element
+//  id 0 is never handed out (generations start at 1), a default constructed handle is null
+struct SlotHandle {
+	static constexpr int		INDEX_BITS = 20; // ~1M live elements
+	static constexpr uint32_t	INDEX_MASK = (1u << INDEX_BITS) - 1;
+	static constexpr uint32_t	MAX_GENERATION = (1u << (32 - INDEX_BITS)) - 1;
+
+	uint32_t	id = 0;
+
+	SlotHandle () {}
+	SlotHandle (uint32_t index, uint32_t generation): id{(generation << INDEX_BITS) | index} {}
+
+	uint32_t index () const {		return id & INDEX_MASK; }
+	uint32_t generation () const {	return id >> INDEX_BITS; }
+
+	explicit operator bool () const { return id != 0; }
+	bool operator== (SlotHandle r) const { return id == r.id; }
+	bool operator!= (SlotHandle r) const { return id != r.id; }
+};
+
+// Generational slot map: O(1) insert, erase and lookup by handle, elements stored densely
+//  elements live in one contiguous array (iterate with begin() / end() like a vector), erase moves the last element into the hole
+//  slots map handles to dense indices and keep the generation, free slots form a linked list through the slots
+//  pointers to elements are only valid until the next insert or erase (elements move), keep handles instead
+//  a slot whose generation would wrap around is retired instead of reused, so a stale handle can never become valid again
+template <typename T>
+class SlotMap {
+	static constexpr uint32_t NONE = (uint32_t)-1;
+
+	struct Slot {
+		uint32_t	dense; // index into dense if the slot is used, next free slot if not
+		uint32_t	generation;
+	};
+
+	std::vector<T>			dense;
+	std::vector<uint32_t>	dense_slot; // slot of each dense element, to fix up the slot of the element moved by erase
+	std::vector<Slot>		slots;
+	uint32_t				free_head = NONE;
+
+public:
+	size_t size () const {
+		return dense.size();
+	}
+	bool empty () const {
+		return dense.empty();
+	}
+	void reserve (size_t count) {
+		dense.reserve(count);
+		dense_slot.reserve(count);
+		slots.reserve(count);
+	}
+
+	void clear () {
+		// keep the slots so their generations stay valid, just free all of them
+		for (uint32_t slot : dense_slot) {
+			auto& s = slots[slot];
+			s.generation++;
+			if (s.generation <= SlotHandle::MAX_GENERATION) {
+				s.dense = free_head;
+				free_head = slot;
+			}
+		}
+		dense.clear();
+		dense_slot.clear();
+	}
+
+	SlotHandle insert (T val) {
+		uint32_t slot;
+		if (free_head != NONE) {
+			slot = free_head;
+			free_head = slots[slot].dense;
+		} else {
+			slot = (uint32_t)slots.size();
+			assert(slot <= SlotHandle::INDEX_MASK);
+			slots.push_back({ 0, 1 });
+		}
+
+		slots[slot].dense = (uint32_t)dense.size();
+		dense.push_back(std::move(val));
+		dense_slot.push_back(slot);
+
+		return SlotHandle(slot, slots[slot].generation);
+	}
+
+	// returns false if the handle was already stale
+	bool erase (SlotHandle h) {
+		if (!contains(h))
+			return false;
+
+		uint32_t slot = h.index();
+		uint32_t idx = slots[slot].dense;
+
+		// move last element into the hole
+		uint32_t last = (uint32_t)dense.size() - 1;
+		if (idx != last) {
+			dense[idx] = std::move(dense[last]);
+			dense_slot[idx] = dense_slot[last];
+			slots[dense_slot[idx]].dense = idx;
+		}
+		dense.pop_back();
+		dense_slot.pop_back();
+
+		auto& s = slots[slot];
+		s.generation++;
+		if (s.generation <= SlotHandle::MAX_GENERATION) {
+			s.dense = free_head;
+			free_head = slot;
+		}
+		return true;
+	}
+
+	bool contains (SlotHandle h) const {
+		uint32_t slot = h.index();
+		return slot < slots.size() && slots[slot].generation == h.generation();
+	}
+
+	// nullptr if the handle is stale
+	T* get (SlotHandle h) {
+		return contains(h) ? &dense[slots[h.index()].dense] : nullptr;
+	}
+	T const* get (SlotHandle h) const {
+		return contains(h) ? &dense[slots[h.index()].dense] : nullptr;
+	}
+	T& operator[] (SlotHandle h) {
+		assert(contains(h));
+		return dense[slots[h.index()].dense];
+	}
+	T const& operator[] (SlotHandle h) const {
+		assert(contains(h));
+		return dense[slots[h.index()].dense];
+	}
+
+	// handle of the element at a dense index (eg. while iterating)
+	SlotHandle handle_of (size_t dense_index) const {
+		uint32_t slot = dense_slot[dense_index];
+		return SlotHandle(slot, slots[slot].generation);
+	}
+
+	T* data () { return dense.data(); }
+	T* begin () { return dense.data(); }
+	T* end () { return dense.data() + dense.size(); }
+	T const* begin () const { return dense.data(); }
+	T const* end () const { return dense.data() + dense.size(); }
+};
@@ -0,0 +1,122 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "slot_map.hpp"
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <stdio.h>
+
+// SlotMap<Obj> vs unordered_map<Obj*, Obj> (pointer keys, like the maps it replaces), 16 byte elements
+//  after churning half the elements, so neither container is in insertion order, lookups in shuffled order
+//  plus checks that stale handles are detected and that a slot is retired when its generation would wrap
+namespace {
+	struct Obj {
+		float v[4];
+	};
+
+	Obj make_obj (int i) {
+		return { { (float)i, 1, 2, 3 } };
+	}
+
+	// ns per element of R repetitions over N elements
+	template <typename FUNC> double ns_per_elem (int R, int N, FUNC f) {
+		auto t = kiss::Timer::start();
+		for (int r=0; r<R; ++r)
+			f();
+		return t.end() / ((double)R * N) * 1e9;
+	}
+
+	int run_size (int N) {
+		std::mt19937 rng (1);
+
+		SlotMap<Obj> sm;
+		std::vector<SlotHandle> handles;
+
+		std::unordered_map<Obj*, Obj> um;
+		std::vector<std::unique_ptr<Obj>> key_objs;
+		std::vector<Obj*> keys;
+
+		for (int i=0; i<N; ++i) {
+			handles.push_back(sm.insert(make_obj(i)));
+
+			key_objs.emplace_back(new Obj);
+			keys.push_back(key_objs.back().get());
+			um[keys.back()] = make_obj(i);
+		}
+
+		// churn: erase and reinsert half, so neither is in insertion order
+		for (int i=0; i<N/2; ++i) {
+			int k = rng() % N;
+			sm.erase(handles[k]);
+			handles[k] = sm.insert(make_obj(k));
+			um.erase(keys[k]);
+			um[keys[k]] = make_obj(k);
+		}
+
+		std::vector<int> order (N);
+		for (int i=0; i<N; ++i)
+			order[i] = i;
+		std::shuffle(order.begin(), order.end(), rng);
+
+		int R = 20000000 / N;
+		float sum = 0;
+
+		double iter_sm   = ns_per_elem(R, N, [&] { for (auto& o : sm) sum += o.v[0]; });
+		double iter_um   = ns_per_elem(R, N, [&] { for (auto& o : um) sum += o.second.v[0]; });
+		double lookup_sm = ns_per_elem(R, N, [&] { for (int i : order) sum += sm[handles[i]].v[0]; });
+		double lookup_um = ns_per_elem(R, N, [&] { for (int i : order) sum += um.find(keys[i])->second.v[0]; });
+		double churn_sm  = ns_per_elem(R, N, [&] {
+			for (int i : order) {
+				sm.erase(handles[i]);
+				handles[i] = sm.insert(make_obj(i));
+			}
+		});
+		double churn_um  = ns_per_elem(R, N, [&] {
+			for (int i : order) {
+				um.erase(keys[i]);
+				um[keys[i]] = make_obj(i);
+			}
+		});
+
+		// a handle must be stale after its erase, even though the slot gets reused
+		SlotHandle old = handles[0];
+		sm.erase(old);
+		SlotHandle reused = sm.insert(make_obj(0));
+		bool stale_ok = sm.get(old) == nullptr && !sm.contains(old) && sm.contains(reused);
+
+		printf("N=%7d  iterate %5.2f / %5.2f ns  lookup %5.2f / %5.2f ns  erase+insert %6.2f / %6.2f ns  (slot map / unordered_map)  (%g)\n",
+			N, iter_sm, iter_um, lookup_sm, lookup_um, churn_sm, churn_um, sum);
+
+		if (!stale_ok) {
+			printf("stale handle not detected\n");
+			return 1;
+		}
+		return 0;
+	}
+
+	// a slot that went through all generations must not be handed out again
+	int check_retire () {
+		SlotMap<int> m;
+		SlotHandle h = m.insert(1);
+		uint32_t index = h.index();
+
+		for (uint32_t g=0; g<SlotHandle::MAX_GENERATION + 5; ++g) {
+			m.erase(h);
+			h = m.insert(1);
+		}
+
+		bool ok = h.index() != index && m.size() == 1;
+		printf("slot retire %s (first slot %u, now %u)\n", ok ? "ok" : "FAILED", index, h.index());
+		return ok ? 0 : 1;
+	}
+}
+
+int bench_slot_map (int argc, char** argv) {
+	int fails = 0;
+	for (int N : { 1000, 100000, 1000000 })
+		fails += run_size(N);
+	fails += check_retire();
+	return fails ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "raw_array.hpp"
+#include "alloc_tracking.hpp"
+#include "voxel_world.hpp"
+#include <vector>
+#include <stdio.h>
+
+// push_back into many short lists: std::vector vs UnsafeVector vs SmallVector<16>, time per push and heap allocations per list
+//  plus growing one big array, where UnsafeVector can realloc in place (or mremap) and std::vector has to copy
+//  and a check of the ChunkBlocks palette (SmallVector storage) against a plain array
+namespace {
+	int bench_tag = alloc_tracking::get_tag("bench");
+
+	int64_t allocs () {
+		return alloc_tracking::get_stats(bench_tag).total_allocs;
+	}
+
+	struct UnsafeVector16 : UnsafeVector<uint32_t> {
+		UnsafeVector16 (): UnsafeVector<uint32_t>(16) {}
+	};
+
+	template <typename V> void short_lists (char const* name, int n) {
+		const int LISTS = 1000000 / n + 1000;
+
+		alloc_tracking::TagScope tag (bench_tag);
+		int64_t allocs0 = allocs();
+
+		uint64_t sum = 0;
+		auto t = kiss::Timer::start();
+		for (int l=0; l<LISTS; ++l) {
+			V v;
+			for (int i=0; i<n; ++i)
+				v.push_back(i);
+			sum += v[n/2];
+		}
+		double sec = t.end();
+
+		printf("  %-14s n=%3d  %6.2f ns/push  %5.2f allocs/list  (%llu)\n", name, n,
+			sec / ((double)LISTS * n) * 1e9, (double)(allocs() - allocs0) / LISTS, (unsigned long long)sum);
+	}
+
+	template <typename V> void big_array (char const* name) {
+		const size_t N = (256ull << 20) / sizeof(uint64_t);
+
+		auto t = kiss::Timer::start();
+		V v;
+		for (size_t i=0; i<N; ++i)
+			v.push_back(i);
+		double sec = t.end();
+
+		printf("%-13s grow to 256MB: %.3f s  (%llu)\n", name, sec, (unsigned long long)v[N/2]);
+	}
+
+	struct UnsafeVector64 : UnsafeVector<uint64_t> {
+		UnsafeVector64 (): UnsafeVector<uint64_t>(16) {}
+	};
+
+	// random sets with a small and then a large palette, with copies, moves and compact in between
+	int check_palette () {
+		ChunkBlocks b;
+		std::vector<block_id> ref (CHUNK_VOXELS, B_AIR);
+
+		uint32_t s = 1;
+		for (int k=0; k<200000; ++k) {
+			s = s * 1664525u + 1013904223u;
+			int i = (s >> 8) % CHUNK_VOXELS;
+			block_id id = (block_id)((s >> 20) % (k < 100000 ? 12 : 300));
+			b.set(i, id);
+			ref[i] = id;
+
+			if (k % 50000 == 0) {
+				ChunkBlocks c = b;
+				ChunkBlocks m = std::move(c);
+				b = m;
+				b.compact();
+			}
+		}
+		for (int i=0; i<CHUNK_VOXELS; ++i) {
+			if (b.get(i) != ref[i]) {
+				printf("palette mismatch at %d\n", i);
+				return 1;
+			}
+		}
+
+		ChunkBlocks f;
+		f.set_all(ref.data());
+		for (int i=0; i<CHUNK_VOXELS; ++i) {
+			if (f.get(i) != ref[i]) {
+				printf("palette set_all mismatch at %d\n", i);
+				return 1;
+			}
+		}
+
+		ChunkBlocks small (7);
+		small.set(3, 9);
+		printf("palette ok: %d bits, %zu entries, %zu bytes, 2 entry chunk %zu bytes\n",
+			b.get_bits(), b.palette_size(), b.memory_usage(), small.memory_usage());
+		return 0;
+	}
+}
+
+int bench_small_vector (int argc, char** argv) {
+	if (check_palette())
+		return 1;
+
+	for (int n : { 1, 4, 8, 16, 32, 64 }) {
+		short_lists<std::vector<uint32_t>>("std::vector", n);
+		short_lists<UnsafeVector16>("UnsafeVector", n);
+		short_lists<SmallVector<uint32_t, 16>>("SmallVector16", n);
+	}
+
+	big_array<UnsafeVector64>("UnsafeVector");
+	big_array<std::vector<uint64_t>>("std::vector");
+	return 0;
+}
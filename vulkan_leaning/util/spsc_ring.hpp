@@ -0,0 +1,140 @@
+#pragma once
+#include "assert.h"
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+// Wait-free single producer single consumer ring buffer (eg. a command stream from one thread to another, telemetry samples)
+//  exactly one thread may push and exactly one other thread may pop, every call finishes in a bounded number of steps (no locks, no retry loops)
+//  head (written by the producer) and tail (written by the consumer) are on separate cache lines so the two threads do not false share
+//  each side keeps a cached copy of the other side's index and only reloads it (a cache miss on the other core's line) when the ring looks full / empty
+//  capacity is rounded up to a power of two, indices are free running counters & mask
+//  push_n() / pop_n() move as many items as fit / are available with at most two memcpy and one atomic store
+// T has to be trivially copyable (items are memcpy-ed)
+template <typename T>
+class SpscRing {
+	static_assert(std::is_trivially_copyable<T>::value, "SpscRing only supports trivially copyable types");
+
+	static constexpr size_t CACHE_LINE = 64;
+
+	// written by the producer
+	struct alignas(CACHE_LINE) Producer {
+		std::atomic<size_t>	head { 0 }; // items pushed
+		size_t				cached_tail = 0;
+	};
+	// written by the consumer
+	struct alignas(CACHE_LINE) Consumer {
+		std::atomic<size_t>	tail { 0 }; // items popped
+		size_t				cached_head = 0;
+	};
+
+	Producer				prod;
+	Consumer				cons;
+
+	std::unique_ptr<T[]>	arr;
+	size_t					mask = 0;
+
+	void copy_in (size_t pos, T const* src, size_t n) {
+		size_t i = pos & mask;
+		size_t first = n < mask + 1 - i ? n : mask + 1 - i;
+		memcpy(&arr[i], src, first * sizeof(T));
+		if (n > first)
+			memcpy(&arr[0], src + first, (n - first) * sizeof(T));
+	}
+	void copy_out (T* dst, size_t pos, size_t n) const {
+		size_t i = pos & mask;
+		size_t first = n < mask + 1 - i ? n : mask + 1 - i;
+		memcpy(dst, &arr[i], first * sizeof(T));
+		if (n > first)
+			memcpy(dst + first, &arr[0], (n - first) * sizeof(T));
+	}
+
+public:
+	SpscRing (size_t capacity) {
+		assert(capacity > 0);
+		size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+
+		arr = std::make_unique<T[]>(size);
+		mask = size - 1;
+	}
+
+	size_t capacity () const {
+		return mask + 1;
+	}
+	// only exact when called while neither side is active, a hint otherwise
+	size_t size_approx () const {
+		size_t t = cons.tail.load(std::memory_order_acquire);
+		size_t h = prod.head.load(std::memory_order_acquire);
+		return h - t;
+	}
+
+	//// producer side
+
+	// returns false if the ring is full
+	bool try_push (T const& item) {
+		size_t h = prod.head.load(std::memory_order_relaxed);
+		if (h - prod.cached_tail > mask) {
+			prod.cached_tail = cons.tail.load(std::memory_order_acquire);
+			if (h - prod.cached_tail > mask)
+				return false;
+		}
+
+		arr[h & mask] = item;
+		prod.head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+	// push up to n items, returns how many fit
+	size_t push_n (T const* items, size_t n) {
+		size_t h = prod.head.load(std::memory_order_relaxed);
+		size_t free = capacity() - (h - prod.cached_tail);
+		if (free < n) {
+			prod.cached_tail = cons.tail.load(std::memory_order_acquire);
+			free = capacity() - (h - prod.cached_tail);
+		}
+		if (n > free)
+			n = free;
+		if (n == 0)
+			return 0;
+
+		copy_in(h, items, n);
+		prod.head.store(h + n, std::memory_order_release);
+		return n;
+	}
+
+	//// consumer side
+
+	// returns false if the ring is empty
+	bool try_pop (T* out) {
+		size_t t = cons.tail.load(std::memory_order_relaxed);
+		if (t == cons.cached_head) {
+			cons.cached_head = prod.head.load(std::memory_order_acquire);
+			if (t == cons.cached_head)
+				return false;
+		}
+
+		*out = arr[t & mask];
+		cons.tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+	// pop up to n items into out, returns how many were available
+	size_t pop_n (T* out, size_t n) {
+		size_t t = cons.tail.load(std::memory_order_relaxed);
+		size_t avail = cons.cached_head - t;
+		if (avail < n) {
+			cons.cached_head = prod.head.load(std::memory_order_acquire);
+			avail = cons.cached_head - t;
+		}
+		if (n > avail)
+			n = avail;
+		if (n == 0)
+			return 0;
+
+		copy_out(out, t, n);
+		cons.tail.store(t + n, std::memory_order_release);
+		return n;
+	}
+};
@@ -0,0 +1,260 @@
+#pragma once
+#include "circular_buffer.hpp"
+#include "stdint.h"
+#include "assert.h"
+#include <cstring>
+#include <cmath>
+#include <memory>
+
+// Sliding window min or max in amortized O(1) per push
+//  keeps a deque of the values that can still become the min (max) of the window: each is smaller (larger) than all values pushed before it that are still in the deque
+//  the front is the current min (max), values drop out of the front when they leave the window and out of the back when a better value gets pushed
+template <typename T, bool MAX>
+class MonotonicWindow {
+	struct Item {
+		T			val;
+		uint64_t	index;
+	};
+
+	std::unique_ptr<Item[]>	items; // ring, the deque never holds more than window items
+	size_t					cap = 0;
+	size_t					front = 0;
+	size_t					cnt = 0;
+
+	static bool better_or_equal (T a, T b) {
+		return MAX ? a >= b : a <= b;
+	}
+
+public:
+	void resize (size_t window) {
+		cap = window;
+		items = cap > 0 ? std::make_unique<Item[]>(cap) : nullptr;
+		clear();
+	}
+	void clear () {
+		front = 0;
+		cnt = 0;
+	}
+
+	// push the value with sequence number index, then drop values with index <= index - window
+	void push (T val, uint64_t index) {
+		assert(cap > 0);
+
+		while (cnt > 0 && better_or_equal(val, items[(front + cnt - 1) % cap].val))
+			cnt--;
+		while (cnt > 0 && items[front].index + cap <= index) {
+			front = (front + 1) % cap;
+			cnt--;
+		}
+
+		items[(front + cnt) % cap] = { val, index };
+		cnt++;
+	}
+
+	T get () const {
+		assert(cnt > 0);
+		return items[front].val;
+	}
+};
+
+// Histogram of positive values with logarithmic buckets (like HdrHistogram) for percentiles with bounded relative error
+//  bucket of a value are the exponent and the top SUB_BITS mantissa bits of the float, so each power of two is split into 16 buckets (<= 3.2% error from the bucket center)
+//  values outside [2^MIN_EXP, 2^MAX_EXP) are clamped into the first / last bucket
+//  percentile() first scans the counts per power of two, then the buckets in it -> at most EXPS + SUBS steps, no matter how many values are in the histogram
+class LogHistogram {
+public:
+	static constexpr int SUB_BITS = 4;
+	static constexpr int SUBS = 1 << SUB_BITS;
+	static constexpr int MIN_EXP = -24; // ~60ns when used for seconds
+	static constexpr int MAX_EXP = 8; // 256
+	static constexpr int EXPS = MAX_EXP - MIN_EXP;
+	static constexpr int BUCKETS = EXPS * SUBS;
+
+private:
+	uint32_t	counts[BUCKETS];
+	uint32_t	exp_counts[EXPS];
+	uint32_t	total;
+
+	static constexpr uint32_t FIRST_BITS = (uint32_t)(127 + MIN_EXP) << 23; // float bits of 2^MIN_EXP
+
+	static uint32_t float_bits (float f) {
+		uint32_t u;
+		memcpy(&u, &f, sizeof(u));
+		return u;
+	}
+	static float bits_float (uint32_t u) {
+		float f;
+		memcpy(&f, &u, sizeof(f));
+		return f;
+	}
+
+public:
+	LogHistogram () {
+		clear();
+	}
+	void clear () {
+		memset(counts, 0, sizeof(counts));
+		memset(exp_counts, 0, sizeof(exp_counts));
+		total = 0;
+	}
+
+	uint32_t count () const {
+		return total;
+	}
+
+	static int bucket (float val) {
+		uint32_t u = float_bits(val);
+		if (!(val > 0) || u < FIRST_BITS) return 0; // also negative and nan
+		int b = (int)((u - FIRST_BITS) >> (23 - SUB_BITS));
+		return b < BUCKETS ? b : BUCKETS - 1;
+	}
+	// center of the bucket
+	static float bucket_value (int b) {
+		float lo = bits_float(FIRST_BITS + ((uint32_t)b << (23 - SUB_BITS)));
+		float hi = bits_float(FIRST_BITS + ((uint32_t)(b + 1) << (23 - SUB_BITS)));
+		return (lo + hi) * 0.5f;
+	}
+
+	void add (float val) {
+		int b = bucket(val);
+		counts[b]++;
+		exp_counts[b >> SUB_BITS]++;
+		total++;
+	}
+	// val has to have been added before
+	void remove (float val) {
+		int b = bucket(val);
+		assert(counts[b] > 0);
+		counts[b]--;
+		exp_counts[b >> SUB_BITS]--;
+		total--;
+	}
+
+	// approximate value that the fraction p (0-1) of the values are at or below, 0 if empty
+	float percentile (float p) const {
+		if (total == 0)
+			return 0;
+
+		// rank of the value in 1..total
+		uint32_t rank = (uint32_t)std::ceil(p * (float)total);
+		rank = rank < 1 ? 1 : (rank > total ? total : rank);
+
+		uint32_t seen = 0;
+		int e = 0;
+		while (seen + exp_counts[e] < rank)
+			seen += exp_counts[e++];
+
+		int b = e * SUBS;
+		while (seen + counts[b] < rank)
+			seen += counts[b++];
+
+		return bucket_value(b);
+	}
+};
+
+// Statistics over the last window values in O(1) per push and per query
+//  mean and variance: windowed sum and Welford update (the oldest value gets replaced by the new one), accumulated in double
+//  min and max: MonotonicWindow
+//  percentiles: LogHistogram (approximate, clamped to the exact min and max)
+//  values are kept in a circular_buffer to know which one leaves the window
+template <typename T=float>
+class StreamingStats {
+	circular_buffer<T>		buf;
+	uint64_t				pushed = 0;
+
+	double					mean_ = 0;
+	double					m2 = 0; // sum of squared differences from the mean
+
+	MonotonicWindow<T, false>	min_window;
+	MonotonicWindow<T, true>	max_window;
+	LogHistogram			histogram;
+
+public:
+	StreamingStats (size_t window) {
+		resize(window);
+	}
+
+	// clears the values
+	void resize (size_t window) {
+		assert(window > 0);
+		buf = circular_buffer<T>(window);
+		min_window.resize(window);
+		max_window.resize(window);
+		clear();
+	}
+	void clear () {
+		while (buf.count() > 0)
+			buf.pop();
+		pushed = 0;
+		mean_ = 0;
+		m2 = 0;
+		min_window.clear();
+		max_window.clear();
+		histogram.clear();
+	}
+
+	circular_buffer<T>& values () {
+		return buf;
+	}
+	size_t capacity () const {
+		return buf.capacity();
+	}
+	size_t count () const {
+		return buf.count();
+	}
+
+	void push (T val) {
+		double x = (double)val;
+
+		if (buf.count() < buf.capacity()) {
+			double n = (double)(buf.count() + 1);
+			double delta = x - mean_;
+			mean_ += delta / n;
+			m2 += delta * (x - mean_);
+		} else {
+			T old = buf.get_oldest(0);
+			double x_old = (double)old;
+			double n = (double)buf.count();
+
+			double old_mean = mean_;
+			mean_ += (x - x_old) / n;
+			m2 += (x - x_old) * (x - mean_ + x_old - old_mean);
+			if (m2 < 0) m2 = 0; // rounding
+
+			histogram.remove((float)old);
+		}
+
+		buf.push(val);
+		histogram.add((float)val);
+		min_window.push(val, pushed);
+		max_window.push(val, pushed);
+		pushed++;
+	}
+
+	T mean () const {
+		return (T)mean_;
+	}
+	// sample variance (n - 1)
+	T variance () const {
+		return buf.count() > 1 ? (T)(m2 / (double)(buf.count() - 1)) : (T)0;
+	}
+	T std_dev () const {
+		return (T)std::sqrt((double)variance());
+	}
+	T min () const {
+		return min_window.get();
+	}
+	T max () const {
+		return max_window.get();
+	}
+
+	// approximate value that the fraction p (0-1) of the values are at or below (~3% relative error, exact for p=0 and p=1)
+	T percentile (float p) const {
+		if (p <= 0) return min();
+		if (p >= 1) return max();
+
+		T val = (T)histogram.percentile(p);
+		T lo = min(), hi = max();
+		return val < lo ? lo : (val > hi ? hi : val);
+	}
+};
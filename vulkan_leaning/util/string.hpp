@@ -34,6 +34,7 @@ namespace kiss {
 	std::string_view trim (std::string_view sv);
 
 	// wrapper class around a std::string to use as a key for unordered_maps that allows find with string_view to avoid heap allocs
+	// (FlatHashMap<std::string, T> in flat_hash_map.hpp can find with a string_view directly)
 	struct map_string {
 		std::string str; // store string views for actual keys
 		std::string_view sv; // use string view for actual comparison and hashing
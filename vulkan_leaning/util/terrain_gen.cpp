@@ -0,0 +1,67 @@
+#include "terrain_gen.hpp"
+#include <algorithm>
+#include <cmath>
+#include <climits>
+
+static int height_from_noise (TerrainSettings const& s, float n) {
+	return (int)std::ceil(s.base_height + s.height_amplitude * n);
+}
+
+int TerrainGenerator::surface_height (int x, int y) const {
+	return height_from_noise(settings, noise.fbm(float2((float)x, (float)y), settings.height));
+}
+
+std::unique_ptr<Chunk> TerrainGenerator::generate (chunk_coord coord) const {
+	voxel_coord base = coord * CHUNK_SIZE;
+
+	float heights[CHUNK_SIZE * CHUNK_SIZE];
+	noise.fill_fbm(float2((float)base.x, (float)base.y), 1.0f, int2(CHUNK_SIZE), settings.height, heights);
+
+	int surface[CHUNK_SIZE * CHUNK_SIZE];
+	int min_surface = INT_MAX, max_surface = INT_MIN;
+	for (int i=0; i<CHUNK_SIZE * CHUNK_SIZE; ++i) {
+		surface[i] = height_from_noise(settings, heights[i]);
+		min_surface = std::min(min_surface, surface[i]);
+		max_surface = std::max(max_surface, surface[i]);
+	}
+
+	if (max_surface <= base.z)
+		return nullptr; // above the terrain
+
+	bool caves = settings.caves.octaves > 0;
+
+	if (!caves && base.z + CHUNK_SIZE <= min_surface - settings.dirt_depth)
+		return std::make_unique<Chunk>(coord, settings.stone); // below the dirt
+
+	// cave noise only for the layers that have solid voxels
+	int layers = std::min(max_surface - base.z, CHUNK_SIZE);
+	std::unique_ptr<float[]> cave;
+	if (caves) {
+		cave = std::make_unique<float[]>((size_t)layers * CHUNK_SIZE * CHUNK_SIZE);
+		noise.fill_fbm((float3)base, 1.0f, int3(CHUNK_SIZE, CHUNK_SIZE, layers), settings.caves, cave.get());
+	}
+
+	auto ids = std::make_unique<block_id[]>(CHUNK_VOXELS);
+	for (int z=0; z<CHUNK_SIZE; ++z)
+	for (int y=0; y<CHUNK_SIZE; ++y)
+	for (int x=0; x<CHUNK_SIZE; ++x) {
+		int i = get_voxel_index(x,y,z);
+		int depth = surface[y * CHUNK_SIZE + x] - (base.z + z); // 1 for the top voxel
+
+		block_id id = B_AIR;
+		if (depth > settings.dirt_depth)	id = settings.stone;
+		else if (depth > 1)					id = settings.dirt;
+		else if (depth > 0)					id = settings.grass;
+
+		if (id != B_AIR && caves && cave[i] > settings.cave_threshold)
+			id = B_AIR;
+
+		ids[i] = id;
+	}
+
+	auto chunk = std::make_unique<Chunk>(coord);
+	chunk->set_blocks(ids.get());
+	if (chunk->solid_count == 0)
+		return nullptr;
+	return chunk;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "voxel_world.hpp"
+#include "noise.hpp"
+
+struct TerrainSettings {
+	uint64_t	seed = 0;
+
+	// surface z = base_height + height_amplitude * height fbm (2d over x,y), z is up
+	float		base_height = 24;
+	float		height_amplitude = 20;
+	FbmSettings	height = { NOISE_SIMPLEX, 5, 1.0f / 128, 2.0f, 0.5f, /* warp */ 24.0f, 1.0f / 256, 2 };
+
+	// voxels below the surface where the cave fbm (3d) is above cave_threshold are air, octaves = 0 disables caves
+	FbmSettings	caves = { NOISE_SIMPLEX, 2, 1.0f / 48, 2.0f, 0.5f };
+	float		cave_threshold = 0.45f;
+
+	int			dirt_depth = 3; // voxels of dirt above the stone, the top one is grass
+
+	block_id	stone = 1;
+	block_id	dirt = 2;
+	block_id	grass = 3;
+};
+
+// Generates chunks from noise
+//  a chunk is a pure function of the settings and its coord, so the world comes out the same for any thread count and generation order
+//  columns get their surface heights from one 2d fill (32x32 samples), the 3d cave noise is only evaluated for layers below the highest surface
+class TerrainGenerator {
+public:
+	TerrainSettings	settings;
+	Noise			noise;
+
+	TerrainGenerator (TerrainSettings const& settings): settings{settings}, noise{settings.seed} {}
+
+	// surface z of the column, voxels with z < surface_height are solid (ignoring caves)
+	int surface_height (int x, int y) const;
+
+	// nullptr if the chunk is all air
+	std::unique_ptr<Chunk> generate (chunk_coord coord) const;
+};
@@ -1,5 +1,6 @@
 #include "threadpool.hpp"
 #include "assert.h"
+#include "profiler.hpp"
 
 #if defined(_WIN32)
 	#include "windows.h"
@@ -20,5 +21,29 @@
 
 	void set_thread_description (std::string_view description) {
 		SetThreadDescription(GetCurrentThread(), kiss::utf8_to_wchar(description).c_str());
+		profiler::set_thread_name(description);
+	}
+#else
+	#include <pthread.h>
+	#include <sched.h>
+	#include <string>
+
+	void set_process_high_priority () {
+		// raising the priority needs privileges on linux, leave it to the user (nice)
+	}
+
+	void set_thread_high_priority () {
+		// SCHED_OTHER has no per thread priorities without privileges, same as above
+	}
+
+	void set_thread_preferred_core (int preferred_core) {
+		// no soft preference like SetThreadIdealProcessor, pinning to one core would hurt more than help
+		(void)preferred_core;
+	}
+
+	void set_thread_description (std::string_view description) {
+		std::string name = std::string(description.substr(0, 15)); // limited to 16 chars including the null
+		pthread_setname_np(pthread_self(), name.c_str());
+		profiler::set_thread_name(description);
 	}
 #endif
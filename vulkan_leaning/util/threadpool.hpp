@@ -2,6 +2,7 @@
 #include <thread>
 #include "threadsafe_queue.hpp"
 #include "string.hpp"
+#include "profiler.hpp"
 
 // std::thread::hardware_concurrency() gets the number of cpu threads
 
@@ -40,6 +41,7 @@ class Threadpool {
 		// Wait for one job to pop and execute or until shutdown signal is sent via jobs.shutdown()
 		Job job;
 		while (jobs.pop_or_shutdown(&job) != decltype(jobs)::SHUTDOWN) {
+			PROFILE_SCOPED("threadpool job");
 			results.push(job.execute());
 		}
 	}
@@ -89,6 +91,7 @@ public:
 		// Wait for one job to pop and execute or until shutdown signal is sent via jobs.shutdown()
 		Job job;
 		while (jobs.try_pop(&job)) {
+			PROFILE_SCOPED("threadpool job");
 			results.push(job.execute());
 		}
 	}
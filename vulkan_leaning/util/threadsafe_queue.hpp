@@ -45,7 +45,8 @@ public:
 	// wait to dequeue one element from the queue or until shutdown is set
 	// returns if element was popped or shutdown was set as enum
 	// can be called from multiple threads (multiple consumer)
-	enum { POP, SHUTDOWN } pop_or_shutdown (T* out) {
+	enum PopResult { POP, SHUTDOWN };
+	PopResult pop_or_shutdown (T* out) {
 		std::unique_lock<std::mutex> lock(m);
 
 		while(!shutdown_flag && q.empty()) {
@@ -0,0 +1,116 @@
+#include "virtual_memory.hpp"
+#include "assert.h"
+
+#if defined(_WIN32)
+	#include "clean_windows_h.hpp"
+	#include <psapi.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/resource.h>
+	#include <unistd.h>
+#endif
+
+namespace virtual_memory {
+	static size_t round_up (size_t x, size_t to) {
+		return (x + to - 1) / to * to;
+	}
+
+#if defined(_WIN32)
+	size_t page_size () {
+		static size_t size = [] () {
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return (size_t)info.dwPageSize;
+		}();
+		return size;
+	}
+
+	void* reserve (size_t size, size_t alignment) {
+		size = round_up(size, page_size());
+		if (alignment <= 64 * 1024) // VirtualAlloc reservations are always 64KB aligned
+			return VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+
+		// reserve more, then reserve the aligned part again (can fail if another thread takes the range in between, so retry)
+		for (int attempt=0; attempt<8; ++attempt) {
+			char* p = (char*)VirtualAlloc(NULL, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+			if (!p)
+				return nullptr;
+			VirtualFree(p, 0, MEM_RELEASE);
+
+			char* aligned = (char*)round_up((size_t)p, alignment);
+			if (void* res = VirtualAlloc(aligned, size, MEM_RESERVE, PAGE_NOACCESS))
+				return res;
+		}
+		return nullptr;
+	}
+	void release (void* ptr, size_t size) {
+		VirtualFree(ptr, 0, MEM_RELEASE);
+	}
+
+	bool commit (void* ptr, size_t size) {
+		return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+	}
+	void decommit (void* ptr, size_t size) {
+		VirtualFree(ptr, size, MEM_DECOMMIT);
+	}
+
+	void advise_huge_pages (void* ptr, size_t size) {}
+
+	size_t peak_resident_size () {
+		PROCESS_MEMORY_COUNTERS info;
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)))
+			return 0;
+		return info.PeakWorkingSetSize;
+	}
+#else
+	size_t page_size () {
+		static size_t size = (size_t)sysconf(_SC_PAGESIZE);
+		return size;
+	}
+
+	void* reserve (size_t size, size_t alignment) {
+		size = round_up(size, page_size());
+		if (alignment <= page_size()) {
+			void* p = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			return p == MAP_FAILED ? nullptr : p;
+		}
+
+		// reserve more and unmap the unaligned head and tail
+		char* p = (char*)mmap(nullptr, size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (p == (char*)MAP_FAILED)
+			return nullptr;
+
+		char* aligned = (char*)round_up((size_t)p, alignment);
+		size_t head = aligned - p;
+		size_t tail = alignment - head;
+		if (head) munmap(p, head);
+		if (tail) munmap(aligned + size, tail);
+		return aligned;
+	}
+	void release (void* ptr, size_t size) {
+		munmap(ptr, round_up(size, page_size()));
+	}
+
+	bool commit (void* ptr, size_t size) {
+		return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+	}
+	void decommit (void* ptr, size_t size) {
+		// drop the pages (reads give zeros again), then make the range inaccessible like it was before the commit
+		madvise(ptr, size, MADV_DONTNEED);
+		mprotect(ptr, size, PROT_NONE);
+	}
+
+	void advise_huge_pages (void* ptr, size_t size) {
+	#if defined(MADV_HUGEPAGE)
+		madvise(ptr, size, MADV_HUGEPAGE);
+	#endif
+	}
+
+	size_t peak_resident_size () {
+		rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
+			return 0;
+		return (size_t)usage.ru_maxrss * 1024; // in KB on linux
+	}
+#endif
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "stdint.h"
+#include <cstddef>
+
+// Reserving address space and committing memory to it separately
+//  reserve() only takes address space (no memory, no commit charge), commit() makes pages usable, the os backs them with memory on first touch
+//  decommit() gives the memory back but keeps the addresses reserved, committing again gives zeroed pages
+//  all sizes and addresses have to be multiples of page_size() (reserve() rounds up itself)
+namespace virtual_memory {
+	size_t page_size ();
+	// 2MB on x86-64, transparent huge pages need 2MB aligned and sized ranges
+	constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	// returns nullptr on fail, alignment has to be a power of two multiple of page_size()
+	void* reserve (size_t size, size_t alignment=0);
+	void release (void* ptr, size_t size);
+
+	bool commit (void* ptr, size_t size);
+	void decommit (void* ptr, size_t size);
+
+	// ask for transparent huge pages (linux madvise), does nothing on windows, where large pages need a privilege and can not be committed lazily
+	void advise_huge_pages (void* ptr, size_t size);
+
+	// highest physical memory use of the process so far (peak working set / max rss), for benchmarks
+	size_t peak_resident_size ();
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include "virtual_memory.hpp"
+#include "assert.h"
+#include <cstdlib>
+#include <cstdio>
+#include <utility>
+
+// std::vector style array that reserves address space for max_size elements up front and commits memory as it grows
+//  never copies: elements keep their address for the lifetime of the vector, growing to hundreds of MB has no copy spikes and no 2x peak memory
+//  memory is committed in steps of at least commit_granularity (64KB, 2MB with huge pages) and 1/2 of what is committed already, to keep the syscalls few
+//  shrink_to_fit() decommits the memory after size, the address space stays reserved
+//  max_size is only address space, reserving a lot is fine on 64 bit (eg. 64GB for an array that might grow to a few GB)
+// like UnsafeVector: does not call constructors or destructors, only use with trivial types (committed memory starts out zeroed though)
+template <typename T>
+struct VirtualVector {
+	T*		ptr = nullptr;
+	size_t	size = 0;
+	size_t	committed = 0; // elements that memory is committed for
+	size_t	max_size = 0; // elements that address space is reserved for
+
+	size_t	reserved_bytes = 0;
+	size_t	committed_bytes = 0;
+	size_t	commit_granularity = 0;
+
+	VirtualVector () {}
+
+	// huge_pages: 2MB aligned reservation and commit steps, and ask the os for transparent huge pages (fewer tlb misses and page faults for big arrays)
+	VirtualVector (size_t max_size, bool huge_pages=false) {
+		commit_granularity = huge_pages ? virtual_memory::HUGE_PAGE_SIZE : 64 * 1024;
+		commit_granularity = commit_granularity > virtual_memory::page_size() ? commit_granularity : virtual_memory::page_size();
+
+		reserved_bytes = (max_size * sizeof(T) + commit_granularity - 1) / commit_granularity * commit_granularity;
+		ptr = (T*)virtual_memory::reserve(reserved_bytes, huge_pages ? virtual_memory::HUGE_PAGE_SIZE : 0);
+		assert(ptr);
+		if (!ptr)
+			abort(); // address space is not expected to run out
+
+		if (huge_pages)
+			virtual_memory::advise_huge_pages(ptr, reserved_bytes);
+
+		this->max_size = reserved_bytes / sizeof(T);
+	}
+	~VirtualVector () {
+		if (ptr)
+			virtual_memory::release(ptr, reserved_bytes);
+	}
+
+private:
+	void _commit (size_t new_size) {
+		size_t needed = new_size * sizeof(T);
+		size_t target = committed_bytes + committed_bytes / 2;
+		target = target > needed ? target : needed;
+		target = (target + commit_granularity - 1) / commit_granularity * commit_granularity;
+		target = target < reserved_bytes ? target : reserved_bytes;
+
+		bool ok = virtual_memory::commit((char*)ptr + committed_bytes, target - committed_bytes);
+		assert(ok);
+		if (!ok)
+			abort(); // out of memory
+
+		committed_bytes = target;
+		committed = committed_bytes / sizeof(T);
+	}
+	// the reservation can not grow, writing past it would corrupt memory (a default constructed vector has nothing reserved)
+	void _check_space (size_t new_size) {
+		assert(new_size <= max_size);
+		if (new_size > max_size) {
+			fprintf(stderr, "VirtualVector: size %zu exceeds the reserved max_size %zu\n", new_size, max_size);
+			abort();
+		}
+	}
+public:
+
+	// never decommits, see shrink_to_fit
+	void resize (size_t new_size) {
+		if (new_size > committed) {
+			_check_space(new_size);
+			_commit(new_size);
+		}
+		size = new_size;
+	}
+	void clear () {
+		size = 0;
+	}
+
+	// give back the memory after size to the os
+	void shrink_to_fit () {
+		size_t keep = (size * sizeof(T) + commit_granularity - 1) / commit_granularity * commit_granularity;
+		if (keep >= committed_bytes)
+			return;
+
+		virtual_memory::decommit((char*)ptr + keep, committed_bytes - keep);
+		committed_bytes = keep;
+		committed = committed_bytes / sizeof(T);
+	}
+
+	void push_back (T val) {
+		if (size == committed) {
+			_check_space(size + 1);
+			_commit(size + 1);
+		}
+		ptr[size++] = std::move(val);
+	}
+
+	T const& operator[] (size_t index) const {
+		assert(index < size);
+		return ptr[index];
+	}
+	T& operator[] (size_t index) {
+		assert(index < size);
+		return ptr[index];
+	}
+
+	T* begin () { return ptr; }
+	T* end () { return ptr + size; }
+
+	static void swap (VirtualVector& l, VirtualVector& r) {
+		std::swap(l.ptr, r.ptr);
+		std::swap(l.size, r.size);
+		std::swap(l.committed, r.committed);
+		std::swap(l.max_size, r.max_size);
+		std::swap(l.reserved_bytes, r.reserved_bytes);
+		std::swap(l.committed_bytes, r.committed_bytes);
+		std::swap(l.commit_granularity, r.commit_granularity);
+	}
+
+	// copy
+	VirtualVector (VirtualVector const& r) = delete;
+	VirtualVector& operator= (VirtualVector const& r) = delete;
+	// move
+	VirtualVector (VirtualVector&& r) {				swap(*this, r); }
+	VirtualVector& operator= (VirtualVector&& r) {	swap(*this, r); return *this; }
+};
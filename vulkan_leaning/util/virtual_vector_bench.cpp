@@ -0,0 +1,67 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "virtual_vector.hpp"
+#include "raw_array.hpp"
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// push_back of uint64 until the array is 1GB, for VirtualVector (with and without huge pages), UnsafeVector and std::vector
+//  worst is the slowest block of 1024 push_backs, which shows the copy of a reallocation (or the commit of VirtualVector)
+//  peak memory is per process, so only one vector type is measured per run
+//  extra elements over exactly 1GB show the case where a reallocating vector just doubled to 2GB
+namespace {
+	template <typename V> void grow (V& v, char const* name, size_t count) {
+		const size_t BLOCK = 1024;
+
+		double total = 0, worst = 0;
+		for (size_t j=0; j<count; j+=BLOCK) {
+			size_t end = j + BLOCK < count ? j + BLOCK : count;
+
+			auto t = kiss::Timer::start();
+			for (size_t i=j; i<end; ++i)
+				v.push_back(i);
+			double sec = t.end();
+
+			total += sec;
+			if (sec > worst) worst = sec;
+		}
+
+		// read back, so the pushes can not be optimized away
+		uint64_t sum = 0;
+		for (size_t i=0; i<count; i+=4096)
+			sum += v[i];
+
+		printf("%-12s %zu elements  %.3f s  worst %zu pushes %.1f ms  peak memory %zu MB  (%llu)\n", name, count,
+			total, BLOCK, worst * 1000, virtual_memory::peak_resident_size() / (1024*1024), (unsigned long long)sum);
+	}
+}
+
+int bench_virtual_vector (int argc, char** argv) {
+	if (argc < 1) {
+		fprintf(stderr, "usage: vulkan_leaning --bench virtual_vector <virtual|virtual_thp|unsafe|std> [extra elements]\n");
+		return 1;
+	}
+	const char* type = argv[0];
+	size_t count = (1ull << 30) / sizeof(uint64_t) + (argc > 1 ? (size_t)atoll(argv[1]) : 0);
+	size_t max_size = (16ull << 30) / sizeof(uint64_t); // only address space
+
+	if (strcmp(type, "virtual") == 0) {
+		VirtualVector<uint64_t> v (max_size);
+		grow(v, type, count);
+	} else if (strcmp(type, "virtual_thp") == 0) {
+		VirtualVector<uint64_t> v (max_size, true);
+		grow(v, type, count);
+	} else if (strcmp(type, "unsafe") == 0) {
+		UnsafeVector<uint64_t> v (16);
+		grow(v, type, count);
+	} else if (strcmp(type, "std") == 0) {
+		std::vector<uint64_t> v;
+		grow(v, type, count);
+	} else {
+		fprintf(stderr, "unknown vector type %s\n", type);
+		return 1;
+	}
+	return 0;
+}
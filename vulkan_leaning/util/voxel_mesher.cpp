@@ -0,0 +1,271 @@
+#include "voxel_mesher.hpp"
+#include "assert.h"
+#include "alloc_tracking.hpp"
+#include <algorithm>
+
+//// ChunkMeshInput
+
+void ChunkMeshInput::gather (VoxelWorld const& world, Chunk const& chunk) {
+	coord = chunk.coord;
+	blocks = chunk.blocks;
+
+	OccupancyChunk const* neighbours[3][3][3]; // [z][y][x]
+	for (int dz=-1; dz<=1; ++dz)
+	for (int dy=-1; dy<=1; ++dy)
+	for (int dx=-1; dx<=1; ++dx) {
+		neighbours[dz+1][dy+1][dx+1] = dx == 0 && dy == 0 && dz == 0 ?
+			(chunk.solid_count > 0 ? &chunk.occupancy : nullptr) :
+			world.get_occupancy(coord + int3(dx,dy,dz));
+	}
+
+	for (int pz=0; pz<MESH_PAD; ++pz)
+	for (int py=0; py<MESH_PAD; ++py) {
+		// padded coord 0 is the last voxel of the -neighbour, MESH_PAD-1 the first of the +neighbour
+		int nz = pz == 0 ? 0 : (pz == MESH_PAD-1 ? 2 : 1);
+		int ny = py == 0 ? 0 : (py == MESH_PAD-1 ? 2 : 1);
+		int row = OccupancyChunk::row_index((py - 1) & CHUNK_SIZE_MASK, (pz - 1) & CHUNK_SIZE_MASK);
+
+		auto get_row = [&] (int nx) -> uint64_t {
+			OccupancyChunk const* occ = neighbours[nz][ny][nx];
+			return occ ? occ->rows[row] : 0;
+		};
+
+		solid[pz * MESH_PAD + py] = (get_row(0) >> CHUNK_SIZE_MASK) | (get_row(1) << 1) | ((get_row(2) & 1) << (MESH_PAD-1));
+	}
+}
+
+//// mesh_chunk
+
+// chunk local voxel of slice d, row c, bit b of a slice on axis
+static int3 slice_to_voxel (int axis, int d, int b, int c) {
+	if (axis == 0) return int3(d, b, c);
+	if (axis == 1) return int3(b, d, c);
+	return int3(b, c, d);
+}
+
+void mesh_chunk (ChunkMeshInput const& input, std::vector<VoxelFace>* faces, bool greedy) {
+	// padded occupancy as columns along each axis, indexed by the padded coords of the two other axes in xyz order
+	//  cols[axis][c * MESH_PAD + b], bit is the padded coord on the axis
+	static constexpr int COLS = MESH_PAD * MESH_PAD;
+	std::unique_ptr<uint64_t[]> cols_mem = std::make_unique<uint64_t[]>(3 * COLS);
+	uint64_t* cols[3] = { cols_mem.get(), cols_mem.get() + COLS, cols_mem.get() + 2*COLS };
+
+	memcpy(cols[0], input.solid, sizeof(input.solid));
+
+	for (int pz=0; pz<MESH_PAD; ++pz)
+	for (int py=0; py<MESH_PAD; ++py) {
+		uint64_t bits = input.solid[pz * MESH_PAD + py];
+		while (bits) {
+			int px = count_trailing_zeros(bits);
+			bits &= bits - 1;
+
+			cols[1][pz * MESH_PAD + px] |= 1ull << py;
+			cols[2][py * MESH_PAD + px] |= 1ull << pz;
+		}
+	}
+
+	// visible faces as slices: planes[d][c] bit b
+	uint32_t planes[CHUNK_SIZE][CHUNK_SIZE];
+	uint32_t keys[CHUNK_SIZE][CHUNK_SIZE]; // block | ao << 16 of the visible faces of one slice
+
+	for (int axis=0; axis<3; ++axis)
+	for (int positive=0; positive<2; ++positive) {
+		int face = axis*2 + positive;
+		uint64_t const* axis_cols = cols[axis];
+
+		memset(planes, 0, sizeof(planes));
+		uint32_t used_slices = 0;
+
+		for (int c=0; c<CHUNK_SIZE; ++c)
+		for (int b=0; b<CHUNK_SIZE; ++b) {
+			uint64_t col = axis_cols[(c+1) * MESH_PAD + (b+1)];
+			// solid voxels whose neighbour in face direction is not solid, shifted to chunk local coords
+			uint64_t visible = positive ? col & ~(col >> 1) : col & ~(col << 1);
+			uint32_t bits = (uint32_t)(visible >> 1);
+
+			used_slices |= bits;
+			while (bits) {
+				int d = count_trailing_zeros(bits);
+				bits &= bits - 1;
+				planes[d][c] |= 1u << b;
+			}
+		}
+
+		while (used_slices) {
+			int d = count_trailing_zeros(used_slices);
+			used_slices &= used_slices - 1;
+
+			uint32_t* rows = planes[d];
+
+			// padded coord of the air voxel in front of the faces
+			int front = d + 1 + (positive ? 1 : -1);
+			auto solid = [&] (int b, int c) -> uint32_t { // padded b c
+				return (uint32_t)(axis_cols[c * MESH_PAD + b] >> front) & 1u;
+			};
+
+			for (int c=0; c<CHUNK_SIZE; ++c) {
+				uint32_t bits = rows[c];
+				while (bits) {
+					int b = count_trailing_zeros(bits);
+					bits &= bits - 1;
+
+					// ao from the 8 voxels around the front voxel, corner order (b-,c-) (b+,c-) (b+,c+) (b-,c+)
+					int pb = b + 1, pc = c + 1;
+					uint32_t b0 = solid(pb-1, pc), b1 = solid(pb+1, pc);
+					uint32_t c0 = solid(pb, pc-1), c1 = solid(pb, pc+1);
+					auto corner_ao = [] (uint32_t s1, uint32_t s2, uint32_t corner) -> uint32_t {
+						return s1 && s2 ? 0 : 3 - (s1 + s2 + corner);
+					};
+					uint32_t ao = corner_ao(b0, c0, solid(pb-1, pc-1))
+					            | corner_ao(b1, c0, solid(pb+1, pc-1)) << 2
+					            | corner_ao(b1, c1, solid(pb+1, pc+1)) << 4
+					            | corner_ao(b0, c1, solid(pb-1, pc+1)) << 6;
+
+					int3 v = slice_to_voxel(axis, d, b, c);
+					keys[c][b] = (uint32_t)input.blocks.get(get_voxel_index(v.x, v.y, v.z)) | ao << 16;
+				}
+			}
+
+			// greedy merge: take the first remaining face, extend along b while the keys match, then extend along c while the whole run matches
+			for (int c=0; c<CHUNK_SIZE; ++c) {
+				while (rows[c]) {
+					int b = count_trailing_zeros(rows[c]);
+					uint32_t key = keys[c][b];
+
+					int w = 1;
+					int h = 1;
+					if (greedy) {
+						while (b+w < CHUNK_SIZE && ((rows[c] >> (b+w)) & 1u) && keys[c][b+w] == key)
+							w++;
+					}
+
+					uint32_t mask = (uint32_t)(((1ull << w) - 1) << b);
+					rows[c] &= ~mask;
+
+					if (greedy) {
+						for (; c+h < CHUNK_SIZE; ++h) {
+							if ((rows[c+h] & mask) != mask)
+								break;
+
+							bool match = true;
+							for (int i=b; i<b+w; ++i) {
+								if (keys[c+h][i] != key) {
+									match = false;
+									break;
+								}
+							}
+							if (!match)
+								break;
+
+							rows[c+h] &= ~mask;
+						}
+					}
+
+					faces->push_back(VoxelFace::pack(slice_to_voxel(axis, d, b, c), face, w, h, (block_id)(key & 0xffff), key >> 16));
+				}
+			}
+		}
+	}
+}
+
+//// ChunkMeshJob
+
+ChunkMeshResult ChunkMeshJob::execute () {
+	ALLOC_TAG("meshing");
+
+	auto timer = kiss::Timer::start();
+
+	ChunkMeshResult res;
+	res.coord = input->coord;
+	res.version = version;
+	mesh_chunk(*input, &res.faces, greedy);
+
+	res.time = timer.end();
+	return res;
+}
+
+//// ChunkMesher
+
+void ChunkMesher::update (VoxelWorld& world, float3 camera_pos) {
+	ALLOC_TAG("meshing");
+
+	dirty.set_point(camera_pos);
+
+	for (chunk_coord coord : world.dirty_chunks) {
+		if (world.get_chunk(coord)) {
+			dirty.push(coord);
+		} else {
+			// chunk was removed
+			if (meshes.erase(coord))
+				uploads.push_back(coord);
+		}
+	}
+	world.dirty_chunks.clear();
+
+	collect_results();
+
+	if (!dirty.empty() && pending < max_in_flight) {
+		auto timer = kiss::Timer::start();
+
+		chunk_coord coord;
+		while (pending < max_in_flight && timer.end() < time_budget && dirty.pop(&coord)) {
+			Chunk* chunk = world.get_chunk(coord);
+			if (!chunk || !chunk->mesh_dirty)
+				continue; // removed (and maybe recreated and already queued) since it got dirty
+
+			chunk->mesh_dirty = false;
+
+			ChunkMeshJob job;
+			job.input = std::make_unique<ChunkMeshInput>();
+			job.input->gather(world, *chunk);
+			job.version = next_version++;
+			job.greedy = greedy;
+
+			// create entry, so that apply can tell removed chunks apart
+			auto entry = meshes.try_emplace(coord);
+			if (entry.second)
+				entry.first->version = job.version - 1; // results that are still in flight for a removed chunk with this coord are stale
+
+			pool.jobs.push(std::move(job));
+			pending++;
+		}
+	}
+}
+
+void ChunkMesher::collect_results (bool wait) {
+	if (wait)
+		pool.contribute_work();
+
+	ChunkMeshResult res;
+	while (pending > 0) {
+		if (wait)
+			res = pool.results.pop();
+		else if (!pool.results.try_pop(&res))
+			break;
+
+		pending--;
+		apply(res);
+	}
+}
+
+void ChunkMesher::apply (ChunkMeshResult& res) {
+	chunks_meshed++;
+	total_mesh_time += res.time;
+	total_faces += res.faces.size();
+
+	ChunkMesh* found = meshes.find(res.coord);
+	if (!found)
+		return; // chunk was removed while meshing
+
+	ChunkMesh& mesh = *found;
+	if (res.version <= mesh.version)
+		return; // newer mesh was already applied
+
+	mesh.faces = std::move(res.faces);
+	mesh.version = res.version;
+
+	if (!mesh.upload_pending) {
+		mesh.upload_pending = true;
+		uploads.push_back(res.coord);
+	}
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include "voxel_world.hpp"
+#include "chunk_priority_queue.hpp"
+#include "threadpool.hpp"
+#include "timer.hpp"
+#include "flat_hash_map.hpp"
+#include "assert.h"
+
+// chunk plus a one voxel border from the neighbouring chunks (needed for face culling and AO across chunk boundaries)
+static constexpr int MESH_PAD = CHUNK_SIZE + 2;
+
+// Packed face quad (8 bytes) as produced by the mesher
+//  word0: x:5 y:5 z:5 face:3 (w-1):5 (h-1):5   x,y,z is the voxel in the chunk with the min corner of the quad
+//  word1: block:16 ao:8                        ao is 2 bits per corner (0 = fully occluded, 3 = open)
+//  face is -x,+x,-y,+y,-z,+z like push_cube, w and h extend the quad along the two other axes in xyz order (face x -> w along y, h along z)
+//  corner order for ao is (w-,h-) (w+,h-) (w+,h+) (w-,h+)
+struct VoxelFace {
+	uint32_t	word0;
+	uint32_t	word1;
+
+	static VoxelFace pack (int3 pos, int face, int w, int h, block_id block, uint32_t ao) {
+		return { (uint32_t)pos.x | (uint32_t)pos.y << 5 | (uint32_t)pos.z << 10 | (uint32_t)face << 15 | (uint32_t)(w-1) << 18 | (uint32_t)(h-1) << 23,
+			(uint32_t)block | ao << 16 };
+	}
+
+	int3 get_pos () const	{ return int3(word0 & 31, (word0 >> 5) & 31, (word0 >> 10) & 31); }
+	int get_face () const	{ return (word0 >> 15) & 7; }
+	int get_w () const		{ return ((word0 >> 18) & 31) + 1; }
+	int get_h () const		{ return ((word0 >> 23) & 31) + 1; }
+	block_id get_block () const	{ return (block_id)(word1 & 0xffff); }
+	uint32_t get_ao () const	{ return (word1 >> 16) & 0xff; }
+};
+
+// 32 bit face for the vertex pulling renderer (shaders/voxel.vert)
+//  x:5 y:5 z:5 face:3 ao:8 block:6
+//  only unit faces fit (mesh with greedy=false), block ids get truncated to FACE_WORD_BLOCK_BITS
+static constexpr int FACE_WORD_BLOCK_BITS = 6;
+
+inline uint32_t pack_face_word (VoxelFace f) {
+	assert(f.get_w() == 1 && f.get_h() == 1);
+	uint32_t block = f.get_block() & ((1u << FACE_WORD_BLOCK_BITS) - 1);
+	return (f.word0 & 0x3ffffu) | f.get_ao() << 18 | block << 26; // word0 has x,y,z,face in the low 18 bits already
+}
+
+// Snapshot of everything needed to mesh one chunk, gathered on the main thread so the worker does not touch the world
+struct ChunkMeshInput {
+	chunk_coord	coord;
+	// solid bit of padded voxel (px,py,pz) is bit px of solid[pz * MESH_PAD + py], padded coord = chunk coord + 1
+	uint64_t	solid[MESH_PAD * MESH_PAD];
+	ChunkBlocks	blocks; // copy of the chunks blocks (only read for visible faces)
+
+	bool get_solid (int px, int py, int pz) const {
+		return (solid[pz * MESH_PAD + py] >> px) & 1u;
+	}
+
+	// copy occupancy of the chunk and the border of its 26 neighbours
+	void gather (VoxelWorld const& world, Chunk const& chunk);
+};
+
+// Binary greedy meshing
+//  face culling is done on 64 bit columns of the padded occupancy for all voxels of a column at once: col & ~(col >> 1) are the +faces
+//  visible faces are then greedily merged per slice into quads of equal block id and ao, using bit masks of the slice rows
+//  greedy=false outputs one quad per visible voxel face (still culled)
+void mesh_chunk (ChunkMeshInput const& input, std::vector<VoxelFace>* faces, bool greedy=true);
+
+struct ChunkMeshResult {
+	chunk_coord				coord;
+	uint32_t				version;
+	std::vector<VoxelFace>	faces;
+	float					time; // seconds spent meshing on the worker
+};
+
+struct ChunkMeshJob {
+	std::unique_ptr<ChunkMeshInput>	input;
+	uint32_t						version;
+	bool							greedy;
+
+	ChunkMeshResult execute ();
+};
+
+// Remeshes dirty chunks on a threadpool
+//  update() takes VoxelWorld::dirty_chunks into its own dirty queue and queues jobs for the chunks closest to the camera first (see ChunkPriorityQueue)
+//   but only as long as the main thread time for gathering stays below time_budget and at most max_in_flight jobs are queued
+//   so bulk edits get spread over multiple frames instead of causing a hitch, the rest stays dirty for the next frames
+//  each job gets a increasing version, results that are older than the current mesh (chunk got edited again while meshing) are dropped
+//  finished meshes replace the old ones on the main thread in one move, so the renderer never waits for the workers
+//  the renderer gets the changed meshes via flush_uploads()
+class ChunkMesher {
+public:
+	struct ChunkMesh {
+		std::vector<VoxelFace>	faces;
+		uint32_t				version = 0; // version of the faces, results with lower versions are dropped
+		bool					upload_pending = false;
+	};
+
+	// an entry exists for every chunk that was queued at least once, chunks removed from the world get erased
+	FlatHashMap<chunk_coord, ChunkMesh> meshes;
+
+	bool greedy = true;
+
+	float	time_budget = 0.002f; // seconds of main thread time per update() for gathering inputs
+	int		max_in_flight; // limit queued jobs so that priorities are still mostly up to date once a thread takes the job (enough for about a frame of work)
+
+	// stats
+	uint64_t	chunks_meshed = 0;
+	double		total_mesh_time = 0; // summed over all threads
+	uint64_t	total_faces = 0;
+
+	ChunkMesher (int thread_count) {
+		pool.start_threads(thread_count, false, "mesher");
+		max_in_flight = thread_count * 32;
+	}
+
+	// queue dirty chunks closest to camera_pos first and apply finished meshes
+	void update (VoxelWorld& world, float3 camera_pos);
+
+	// chunks that are dirty but not queued yet
+	size_t dirty_count () const {
+		return dirty.size();
+	}
+	// jobs queued or running
+	int in_flight () const {
+		return pending;
+	}
+
+	// apply finished meshes, optionally blocking until all queued jobs are done (main thread helps with the jobs)
+	void collect_results (bool wait=false);
+
+	// call 'void func (chunk_coord, ChunkMesh const*)' for every mesh that changed since the last call
+	//  mesh is nullptr if the chunk was removed
+	template <typename FUNC>
+	void flush_uploads (FUNC func) {
+		for (chunk_coord coord : uploads) {
+			ChunkMesh* mesh = meshes.find(coord);
+			if (!mesh) {
+				func(coord, (ChunkMesh const*)nullptr);
+			} else if (mesh->upload_pending) { // skip duplicates
+				mesh->upload_pending = false;
+				func(coord, (ChunkMesh const*)mesh);
+			}
+		}
+		uploads.clear();
+	}
+
+	// chunks meshed per second per core
+	float chunks_per_sec () const {
+		return total_mesh_time > 0 ? (float)(chunks_meshed / total_mesh_time) : 0;
+	}
+
+private:
+	Threadpool<ChunkMeshJob>	pool;
+
+	std::vector<chunk_coord>	uploads;
+
+	ChunkPriorityQueue			dirty; // entries of chunks that got removed or are not mesh_dirty anymore get skipped when popped
+
+	uint32_t					next_version = 1;
+	int							pending = 0; // jobs queued but not collected
+
+	void apply (ChunkMeshResult& res);
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include "collision.hpp"
+#include "stdint.h"
+#include "string.h"
+
+// voxels per chunk axis, chunks are CHUNK_SIZE^3 voxels
+static constexpr int CHUNK_SIZE = 32;
+static constexpr int CHUNK_SIZE_SHIFT = 5;
+static constexpr int CHUNK_SIZE_MASK = CHUNK_SIZE - 1;
+static constexpr int CHUNK_VOXELS = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+
+typedef int3 chunk_coord;
+
+// chunk that contains the voxel (arithmetic shift == floor division, also correct for negative coords)
+inline chunk_coord get_chunk_coord (voxel_coord pos) {
+	return chunk_coord(pos.x >> CHUNK_SIZE_SHIFT, pos.y >> CHUNK_SIZE_SHIFT, pos.z >> CHUNK_SIZE_SHIFT);
+}
+// voxel position relative to the chunk it is in, [0, CHUNK_SIZE) on each axis
+inline int3 get_pos_in_chunk (voxel_coord pos) {
+	return int3(pos.x & CHUNK_SIZE_MASK, pos.y & CHUNK_SIZE_MASK, pos.z & CHUNK_SIZE_MASK);
+}
+
+// 1 bit per voxel solid/empty mask of one chunk (4KB)
+//  a row is all voxels along x for one y,z, so runs along x can be tested with one mask and bit scans
+struct OccupancyChunk {
+	uint32_t rows[CHUNK_SIZE * CHUNK_SIZE]; // bit x of rows[z * CHUNK_SIZE + y]
+
+	static int row_index (int y, int z) {
+		return z * CHUNK_SIZE + y;
+	}
+
+	void clear () {
+		memset(rows, 0, sizeof(rows));
+	}
+
+	bool get (int x, int y, int z) const {
+		return (rows[row_index(y,z)] >> x) & 1u;
+	}
+	void set (int x, int y, int z, bool solid) {
+		uint32_t& row = rows[row_index(y,z)];
+		row = solid ? row | (1u << x) : row & ~(1u << x);
+	}
+
+	bool is_empty () const {
+		for (auto row : rows)
+			if (row) return false;
+		return true;
+	}
+};
+
+// Batched voxel lookup for packet raycasts against a chunked occupancy grid
+//  GET_CHUNK is 'OccupancyChunk const* get_chunk (chunk_coord)', returning nullptr for chunks that are not loaded (treated as empty)
+//  each lane caches the chunk it is currently in, so get_chunk only gets called when a ray crosses a chunk boundary
+template <typename I, typename GET_CHUNK>
+struct OccupancyPacketLookup {
+	typedef typename I::mask_t M;
+	static constexpr int W = I::WIDTH;
+
+	GET_CHUNK get_chunk;
+
+	int cached_x[W], cached_y[W], cached_z[W];
+	OccupancyChunk const* chunks[W];
+
+	OccupancyPacketLookup (GET_CHUNK get_chunk): get_chunk{get_chunk} {
+		for (int i=0; i<W; ++i) {
+			cached_x[i] = cached_y[i] = cached_z[i] = INT32_MIN; // never a valid chunk coord, forces a lookup on first test
+			chunks[i] = nullptr;
+		}
+	}
+
+	// returns bitmask of lanes in 'active' whose voxel is solid
+	int test (I x, I y, I z, M active) {
+		I cx = x >> CHUNK_SIZE_SHIFT;
+		I cy = y >> CHUNK_SIZE_SHIFT;
+		I cz = z >> CHUNK_SIZE_SHIFT;
+
+		M same_chunk = (cx == I::load(cached_x)) & (cy == I::load(cached_y)) & (cz == I::load(cached_z));
+		int changed = andnot(active, same_chunk).bits();
+
+		if (changed) {
+			int new_x[W], new_y[W], new_z[W];
+			cx.store(new_x);
+			cy.store(new_y);
+			cz.store(new_z);
+
+			for (int i=0; i<W; ++i) {
+				if (changed & (1 << i)) {
+					cached_x[i] = new_x[i];
+					cached_y[i] = new_y[i];
+					cached_z[i] = new_z[i];
+					chunks[i] = get_chunk(chunk_coord(new_x[i], new_y[i], new_z[i]));
+				}
+			}
+		}
+
+		// bit test, scalar per lane since every lane can point into a different chunk
+		int lx[W], row[W];
+		(x & I(CHUNK_SIZE_MASK)).store(lx);
+		(((z & I(CHUNK_SIZE_MASK)) << CHUNK_SIZE_SHIFT) | (y & I(CHUNK_SIZE_MASK))).store(row);
+
+		int lanes = active.bits();
+		int hits = 0;
+		for (int i=0; i<W; ++i) {
+			if ((lanes & (1 << i)) && chunks[i])
+				hits |= (int)((chunks[i]->rows[row[i]] >> lx[i]) & 1u) << i;
+		}
+		return hits;
+	}
+};
@@ -0,0 +1,200 @@
+#pragma once
+#include "collision.hpp"
+#include "voxel_occupancy.hpp"
+#include "simd.hpp"
+#include "assert.h"
+
+// Packet version of VoxelRaycast
+//  steps W rays (W = F::WIDTH, 4 or 8) in lockstep, every lane does the same as VoxelRaycast::step() but branchless via lane masks
+//  lanes that reached max_dist (or got terminated by the caller) are masked out of 'active' and stop moving
+// F is simd::f32x4 or simd::f32x8
+template <typename F>
+struct VoxelRaycastPacket {
+	typedef typename F::int_t	I;
+	typedef typename F::mask_t	M;
+	static constexpr int W = F::WIDTH;
+
+	F			max_dist;
+	I			step_delta_x, step_delta_y, step_delta_z;
+	F			step_dist_x, step_dist_y, step_dist_z;
+	I			step_face_x, step_face_y, step_face_z; // face that gets entered when stepping on that axis
+
+	F			next_x, next_y, next_z;
+
+	I			cur_x, cur_y, cur_z;
+	I			cur_face;
+	F			cur_dist;
+
+	M			active;
+
+	// Start with up to W rays (lanes >= count start inactive), cur_* can be checked afterwards for the starting voxels (cur_face is -1 for those)
+	VoxelRaycastPacket (Ray const* rays, int count, float max_dist) {
+		assert(count >= 0 && count <= W);
+
+		// AoS -> SoA, unused lanes get a valid dummy ray so that they do not produce NaNs
+		float px[W], py[W], pz[W], dx[W], dy[W], dz[W];
+		for (int i=0; i<W; ++i) {
+			Ray r = i < count ? rays[i] : Ray{ float3(0), float3(1,0,0) };
+			px[i] = r.pos.x;	py[i] = r.pos.y;	pz[i] = r.pos.z;
+			dx[i] = r.dir.x;	dy[i] = r.dir.y;	dz[i] = r.dir.z;
+		}
+
+		this->max_dist = F(max_dist);
+		active = simd::first_n<M>(count);
+
+		init_axis(F::load(px), F::load(dx), 0, &step_delta_x, &step_dist_x, &step_face_x, &next_x, &cur_x);
+		init_axis(F::load(py), F::load(dy), 2, &step_delta_y, &step_dist_y, &step_face_y, &next_y, &cur_y);
+		init_axis(F::load(pz), F::load(dz), 4, &step_delta_z, &step_dist_z, &step_face_z, &next_z, &cur_z);
+
+		// how far to travel along the ray per unit on this axis
+		// ray_dir does not need to be normalized for this (like in VoxelRaycast), so divide by its length
+		F dir_len = sqrt(F::load(dx)*F::load(dx) + F::load(dy)*F::load(dy) + F::load(dz)*F::load(dz));
+		step_dist_x = step_dist_x * dir_len;
+		step_dist_y = step_dist_y * dir_len;
+		step_dist_z = step_dist_z * dir_len;
+		next_x = next_x * dir_len;
+		next_y = next_y * dir_len;
+		next_z = next_z * dir_len;
+
+		cur_face = I(-1); // rays start inside a voxel, no face was hit
+		cur_dist = F(0);
+	}
+
+	// step all active lanes into their next voxel
+	// returns the new active mask (lanes that were still inside max_dist)
+	M step () {
+		// find the axis of the cur step, same tie breaking as VoxelRaycast::find_next_axis
+		M x_min = (next_x < next_y) & (next_x < next_z);
+		M y_min = andnot(next_y < next_z, x_min);
+		M z_min = ~(x_min | y_min);
+
+		F dist = select(x_min, next_x, select(y_min, next_y, next_z));
+
+		active = active & (dist <= max_dist); // stop stepping lanes that reached max_dist
+
+		M ax = x_min & active;
+		M ay = y_min & active;
+		M az = z_min & active;
+
+		// clac the distance at which the next voxel step for this axis happens
+		next_x = next_x + mask(ax, step_dist_x);
+		next_y = next_y + mask(ay, step_dist_y);
+		next_z = next_z + mask(az, step_dist_z);
+		// step into the next voxel
+		cur_x = cur_x + mask(ax, step_delta_x);
+		cur_y = cur_y + mask(ay, step_delta_y);
+		cur_z = cur_z + mask(az, step_delta_z);
+
+		cur_dist = select(active, dist, cur_dist);
+		cur_face = select(ax, step_face_x, select(ay, step_face_y, select(az, step_face_z, cur_face)));
+
+		return active;
+	}
+
+	// stop stepping lanes (eg. because they hit something)
+	void terminate (int lanes) {
+		active = andnot(active, M::from_bits(lanes));
+	}
+
+private:
+	static void init_axis (F pos, F dir, int neg_face_offs, I* step_delta, F* step_dist, I* step_face, F* next, I* cur) {
+		M pos_dir = dir > F(0);
+		M neg_dir = dir < F(0);
+
+		// direction of ray on this axis (-1, 0, +1)
+		*step_delta = select(pos_dir, I(1), select(neg_dir, I(-1), I(0)));
+		*step_face = select(neg_dir, I(neg_face_offs +1), I(neg_face_offs));
+
+		// distance per unit on this axis, per unit ray length (gets scaled by ray length by caller)
+		// a zero in ray_dir produces Inf here, but next gets set to Inf anyway
+		*step_dist = F(1) / abs(dir);
+
+		// get initial positon in block and intial voxel coord
+		F pos_floor = floor(pos);
+		F pos_in_block = pos - pos_floor;
+
+		*cur = to_int(pos_floor);
+
+		// how far to step along ray to step into the next voxel for this axis
+		// NaN -> Inf
+		*next = select(pos_dir | neg_dir, *step_dist * select(pos_dir, F(1) - pos_in_block, pos_in_block), F(INF));
+	}
+};
+
+struct VoxelPacketHit {
+	voxel_coord	voxel;
+	int			face; // -1 if ray started inside block
+	float		dist;
+};
+
+// Raycast up to W rays against a chunked occupancy grid, writes hits[i] for each lane i that hit (bit i set in return value)
+//  lookup is a OccupancyPacketLookup (can be reused between calls to keep the chunk cache)
+//  iterations is optional and counts the lockstep iterations
+template <typename F, typename LOOKUP>
+int raycast_voxels_packet (Ray const* rays, int count, float max_dist, LOOKUP& lookup, VoxelPacketHit* hits, int* iterations=nullptr) {
+	typedef VoxelRaycastPacket<F> Packet;
+	constexpr int W = Packet::W;
+
+	Packet vrc = Packet(rays, count, max_dist);
+
+	auto record_hits = [&] (int hit_lanes) {
+		int x[W], y[W], z[W], face[W];
+		float dist[W];
+		vrc.cur_x.store(x);
+		vrc.cur_y.store(y);
+		vrc.cur_z.store(z);
+		vrc.cur_face.store(face);
+		vrc.cur_dist.store(dist);
+
+		for (int i=0; i<W; ++i) {
+			if (hit_lanes & (1 << i))
+				hits[i] = { voxel_coord(x[i], y[i], z[i]), face[i], dist[i] };
+		}
+	};
+
+	int hit = lookup.test(vrc.cur_x, vrc.cur_y, vrc.cur_z, vrc.active); // rays started inside block
+	if (hit) {
+		record_hits(hit);
+		vrc.terminate(hit);
+	}
+
+	int counter = 1;
+	while (any(vrc.active)) {
+		auto active = vrc.step();
+
+		int lanes_hit = lookup.test(vrc.cur_x, vrc.cur_y, vrc.cur_z, active);
+		if (lanes_hit) {
+			record_hits(lanes_hit);
+			vrc.terminate(lanes_hit);
+			hit |= lanes_hit;
+		}
+		++counter;
+	}
+
+	if (iterations) *iterations = counter;
+	return hit;
+}
+
+// Raycast any number of rays in packets of the widest available width
+//  get_chunk is 'OccupancyChunk const* get_chunk (chunk_coord)'
+//  out_hit[i] is true if rays[i] hit, in which case hits[i] is valid
+template <typename GET_CHUNK>
+void raycast_voxels_batch (Ray const* rays, int count, float max_dist, GET_CHUNK get_chunk, VoxelPacketHit* hits, bool* out_hit) {
+#if SIMD_HAS_AVX2
+	typedef simd::f32x8 F;
+#else
+	typedef simd::f32x4 F;
+#endif
+	constexpr int W = F::WIDTH;
+
+	OccupancyPacketLookup<typename F::int_t, GET_CHUNK> lookup (get_chunk);
+
+	for (int i=0; i<count; i += W) {
+		int n = count - i < W ? count - i : W;
+
+		int hit = raycast_voxels_packet<F>(rays + i, n, max_dist, lookup, hits + i);
+
+		for (int j=0; j<n; ++j)
+			out_hit[i + j] = (hit >> j) & 1;
+	}
+}
@@ -0,0 +1,427 @@
+#include "voxel_world.hpp"
+#include "assert.h"
+
+//// ChunkBlocks
+
+void ChunkBlocks::repack (int new_bits) {
+	assert(new_bits > bits);
+
+	auto new_words = std::make_unique<uint64_t[]>(word_count(new_bits));
+
+	if (bits != 0) { // bits == 0 -> all indices 0, which new_words already is
+		for (int i=0; i<CHUNK_VOXELS; ++i) {
+			uint32_t val = get_index(words.get(), bits, i);
+			if (new_bits == DIRECT_BITS)
+				val = palette[val];
+			set_index(new_words.get(), new_bits, i, val);
+		}
+	} else if (new_bits == DIRECT_BITS) {
+		for (int i=0; i<CHUNK_VOXELS; ++i)
+			set_index(new_words.get(), new_bits, i, palette[0]);
+	}
+
+	if (new_bits == DIRECT_BITS)
+		palette.clear();
+
+	words = std::move(new_words);
+	bits = new_bits;
+}
+
+void ChunkBlocks::set (int voxel_index, block_id id) {
+	if (bits == DIRECT_BITS) {
+		set_index(words.get(), bits, voxel_index, id);
+		return;
+	}
+
+	uint32_t pal_index = 0;
+	while (pal_index < palette.size && palette[pal_index] != id)
+		pal_index++;
+
+	if (pal_index == palette.size) {
+		palette.push_back(id);
+
+		if (palette.size > (1u << bits)) {
+			// palette does not fit into the indices anymore
+			int new_bits = bits == 0 ? 1 : bits * 2;
+			if (new_bits > 8) {
+				repack(DIRECT_BITS);
+				set_index(words.get(), bits, voxel_index, id);
+				return;
+			}
+			repack(new_bits);
+		}
+	}
+
+	if (bits == 0)
+		return; // single block chunk and id == palette[0]
+
+	set_index(words.get(), bits, voxel_index, pal_index);
+}
+
+void ChunkBlocks::set_all (block_id const* ids) {
+	palette.clear();
+	words = nullptr;
+	bits = 0;
+
+	// generated chunks have long runs of the same id, so the palette only gets searched when the id changes
+	auto find = [&] (block_id id) {
+		uint32_t i = 0;
+		while (i < palette.size && palette[i] != id)
+			i++;
+		return i;
+	};
+
+	block_id prev = ids[0];
+	palette.push_back(prev);
+	for (int i=1; i<CHUNK_VOXELS && palette.size <= 256; ++i) {
+		if (ids[i] != prev) {
+			prev = ids[i];
+			if (find(prev) == palette.size)
+				palette.push_back(prev);
+		}
+	}
+
+	int new_bits = 0;
+	while ((1u << new_bits) < palette.size)
+		new_bits = new_bits == 0 ? 1 : new_bits * 2;
+	if (new_bits > 8)
+		new_bits = DIRECT_BITS;
+
+	if (new_bits == 0)
+		return; // single block
+
+	words = std::make_unique<uint64_t[]>(word_count(new_bits)); // zeroed, so indices can be or-ed in
+	bits = new_bits;
+
+	prev = ids[0];
+	uint32_t val = bits == DIRECT_BITS ? prev : 0;
+	for (int i=0; i<CHUNK_VOXELS; ++i) {
+		if (ids[i] != prev) {
+			prev = ids[i];
+			val = bits == DIRECT_BITS ? prev : find(prev);
+		}
+		size_t bit = (size_t)i * bits;
+		words[bit >> 6] |= (uint64_t)val << (bit & 63);
+	}
+
+	if (bits == DIRECT_BITS)
+		palette.clear();
+}
+
+void ChunkBlocks::fill (block_id id) {
+	palette.clear();
+	palette.push_back(id);
+	words = nullptr;
+	bits = 0;
+}
+
+void ChunkBlocks::compact () {
+	if (bits == 0)
+		return;
+
+	// find used block ids
+	std::vector<bool> used (1 << 16, false);
+	Palette new_palette;
+
+	for (int i=0; i<CHUNK_VOXELS; ++i) {
+		block_id id = get(i);
+		if (!used[id]) {
+			used[id] = true;
+			new_palette.push_back(id);
+		}
+	}
+
+	int new_bits = 0;
+	while ((1u << new_bits) < new_palette.size)
+		new_bits = new_bits == 0 ? 1 : new_bits * 2;
+	if (new_bits > 8)
+		new_bits = DIRECT_BITS;
+
+	if (new_bits == bits && new_palette.size == palette.size)
+		return; // nothing to gain
+
+	if (new_bits == 0) {
+		fill(new_palette[0]);
+		return;
+	}
+
+	// block id -> new palette index
+	std::vector<uint16_t> remap;
+	if (new_bits != DIRECT_BITS) {
+		remap.resize(1 << 16);
+		for (uint32_t i=0; i<new_palette.size; ++i)
+			remap[new_palette[i]] = (uint16_t)i;
+	}
+
+	auto new_words = std::make_unique<uint64_t[]>(word_count(new_bits));
+	for (int i=0; i<CHUNK_VOXELS; ++i) {
+		block_id id = get(i);
+		set_index(new_words.get(), new_bits, i, new_bits == DIRECT_BITS ? id : remap[id]);
+	}
+
+	if (new_bits == DIRECT_BITS)
+		new_palette.clear();
+
+	palette = std::move(new_palette);
+	words = std::move(new_words);
+	bits = new_bits;
+}
+
+size_t ChunkBlocks::memory_usage () const {
+	size_t palette_heap = palette.is_inline() ? 0 : palette.capacity * sizeof(block_id);
+	return sizeof(ChunkBlocks) + palette_heap + word_count(bits) * sizeof(uint64_t);
+}
+
+//// Chunk
+
+void Chunk::set_block (int x, int y, int z, block_id id) {
+	blocks.set(get_voxel_index(x,y,z), id);
+
+	bool was_solid = occupancy.get(x,y,z);
+	bool solid = is_block_solid(id);
+	if (solid != was_solid) {
+		occupancy.set(x,y,z, solid);
+		solid_count += solid ? 1 : -1;
+	}
+}
+
+void Chunk::set_blocks (block_id const* ids) {
+	blocks.set_all(ids);
+
+	// rows are in voxel index order, so row r is ids[r * CHUNK_SIZE ...]
+	solid_count = 0;
+	for (int r=0; r<CHUNK_SIZE * CHUNK_SIZE; ++r) {
+		uint32_t row = 0;
+		for (int x=0; x<CHUNK_SIZE; ++x)
+			row |= (uint32_t)is_block_solid(ids[r * CHUNK_SIZE + x]) << x;
+		occupancy.rows[r] = row;
+		solid_count += popcount(row);
+	}
+}
+
+void Chunk::fill (block_id id) {
+	blocks.fill(id);
+
+	bool solid = is_block_solid(id);
+	memset(occupancy.rows, solid ? 0xff : 0, sizeof(occupancy.rows));
+	solid_count = solid ? CHUNK_VOXELS : 0;
+}
+
+//// VoxelWorld
+
+Chunk* VoxelWorld::get_or_create_chunk (chunk_coord coord) {
+	Chunk* chunk = chunks.get(coord);
+	if (!chunk) {
+		chunk = chunks.insert(std::make_unique<Chunk>(coord));
+		mark_dirty(chunk);
+		mark_dirty_neighbours(coord);
+	}
+	return chunk;
+}
+
+Chunk* VoxelWorld::insert_chunk (std::unique_ptr<Chunk> chunk) {
+	chunk_coord coord = chunk->coord;
+	chunks.remove(coord);
+
+	Chunk* c = chunks.insert(std::move(chunk));
+	mark_dirty(c);
+	mark_dirty_neighbours(coord);
+	return c;
+}
+
+std::unique_ptr<Chunk> VoxelWorld::remove_chunk (chunk_coord coord) {
+	auto chunk = chunks.remove(coord);
+	if (chunk) {
+		dirty_chunks.push_back(coord); // lets the mesher drop the mesh, can be a duplicate, but the chunk will be missing in both cases
+		mark_dirty_neighbours(coord);
+	}
+	return chunk;
+}
+
+block_id VoxelWorld::get_block (voxel_coord pos) const {
+	Chunk* chunk = chunks.get(get_chunk_coord(pos));
+	if (!chunk)
+		return B_AIR;
+
+	int3 p = get_pos_in_chunk(pos);
+	return chunk->get_block(p.x, p.y, p.z);
+}
+
+void VoxelWorld::apply_edit (BlockEdit const& e) {
+	voxel_coord pos = e.pos;
+	block_id id = e.id;
+	chunk_coord coord = get_chunk_coord(pos);
+
+	Chunk* chunk = id == B_AIR ? chunks.get(coord) : get_or_create_chunk(coord);
+	if (!chunk)
+		return; // setting air in a missing chunk, nothing to do
+
+	int3 p = get_pos_in_chunk(pos);
+	if (chunk->get_block(p.x, p.y, p.z) == id)
+		return; // no change, no remesh
+
+	chunk->set_block(p.x, p.y, p.z, id);
+	chunk->modified = true;
+
+	mark_dirty(chunk);
+	mark_dirty_neighbours(coord, p);
+}
+
+void VoxelWorld::mark_dirty_neighbours (chunk_coord coord) {
+	for (int z=-1; z<=1; ++z)
+	for (int y=-1; y<=1; ++y)
+	for (int x=-1; x<=1; ++x) {
+		Chunk* neighbour = (x|y|z) ? chunks.get(coord + int3(x,y,z)) : nullptr;
+		if (neighbour)
+			mark_dirty(neighbour);
+	}
+}
+void VoxelWorld::mark_dirty_neighbours (chunk_coord coord, int3 p) {
+	// neighbours on the sides where the voxel touches the border, diagonal ones included since ao looks at diagonal voxels
+	int lx = p.x == 0 ? -1 : 0, hx = p.x == CHUNK_SIZE_MASK ? 1 : 0;
+	int ly = p.y == 0 ? -1 : 0, hy = p.y == CHUNK_SIZE_MASK ? 1 : 0;
+	int lz = p.z == 0 ? -1 : 0, hz = p.z == CHUNK_SIZE_MASK ? 1 : 0;
+
+	for (int z=lz; z<=hz; ++z)
+	for (int y=ly; y<=hy; ++y)
+	for (int x=lx; x<=hx; ++x) {
+		if (x == 0 && y == 0 && z == 0)
+			continue;
+
+		Chunk* neighbour = chunks.get(coord + int3(x,y,z));
+		if (neighbour)
+			mark_dirty(neighbour);
+	}
+}
+
+bool VoxelWorld::is_solid (voxel_coord pos) const {
+	OccupancyChunk const* occ = get_occupancy(get_chunk_coord(pos));
+	if (!occ)
+		return false;
+
+	int3 p = get_pos_in_chunk(pos);
+	return occ->get(p.x, p.y, p.z);
+}
+
+// number of steps j >= 0 with  next + j * step_dist < t, capped to max_steps
+static int _steps_before (float next, float step_dist, float t, int max_steps) {
+	if (!(next < t))
+		return 0;
+	float n = ceilf((t - next) / step_dist);
+	return n < (float)max_steps ? (int)n : max_steps;
+}
+
+bool VoxelWorld::raycast (Ray ray, float max_dist, VoxelHit* hit) const {
+	VoxelRaycast vrc = VoxelRaycast(ray, max_dist);
+
+	int face = -1; // ray started inside block, -1 as no face was hit
+	float dist = 0;
+
+	// steps with cur_dist <= max_dist are allowed, but _steps_before counts strictly less
+	float max_dist_incl = std::nextafter(max_dist, INF);
+
+	chunk_coord cur_chunk = get_chunk_coord(vrc.cur_voxel);
+	OccupancyChunk const* occ = get_occupancy(cur_chunk);
+
+	for (;;) {
+		chunk_coord c = get_chunk_coord(vrc.cur_voxel);
+		if (!equal(c, cur_chunk)) {
+			cur_chunk = c;
+			occ = get_occupancy(c);
+		}
+
+		int3 p = get_pos_in_chunk(vrc.cur_voxel);
+
+		if (!occ) {
+			// empty or missing chunk: jump directly to the voxel where the ray leaves the chunk
+			int exit_axis = -1, exit_steps = 0;
+			float exit_dist = INF;
+			for (int a=0; a<3; ++a) {
+				if (vrc.step_delta[a] == 0) continue;
+
+				int steps = vrc.step_delta[a] > 0 ? CHUNK_SIZE - p[a] : p[a] + 1;
+				float d = vrc.next[a] + (float)(steps - 1) * vrc.step_dist[a];
+				if (d <= exit_dist) { // ties go to the later axis, like VoxelRaycast::find_next_axis
+					exit_dist = d;
+					exit_axis = a;
+					exit_steps = steps;
+				}
+			}
+
+			if (exit_axis < 0 || exit_dist > max_dist)
+				return false;
+
+			for (int a=0; a<3; ++a) {
+				if (vrc.step_delta[a] == 0) continue;
+
+				int steps = a == exit_axis ? exit_steps : _steps_before(vrc.next[a], vrc.step_dist[a], exit_dist, CHUNK_SIZE);
+				vrc.cur_voxel[a] += steps * vrc.step_delta[a];
+				vrc.next[a] += (float)steps * vrc.step_dist[a];
+			}
+
+			vrc.cur_axis = exit_axis;
+			vrc.cur_dist = exit_dist;
+			face = vrc.get_step_face();
+			dist = exit_dist;
+			continue;
+		}
+
+		uint32_t row = occ->rows[OccupancyChunk::row_index(p.y, p.z)];
+
+		if ((row >> p.x) & 1u) {
+			*hit = { vrc.cur_voxel, face, dist };
+			return true;
+		}
+
+		// test the run of voxels that the ray crosses along x before its next y or z step with one mask
+		if (vrc.step_delta.x != 0) {
+			int room = vrc.step_delta.x > 0 ? CHUNK_SIZE_MASK - p.x : p.x; // stay inside this chunk
+			int k = _steps_before(vrc.next.x, vrc.step_dist.x, min(min(vrc.next.y, vrc.next.z), max_dist_incl), room);
+
+			if (k > 0) {
+				uint64_t run = (1ull << k) - 1;
+				uint32_t run_mask = (uint32_t)(vrc.step_delta.x > 0 ? run << (p.x + 1) : run << (p.x - k));
+
+				uint32_t run_hits = row & run_mask;
+				if (run_hits) {
+					int hit_x = vrc.step_delta.x > 0 ? count_trailing_zeros(run_hits) : highest_bit_index(run_hits);
+					int j = abs(hit_x - p.x); // j-th step along x
+
+					vrc.cur_voxel.x += hit_x - p.x;
+					vrc.cur_axis = 0;
+
+					*hit = { vrc.cur_voxel, vrc.get_step_face(), vrc.next.x + (float)(j - 1) * vrc.step_dist.x };
+					return true;
+				}
+
+				// whole run is empty, skip it
+				vrc.cur_voxel.x += k * vrc.step_delta.x;
+				vrc.next.x += (float)k * vrc.step_dist.x;
+			}
+		}
+
+		if (!vrc.step())
+			return false;
+
+		face = vrc.get_step_face();
+		dist = vrc.cur_dist;
+	}
+}
+
+bool VoxelWorld::any_solid (voxel_coord lo, voxel_coord hi) const {
+	return _for_each_solid_row(lo, hi, [] (voxel_coord, uint32_t) {
+		return true;
+	});
+}
+
+void VoxelWorld::cylinder_cast (float3 cyl_pos, float3 dir, float cyl_r, float cyl_h, CollisionHit* hit) const {
+	float3 end = cyl_pos + dir;
+
+	// swept bounds of the cylinder
+	float3 lo = min(cyl_pos, end) - float3(cyl_r, cyl_r, 0);
+	float3 hi = max(cyl_pos, end) + float3(cyl_r, cyl_r, cyl_h);
+
+	for_each_solid((voxel_coord)floor(lo), (voxel_coord)floor(hi), [&] (voxel_coord pos) {
+		cylinder_cube_cast(cyl_pos - (float3)pos, dir, cyl_r, cyl_h, hit);
+	});
+}
@@ -0,0 +1,304 @@
+#pragma once
+#include "collision.hpp"
+#include "voxel_occupancy.hpp"
+#include "bit_twiddling.hpp"
+#include "raw_array.hpp"
+#include "flat_hash_map.hpp"
+#include "assert.h"
+#include <vector>
+#include <memory>
+
+typedef uint16_t block_id;
+
+static constexpr block_id B_AIR = 0;
+
+// only air is non-solid for now, occupancy masks are derived from this
+inline bool is_block_solid (block_id id) {
+	return id != B_AIR;
+}
+
+inline int get_voxel_index (int x, int y, int z) { // x,y,z in [0, CHUNK_SIZE)
+	return (z * CHUNK_SIZE + y) * CHUNK_SIZE + x;
+}
+
+// Palette compressed block ids of one chunk
+//  stores 'bits' bit indices into the palette per voxel (bits is 0,1,2,4 or 8, indices never straddle 64 bit words)
+//  bits == 0 means the whole chunk is palette[0] and no index array is allocated
+//  above 256 distinct blocks the chunk switches to direct mode (bits == 16) which stores the block ids directly and has no palette
+//  most chunks only contain a few block types, so the palette is stored inline up to PALETTE_INLINE entries
+class ChunkBlocks {
+	static constexpr int PALETTE_INLINE = 16;
+	typedef SmallVector<block_id, PALETTE_INLINE> Palette;
+
+	Palette							palette;
+	std::unique_ptr<uint64_t[]>		words;
+	int								bits = 0;
+
+	static constexpr int DIRECT_BITS = 16;
+
+	static size_t word_count (int bits) {
+		return (size_t)CHUNK_VOXELS * bits / 64;
+	}
+
+	static uint32_t get_index (uint64_t const* words, int bits, int voxel_index) {
+		size_t bit = (size_t)voxel_index * bits;
+		return (uint32_t)(words[bit >> 6] >> (bit & 63)) & ((1u << bits) - 1);
+	}
+	static void set_index (uint64_t* words, int bits, int voxel_index, uint32_t val) {
+		size_t bit = (size_t)voxel_index * bits;
+		uint64_t mask = (uint64_t)((1u << bits) - 1) << (bit & 63);
+		uint64_t& word = words[bit >> 6];
+		word = (word & ~mask) | ((uint64_t)val << (bit & 63));
+	}
+
+	// change index size (or switch to direct mode), converts all indices
+	void repack (int new_bits);
+
+public:
+	ChunkBlocks (block_id fill=B_AIR) {
+		palette.push_back(fill);
+	}
+
+	ChunkBlocks (ChunkBlocks const& other) {
+		*this = other;
+	}
+	ChunkBlocks& operator= (ChunkBlocks const& other) {
+		palette = other.palette;
+		bits = other.bits;
+		words = nullptr;
+		if (other.words) {
+			words = std::make_unique<uint64_t[]>(word_count(bits));
+			memcpy(words.get(), other.words.get(), word_count(bits) * sizeof(uint64_t));
+		}
+		return *this;
+	}
+	ChunkBlocks (ChunkBlocks&& other) = default;
+	ChunkBlocks& operator= (ChunkBlocks&& other) = default;
+
+	int get_bits () const {
+		return bits;
+	}
+	size_t palette_size () const {
+		return palette.size;
+	}
+
+	block_id get (int voxel_index) const {
+		if (bits == 0)				return palette[0];
+		if (bits == DIRECT_BITS)	return (block_id)get_index(words.get(), bits, voxel_index);
+		return palette[get_index(words.get(), bits, voxel_index)];
+	}
+	void set (int voxel_index, block_id id);
+	// set all CHUNK_VOXELS voxels from ids (in voxel index order), builds the palette and indices in one pass
+	void set_all (block_id const* ids);
+
+	// set all voxels to one block, frees the index array
+	void fill (block_id id);
+
+	// remove unused palette entries and shrink the index size if possible (eg. after bulk edits)
+	void compact ();
+
+	size_t memory_usage () const;
+};
+
+struct Chunk {
+	chunk_coord			coord;
+
+	ChunkBlocks			blocks;
+	OccupancyChunk		occupancy; // kept in sync with blocks by set_block / fill
+	int					solid_count = 0;
+
+	bool				mesh_dirty = false; // is in VoxelWorld::dirty_chunks
+	bool				modified = false; // changed by VoxelWorld::set_block since it was generated or loaded, needs to be kept when unloading
+
+	Chunk (chunk_coord coord, block_id fill=B_AIR): coord{coord} {
+		this->fill(fill);
+	}
+
+	block_id get_block (int x, int y, int z) const {
+		return blocks.get(get_voxel_index(x,y,z));
+	}
+	void set_block (int x, int y, int z, block_id id);
+	// set all voxels from ids in voxel index order (eg. from a generator)
+	void set_blocks (block_id const* ids);
+
+	void fill (block_id id);
+
+	size_t memory_usage () const {
+		return sizeof(Chunk) - sizeof(ChunkBlocks) + blocks.memory_usage();
+	}
+};
+
+// Chunk coord -> chunk, owns the chunks
+//  a FlatHashMap of unique_ptr, so Chunk pointers stay valid when the table grows (only the pointers move)
+class ChunkMap {
+	FlatHashMap<chunk_coord, std::unique_ptr<Chunk>>	map;
+
+public:
+	static uint64_t hash (chunk_coord coord) {
+		return FlatHash()(coord);
+	}
+
+	size_t size () const {
+		return map.size();
+	}
+
+	Chunk* get (chunk_coord coord) const {
+		auto* chunk = map.find(coord);
+		return chunk ? chunk->get() : nullptr;
+	}
+	// inserts chunk, coord must not be in the map already
+	Chunk* insert (std::unique_ptr<Chunk> chunk) {
+		chunk_coord coord = chunk->coord;
+		auto res = map.try_emplace(coord, std::move(chunk));
+		assert(res.second);
+		return res.first->get();
+	}
+	// returns removed chunk or nullptr
+	std::unique_ptr<Chunk> remove (chunk_coord coord) {
+		uint64_t h = map.hash(coord);
+		auto* slot = map.find(coord, h);
+		if (!slot)
+			return nullptr;
+
+		auto chunk = std::move(*slot);
+		map.erase(coord, h);
+		return chunk;
+	}
+
+	template <typename FUNC>
+	void for_each (FUNC func) const { // 'void func (Chunk*)'
+		map.for_each([&] (chunk_coord const&, std::unique_ptr<Chunk> const& chunk) {
+			func(chunk.get());
+		});
+	}
+};
+
+struct BlockEdit {
+	voxel_coord	pos;
+	block_id	id;
+};
+
+struct VoxelHit {
+	voxel_coord	voxel;
+	int			face; // -1 if ray started inside block
+	float		dist;
+};
+
+// Sparse voxel world made of chunks that only exist where they were set
+//  all queries treat missing chunks as air
+class VoxelWorld {
+public:
+	ChunkMap chunks;
+
+	// chunks that were created, changed via set_block or removed since the mesher last took them
+	std::vector<chunk_coord> dirty_chunks;
+
+	// edits get queued during the frame and applied together by apply_edits()
+	std::vector<BlockEdit> queued_edits;
+
+	void mark_dirty (Chunk* chunk) {
+		if (!chunk->mesh_dirty) {
+			chunk->mesh_dirty = true;
+			dirty_chunks.push_back(chunk->coord);
+		}
+	}
+
+	Chunk* get_chunk (chunk_coord coord) const {
+		return chunks.get(coord);
+	}
+	// a new chunk gets marked dirty with its neighbours, like insert_chunk
+	Chunk* get_or_create_chunk (chunk_coord coord);
+	// insert a fully built chunk (replaces an existing one), marks it and its neighbours dirty since their border faces depend on it
+	Chunk* insert_chunk (std::unique_ptr<Chunk> chunk);
+	// also marks the neighbours dirty, their border faces were culled against this chunk
+	std::unique_ptr<Chunk> remove_chunk (chunk_coord coord);
+
+	// for raycast_voxels_batch and OccupancyPacketLookup
+	OccupancyChunk const* get_occupancy (chunk_coord coord) const {
+		Chunk* c = chunks.get(coord);
+		return c && c->solid_count > 0 ? &c->occupancy : nullptr;
+	}
+
+	block_id get_block (voxel_coord pos) const;
+	// edits are queued and only visible to get_block etc. after the next apply_edits()
+	void set_block (voxel_coord pos, block_id id) {
+		queued_edits.push_back({ pos, id });
+	}
+	// apply queued edits in order, chunks touched by many edits still only end up in dirty_chunks once
+	void apply_edits () {
+		for (auto& e : queued_edits)
+			apply_edit(e);
+		queued_edits.clear();
+	}
+
+	bool is_solid (voxel_coord pos) const;
+
+	// Raycast against the solid voxels, uses the occupancy bitmasks instead of reading block ids
+	//  steps over empty and missing chunks without testing voxels and tests runs of voxels along x with one mask and a bit scan
+	bool raycast (Ray ray, float max_dist, VoxelHit* hit) const;
+
+	// is any voxel in [lo, hi] (inclusive) solid
+	bool any_solid (voxel_coord lo, voxel_coord hi) const;
+
+	// call 'void func (voxel_coord)' for every solid voxel in [lo, hi] (inclusive), found via bit scans over the occupancy rows
+	template <typename FUNC>
+	void for_each_solid (voxel_coord lo, voxel_coord hi, FUNC func) const {
+		_for_each_solid_row(lo, hi, [&] (voxel_coord row_pos, uint32_t bits) {
+			while (bits) {
+				int x = count_trailing_zeros(bits);
+				bits &= bits - 1;
+				func(voxel_coord(row_pos.x + x, row_pos.y, row_pos.z));
+			}
+			return false;
+		});
+	}
+
+	// Cast an axis aligned cylinder (see cylinder_cube_cast) against all solid voxels in its swept bounds
+	//  cyl_pos is the center of the bottom circle, dir is the movement (does not need to be normalized)
+	//  hit gets written to if a closer hit than hit->dist is found (init hit->dist to INF)
+	//  only blocks in the swept bounds are tested, so only hits with dist <= length(dir) are reliable
+	void cylinder_cast (float3 cyl_pos, float3 dir, float cyl_r, float cyl_h, CollisionHit* hit) const;
+
+private:
+	// marks the chunk dirty and also the neighbours if the voxel is on the chunk border (their faces and ao depend on it)
+	void apply_edit (BlockEdit const& e);
+
+	// all 26 neighbours
+	void mark_dirty_neighbours (chunk_coord coord);
+	// only the neighbours that touch the voxel
+	void mark_dirty_neighbours (chunk_coord coord, int3 pos_in_chunk);
+
+	// calls 'bool func (voxel_coord row_pos, uint32_t bits)' for every occupancy row that has solid voxels in [lo,hi]
+	//  row_pos is the voxel of bit 0, bits are already masked to the x range, return true to stop
+	// returns true if stopped
+	template <typename FUNC>
+	bool _for_each_solid_row (voxel_coord lo, voxel_coord hi, FUNC func) const;
+};
+
+template <typename FUNC>
+bool VoxelWorld::_for_each_solid_row (voxel_coord lo, voxel_coord hi, FUNC func) const {
+	chunk_coord clo = get_chunk_coord(lo);
+	chunk_coord chi = get_chunk_coord(hi);
+
+	for (int cz=clo.z; cz<=chi.z; ++cz)
+	for (int cy=clo.y; cy<=chi.y; ++cy)
+	for (int cx=clo.x; cx<=chi.x; ++cx) {
+		OccupancyChunk const* occ = get_occupancy(chunk_coord(cx,cy,cz));
+		if (!occ) continue;
+
+		voxel_coord base = voxel_coord(cx,cy,cz) * CHUNK_SIZE;
+		int3 l = max(lo - base, 0);
+		int3 h = min(hi - base, CHUNK_SIZE_MASK);
+
+		// bits l.x to h.x
+		uint32_t xmask = (uint32_t)(((2ull << h.x) - 1) & ~((1ull << l.x) - 1));
+
+		for (int z=l.z; z<=h.z; ++z)
+		for (int y=l.y; y<=h.y; ++y) {
+			uint32_t bits = occ->rows[OccupancyChunk::row_index(y,z)] & xmask;
+			if (bits && func(voxel_coord(base.x, base.y + y, base.z + z), bits))
+				return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,504 @@
+#pragma once
+#include "simd.hpp"
+#include "../kissmath.hpp"
+
+// Wide (SoA) versions of the kissmath types for batch kernels, W lanes of independent values
+//  float_w is just the simd lane type (simd::f32x4 ...), bool_w its lane mask
+//  float3_w<F> / bool3_w<M> (and float4_w / bool4_w) hold one lane type per component, so kernels can be written like the scalar float3 code
+//   and process 4, 8 or 16 values at once (width is chosen by the lane type, see WideLanes)
+//  load()/store() convert between AoS arrays of float3 / float4 and one SoA tile, load_n()/store_n() are for loop tails
+//
+//  for (size_t i=0; i<n; i += float3_w::WIDTH) {
+//  	float3_w v = float3_w::load_n(&in[i], (int)min(n - i, (size_t)float3_w::WIDTH));
+//  	normalize(v).store_n(&out[i], ...);
+//  }
+
+template <int W> struct WideLanes;
+template <> struct WideLanes<4>		{ typedef simd::f32x4 float_t; };
+#if SIMD_HAS_AVX2
+template <> struct WideLanes<8>		{ typedef simd::f32x8 float_t; };
+#else
+template <> struct WideLanes<8>		{ typedef simd::f32_pair<simd::f32x4> float_t; };
+#endif
+template <> struct WideLanes<16>	{ typedef simd::f32x16 float_t; };
+
+//// AoS float3 <-> SoA transposes for one tile (WIDTH float3 = 3*WIDTH floats)
+
+inline void load_float3_tile (float const* p, simd::f32x4* x, simd::f32x4* y, simd::f32x4* z) {
+#if SIMD_HAS_SSE2
+	__m128 a = _mm_loadu_ps(p);		// x0 y0 z0 x1
+	__m128 b = _mm_loadu_ps(p + 4);	// y1 z1 x2 y2
+	__m128 c = _mm_loadu_ps(p + 8);	// z2 x3 y3 z3
+
+	__m128 tx = _mm_shuffle_ps(b, c, _MM_SHUFFLE(0,1,0,2)); // x2 .. x3 ..
+	x->v = _mm_shuffle_ps(a, tx, _MM_SHUFFLE(2,0,3,0));
+
+	__m128 ty0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0,0,1,1)); // y0 .. y1 ..
+	__m128 ty1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2,2,3,3)); // y2 .. y3 ..
+	y->v = _mm_shuffle_ps(ty0, ty1, _MM_SHUFFLE(2,0,2,0));
+
+	__m128 tz0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1,1,2,2)); // z0 .. z1 ..
+	__m128 tz1 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,3,0,0)); // z2 .. z3 ..
+	z->v = _mm_shuffle_ps(tz0, tz1, _MM_SHUFFLE(2,0,2,0));
+#else
+	*x = simd::f32x4(p[0], p[3], p[6], p[9]);
+	*y = simd::f32x4(p[1], p[4], p[7], p[10]);
+	*z = simd::f32x4(p[2], p[5], p[8], p[11]);
+#endif
+}
+inline void store_float3_tile (float* p, simd::f32x4 x, simd::f32x4 y, simd::f32x4 z) {
+#if SIMD_HAS_SSE2
+	__m128 a0 = _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0,0,0,0)); // x0 x0 y0 y0
+	__m128 a1 = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1,1,0,0)); // z0 z0 x1 x1
+	__m128 b0 = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1,1,1,1)); // y1 y1 z1 z1
+	__m128 b1 = _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2,2,2,2)); // x2 x2 y2 y2
+	__m128 c0 = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3,3,2,2)); // z2 z2 x3 x3
+	__m128 c1 = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3,3,3,3)); // y3 y3 z3 z3
+
+	_mm_storeu_ps(p,     _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2,0,2,0)));
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2,0,2,0)));
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(c0, c1, _MM_SHUFFLE(2,0,2,0)));
+#else
+	for (int i=0; i<4; ++i) {
+		p[i*3 + 0] = x[i];
+		p[i*3 + 1] = y[i];
+		p[i*3 + 2] = z[i];
+	}
+#endif
+}
+
+#if SIMD_HAS_AVX2
+inline void load_float3_tile (float const* p, simd::f32x8* x, simd::f32x8* y, simd::f32x8* z) {
+	simd::f32x4 x0, y0, z0, x1, y1, z1;
+	load_float3_tile(p,      &x0, &y0, &z0);
+	load_float3_tile(p + 12, &x1, &y1, &z1);
+	x->v = _mm256_insertf128_ps(_mm256_castps128_ps256(x0.v), x1.v, 1);
+	y->v = _mm256_insertf128_ps(_mm256_castps128_ps256(y0.v), y1.v, 1);
+	z->v = _mm256_insertf128_ps(_mm256_castps128_ps256(z0.v), z1.v, 1);
+}
+inline void store_float3_tile (float* p, simd::f32x8 x, simd::f32x8 y, simd::f32x8 z) {
+	store_float3_tile(p,      simd::f32x4(_mm256_castps256_ps128(x.v)), simd::f32x4(_mm256_castps256_ps128(y.v)), simd::f32x4(_mm256_castps256_ps128(z.v)));
+	store_float3_tile(p + 12, simd::f32x4(_mm256_extractf128_ps(x.v, 1)), simd::f32x4(_mm256_extractf128_ps(y.v, 1)), simd::f32x4(_mm256_extractf128_ps(z.v, 1)));
+}
+#endif
+
+template <typename F>
+inline void load_float3_tile (float const* p, simd::f32_pair<F>* x, simd::f32_pair<F>* y, simd::f32_pair<F>* z) {
+	load_float3_tile(p,                  &x->lo, &y->lo, &z->lo);
+	load_float3_tile(p + 3 * F::WIDTH,   &x->hi, &y->hi, &z->hi);
+}
+template <typename F>
+inline void store_float3_tile (float* p, simd::f32_pair<F> x, simd::f32_pair<F> y, simd::f32_pair<F> z) {
+	store_float3_tile(p,                x.lo, y.lo, z.lo);
+	store_float3_tile(p + 3 * F::WIDTH, x.hi, y.hi, z.hi);
+}
+
+//// AoS float4 <-> SoA transposes for one tile (WIDTH float4 = 4*WIDTH floats)
+
+inline void load_float4_tile (float const* p, simd::f32x4* x, simd::f32x4* y, simd::f32x4* z, simd::f32x4* w) {
+#if SIMD_HAS_SSE2
+	__m128 a = _mm_loadu_ps(p);
+	__m128 b = _mm_loadu_ps(p + 4);
+	__m128 c = _mm_loadu_ps(p + 8);
+	__m128 d = _mm_loadu_ps(p + 12);
+	_MM_TRANSPOSE4_PS(a, b, c, d);
+	x->v = a;	y->v = b;	z->v = c;	w->v = d;
+#else
+	*x = simd::f32x4(p[0], p[4], p[ 8], p[12]);
+	*y = simd::f32x4(p[1], p[5], p[ 9], p[13]);
+	*z = simd::f32x4(p[2], p[6], p[10], p[14]);
+	*w = simd::f32x4(p[3], p[7], p[11], p[15]);
+#endif
+}
+inline void store_float4_tile (float* p, simd::f32x4 x, simd::f32x4 y, simd::f32x4 z, simd::f32x4 w) {
+#if SIMD_HAS_SSE2
+	_MM_TRANSPOSE4_PS(x.v, y.v, z.v, w.v);
+	_mm_storeu_ps(p,      x.v);
+	_mm_storeu_ps(p + 4,  y.v);
+	_mm_storeu_ps(p + 8,  z.v);
+	_mm_storeu_ps(p + 12, w.v);
+#else
+	for (int i=0; i<4; ++i) {
+		p[i*4 + 0] = x[i];
+		p[i*4 + 1] = y[i];
+		p[i*4 + 2] = z[i];
+		p[i*4 + 3] = w[i];
+	}
+#endif
+}
+
+#if SIMD_HAS_AVX2
+inline void load_float4_tile (float const* p, simd::f32x8* x, simd::f32x8* y, simd::f32x8* z, simd::f32x8* w) {
+	simd::f32x4 x0, y0, z0, w0, x1, y1, z1, w1;
+	load_float4_tile(p,      &x0, &y0, &z0, &w0);
+	load_float4_tile(p + 16, &x1, &y1, &z1, &w1);
+	x->v = _mm256_insertf128_ps(_mm256_castps128_ps256(x0.v), x1.v, 1);
+	y->v = _mm256_insertf128_ps(_mm256_castps128_ps256(y0.v), y1.v, 1);
+	z->v = _mm256_insertf128_ps(_mm256_castps128_ps256(z0.v), z1.v, 1);
+	w->v = _mm256_insertf128_ps(_mm256_castps128_ps256(w0.v), w1.v, 1);
+}
+inline void store_float4_tile (float* p, simd::f32x8 x, simd::f32x8 y, simd::f32x8 z, simd::f32x8 w) {
+	store_float4_tile(p,      simd::f32x4(_mm256_castps256_ps128(x.v)), simd::f32x4(_mm256_castps256_ps128(y.v)),
+	                          simd::f32x4(_mm256_castps256_ps128(z.v)), simd::f32x4(_mm256_castps256_ps128(w.v)));
+	store_float4_tile(p + 16, simd::f32x4(_mm256_extractf128_ps(x.v, 1)), simd::f32x4(_mm256_extractf128_ps(y.v, 1)),
+	                          simd::f32x4(_mm256_extractf128_ps(z.v, 1)), simd::f32x4(_mm256_extractf128_ps(w.v, 1)));
+}
+#endif
+
+template <typename F>
+inline void load_float4_tile (float const* p, simd::f32_pair<F>* x, simd::f32_pair<F>* y, simd::f32_pair<F>* z, simd::f32_pair<F>* w) {
+	load_float4_tile(p,                  &x->lo, &y->lo, &z->lo, &w->lo);
+	load_float4_tile(p + 4 * F::WIDTH,   &x->hi, &y->hi, &z->hi, &w->hi);
+}
+template <typename F>
+inline void store_float4_tile (float* p, simd::f32_pair<F> x, simd::f32_pair<F> y, simd::f32_pair<F> z, simd::f32_pair<F> w) {
+	store_float4_tile(p,                x.lo, y.lo, z.lo, w.lo);
+	store_float4_tile(p + 4 * F::WIDTH, x.hi, y.hi, z.hi, w.hi);
+}
+
+//// bool3_w
+
+template <typename M>
+struct bool3_wide {
+	M	x, y, z;
+
+	static constexpr int WIDTH = M::WIDTH;
+
+	bool3_wide () = default;
+	bool3_wide (M x, M y, M z): x{x}, y{y}, z{z} {}
+
+	friend SIMD_INLINE bool3_wide operator& (bool3_wide l, bool3_wide r) {	return { l.x & r.x, l.y & r.y, l.z & r.z }; }
+	friend SIMD_INLINE bool3_wide operator| (bool3_wide l, bool3_wide r) {	return { l.x | r.x, l.y | r.y, l.z | r.z }; }
+	friend SIMD_INLINE bool3_wide operator^ (bool3_wide l, bool3_wide r) {	return { l.x ^ r.x, l.y ^ r.y, l.z ^ r.z }; }
+	friend SIMD_INLINE bool3_wide operator~ (bool3_wide v) {				return { ~v.x, ~v.y, ~v.z }; }
+
+	// per lane: are all / any of the components true
+	friend SIMD_INLINE M all (bool3_wide v) {	return v.x & v.y & v.z; }
+	friend SIMD_INLINE M any (bool3_wide v) {	return v.x | v.y | v.z; }
+};
+
+//// float3_w
+
+template <typename F>
+struct float3_wide {
+	typedef typename F::mask_t	M;
+	typedef bool3_wide<M>		B3;
+
+	F	x, y, z;
+
+	static constexpr int WIDTH = F::WIDTH;
+
+	float3_wide () = default;
+	float3_wide (F all): x{all}, y{all}, z{all} {}
+	float3_wide (F x, F y, F z): x{x}, y{y}, z{z} {}
+	// same vector in all lanes
+	float3_wide (float3 v): x{v.x}, y{v.y}, z{v.z} {}
+
+	// WIDTH float3 from an AoS array
+	static float3_wide load (float3 const* p) {
+		float3_wide v;
+		load_float3_tile(&p->x, &v.x, &v.y, &v.z);
+		return v;
+	}
+	void store (float3* p) const {
+		store_float3_tile(&p->x, x, y, z);
+	}
+
+	// only the first n float3 (n <= WIDTH), the other lanes are 0 for loads
+	static float3_wide load_n (float3 const* p, int n) {
+		if (n >= WIDTH)
+			return load(p);
+		float3 tmp[WIDTH] = {};
+		for (int i=0; i<n; ++i)
+			tmp[i] = p[i];
+		return load(tmp);
+	}
+	void store_n (float3* p, int n) const {
+		if (n >= WIDTH) {
+			store(p);
+			return;
+		}
+		float3 tmp[WIDTH];
+		store(tmp);
+		for (int i=0; i<n; ++i)
+			p[i] = tmp[i];
+	}
+
+	// from separate x, y, z arrays (already SoA)
+	static float3_wide load_soa (float const* px, float const* py, float const* pz) {
+		return { F::load(px), F::load(py), F::load(pz) };
+	}
+	void store_soa (float* px, float* py, float* pz) const {
+		x.store(px);
+		y.store(py);
+		z.store(pz);
+	}
+
+	float3 get (int lane) const {
+		return float3(x[lane], y[lane], z[lane]);
+	}
+
+	float3_wide& operator+= (float3_wide r) {	return *this = *this + r; }
+	float3_wide& operator-= (float3_wide r) {	return *this = *this - r; }
+	float3_wide& operator*= (float3_wide r) {	return *this = *this * r; }
+	float3_wide& operator/= (float3_wide r) {	return *this = *this / r; }
+
+	//// arithmetic ops, F and float3 arguments get broadcast to all lanes
+
+	friend SIMD_INLINE float3_wide operator+ (float3_wide v) {					return v; }
+	friend SIMD_INLINE float3_wide operator- (float3_wide v) {					return { -v.x, -v.y, -v.z }; }
+	friend SIMD_INLINE float3_wide operator+ (float3_wide l, float3_wide r) {	return { l.x + r.x, l.y + r.y, l.z + r.z }; }
+	friend SIMD_INLINE float3_wide operator- (float3_wide l, float3_wide r) {	return { l.x - r.x, l.y - r.y, l.z - r.z }; }
+	friend SIMD_INLINE float3_wide operator* (float3_wide l, float3_wide r) {	return { l.x * r.x, l.y * r.y, l.z * r.z }; }
+	friend SIMD_INLINE float3_wide operator/ (float3_wide l, float3_wide r) {	return { l.x / r.x, l.y / r.y, l.z / r.z }; }
+	friend SIMD_INLINE float3_wide operator* (float3_wide l, F r) {				return { l.x * r, l.y * r, l.z * r }; }
+	friend SIMD_INLINE float3_wide operator* (F l, float3_wide r) {				return { l * r.x, l * r.y, l * r.z }; }
+	friend SIMD_INLINE float3_wide operator/ (float3_wide l, F r) {				return { l.x / r, l.y / r, l.z / r }; }
+
+	//// comparison ops
+
+	friend SIMD_INLINE B3 operator<  (float3_wide l, float3_wide r) {	return { l.x <  r.x, l.y <  r.y, l.z <  r.z }; }
+	friend SIMD_INLINE B3 operator<= (float3_wide l, float3_wide r) {	return { l.x <= r.x, l.y <= r.y, l.z <= r.z }; }
+	friend SIMD_INLINE B3 operator>  (float3_wide l, float3_wide r) {	return { l.x >  r.x, l.y >  r.y, l.z >  r.z }; }
+	friend SIMD_INLINE B3 operator>= (float3_wide l, float3_wide r) {	return { l.x >= r.x, l.y >= r.y, l.z >= r.z }; }
+	friend SIMD_INLINE B3 operator== (float3_wide l, float3_wide r) {	return { l.x == r.x, l.y == r.y, l.z == r.z }; }
+	friend SIMD_INLINE B3 operator!= (float3_wide l, float3_wide r) {	return { l.x != r.x, l.y != r.y, l.z != r.z }; }
+
+	// per lane: are all components equal
+	friend SIMD_INLINE M equal (float3_wide l, float3_wide r) {	return all(l == r); }
+
+	//// componentwise
+
+	friend SIMD_INLINE float3_wide min (float3_wide l, float3_wide r) {	return { min(l.x, r.x), min(l.y, r.y), min(l.z, r.z) }; }
+	friend SIMD_INLINE float3_wide max (float3_wide l, float3_wide r) {	return { max(l.x, r.x), max(l.y, r.y), max(l.z, r.z) }; }
+	friend SIMD_INLINE float3_wide abs (float3_wide v) {				return { abs(v.x), abs(v.y), abs(v.z) }; }
+	friend SIMD_INLINE float3_wide floor (float3_wide v) {				return { floor(v.x), floor(v.y), floor(v.z) }; }
+	friend SIMD_INLINE float3_wide clamp (float3_wide v, float3_wide lo, float3_wide hi) {	return min(max(v, lo), hi); }
+	friend SIMD_INLINE float3_wide clamp (float3_wide v) {				return clamp(v, F(0.0f), F(1.0f)); }
+	friend SIMD_INLINE float3_wide lerp (float3_wide a, float3_wide b, F t) {	return a + (b - a) * t; }
+
+	// c ? l : r per lane, or per lane and component
+	friend SIMD_INLINE float3_wide select (M c, float3_wide l, float3_wide r) {		return { select(c, l.x, r.x), select(c, l.y, r.y), select(c, l.z, r.z) }; }
+	friend SIMD_INLINE float3_wide select (B3 c, float3_wide l, float3_wide r) {	return { select(c.x, l.x, r.x), select(c.y, l.y, r.y), select(c.z, l.z, r.z) }; }
+
+	//// vector math
+
+	friend SIMD_INLINE F dot (float3_wide l, float3_wide r) {		return l.x * r.x + l.y * r.y + l.z * r.z; }
+	friend SIMD_INLINE float3_wide cross (float3_wide l, float3_wide r) {
+		return { l.y * r.z - l.z * r.y,
+		         l.z * r.x - l.x * r.z,
+		         l.x * r.y - l.y * r.x };
+	}
+	friend SIMD_INLINE F length_sqr (float3_wide v) {				return dot(v, v); }
+	friend SIMD_INLINE F length (float3_wide v) {					return sqrt(dot(v, v)); }
+	friend SIMD_INLINE F distance (float3_wide a, float3_wide b) {	return length(a - b); }
+	friend SIMD_INLINE float3_wide normalize (float3_wide v) {		return v / length(v); }
+	// zero vector for zero length lanes instead of nan
+	friend SIMD_INLINE float3_wide normalizesafe (float3_wide v) {
+		F len = length(v);
+		M nonzero = len != F(0.0f);
+		return select(nonzero, v / select(nonzero, len, F(1.0f)), float3_wide(F(0.0f)));
+	}
+
+	friend SIMD_INLINE F min_component (float3_wide v) {	return min(min(v.x, v.y), v.z); }
+	friend SIMD_INLINE F max_component (float3_wide v) {	return max(max(v.x, v.y), v.z); }
+};
+
+//// bool4_w
+
+template <typename M>
+struct bool4_wide {
+	M	x, y, z, w;
+
+	static constexpr int WIDTH = M::WIDTH;
+
+	bool4_wide () = default;
+	bool4_wide (M x, M y, M z, M w): x{x}, y{y}, z{z}, w{w} {}
+
+	friend SIMD_INLINE bool4_wide operator& (bool4_wide l, bool4_wide r) {	return { l.x & r.x, l.y & r.y, l.z & r.z, l.w & r.w }; }
+	friend SIMD_INLINE bool4_wide operator| (bool4_wide l, bool4_wide r) {	return { l.x | r.x, l.y | r.y, l.z | r.z, l.w | r.w }; }
+	friend SIMD_INLINE bool4_wide operator^ (bool4_wide l, bool4_wide r) {	return { l.x ^ r.x, l.y ^ r.y, l.z ^ r.z, l.w ^ r.w }; }
+	friend SIMD_INLINE bool4_wide operator~ (bool4_wide v) {				return { ~v.x, ~v.y, ~v.z, ~v.w }; }
+
+	// per lane: are all / any of the components true
+	friend SIMD_INLINE M all (bool4_wide v) {	return v.x & v.y & v.z & v.w; }
+	friend SIMD_INLINE M any (bool4_wide v) {	return v.x | v.y | v.z | v.w; }
+};
+
+//// float4_w
+
+template <typename F>
+struct float4_wide {
+	typedef typename F::mask_t	M;
+	typedef bool4_wide<M>		B4;
+
+	F	x, y, z, w;
+
+	static constexpr int WIDTH = F::WIDTH;
+
+	float4_wide () = default;
+	float4_wide (F all): x{all}, y{all}, z{all}, w{all} {}
+	float4_wide (F x, F y, F z, F w): x{x}, y{y}, z{z}, w{w} {}
+	float4_wide (float3_wide<F> xyz, F w): x{xyz.x}, y{xyz.y}, z{xyz.z}, w{w} {}
+	// same vector in all lanes
+	float4_wide (float4 v): x{v.x}, y{v.y}, z{v.z}, w{v.w} {}
+
+	float3_wide<F> xyz () const {	return { x, y, z }; }
+
+	// WIDTH float4 from an AoS array
+	static float4_wide load (float4 const* p) {
+		float4_wide v;
+		load_float4_tile(&p->x, &v.x, &v.y, &v.z, &v.w);
+		return v;
+	}
+	void store (float4* p) const {
+		store_float4_tile(&p->x, x, y, z, w);
+	}
+
+	// only the first n float4 (n <= WIDTH), the other lanes are 0 for loads
+	static float4_wide load_n (float4 const* p, int n) {
+		if (n >= WIDTH)
+			return load(p);
+		float4 tmp[WIDTH] = {};
+		for (int i=0; i<n; ++i)
+			tmp[i] = p[i];
+		return load(tmp);
+	}
+	void store_n (float4* p, int n) const {
+		if (n >= WIDTH) {
+			store(p);
+			return;
+		}
+		float4 tmp[WIDTH];
+		store(tmp);
+		for (int i=0; i<n; ++i)
+			p[i] = tmp[i];
+	}
+
+	// from separate x, y, z, w arrays (already SoA)
+	static float4_wide load_soa (float const* px, float const* py, float const* pz, float const* pw) {
+		return { F::load(px), F::load(py), F::load(pz), F::load(pw) };
+	}
+	void store_soa (float* px, float* py, float* pz, float* pw) const {
+		x.store(px);
+		y.store(py);
+		z.store(pz);
+		w.store(pw);
+	}
+
+	float4 get (int lane) const {
+		return float4(x[lane], y[lane], z[lane], w[lane]);
+	}
+
+	float4_wide& operator+= (float4_wide r) {	return *this = *this + r; }
+	float4_wide& operator-= (float4_wide r) {	return *this = *this - r; }
+	float4_wide& operator*= (float4_wide r) {	return *this = *this * r; }
+	float4_wide& operator/= (float4_wide r) {	return *this = *this / r; }
+
+	//// arithmetic ops, F and float4 arguments get broadcast to all lanes
+
+	friend SIMD_INLINE float4_wide operator+ (float4_wide v) {					return v; }
+	friend SIMD_INLINE float4_wide operator- (float4_wide v) {					return { -v.x, -v.y, -v.z, -v.w }; }
+	friend SIMD_INLINE float4_wide operator+ (float4_wide l, float4_wide r) {	return { l.x + r.x, l.y + r.y, l.z + r.z, l.w + r.w }; }
+	friend SIMD_INLINE float4_wide operator- (float4_wide l, float4_wide r) {	return { l.x - r.x, l.y - r.y, l.z - r.z, l.w - r.w }; }
+	friend SIMD_INLINE float4_wide operator* (float4_wide l, float4_wide r) {	return { l.x * r.x, l.y * r.y, l.z * r.z, l.w * r.w }; }
+	friend SIMD_INLINE float4_wide operator/ (float4_wide l, float4_wide r) {	return { l.x / r.x, l.y / r.y, l.z / r.z, l.w / r.w }; }
+	friend SIMD_INLINE float4_wide operator* (float4_wide l, F r) {				return { l.x * r, l.y * r, l.z * r, l.w * r }; }
+	friend SIMD_INLINE float4_wide operator* (F l, float4_wide r) {				return { l * r.x, l * r.y, l * r.z, l * r.w }; }
+	friend SIMD_INLINE float4_wide operator/ (float4_wide l, F r) {				return { l.x / r, l.y / r, l.z / r, l.w / r }; }
+
+	//// comparison ops
+
+	friend SIMD_INLINE B4 operator<  (float4_wide l, float4_wide r) {	return { l.x <  r.x, l.y <  r.y, l.z <  r.z, l.w <  r.w }; }
+	friend SIMD_INLINE B4 operator<= (float4_wide l, float4_wide r) {	return { l.x <= r.x, l.y <= r.y, l.z <= r.z, l.w <= r.w }; }
+	friend SIMD_INLINE B4 operator>  (float4_wide l, float4_wide r) {	return { l.x >  r.x, l.y >  r.y, l.z >  r.z, l.w >  r.w }; }
+	friend SIMD_INLINE B4 operator>= (float4_wide l, float4_wide r) {	return { l.x >= r.x, l.y >= r.y, l.z >= r.z, l.w >= r.w }; }
+	friend SIMD_INLINE B4 operator== (float4_wide l, float4_wide r) {	return { l.x == r.x, l.y == r.y, l.z == r.z, l.w == r.w }; }
+	friend SIMD_INLINE B4 operator!= (float4_wide l, float4_wide r) {	return { l.x != r.x, l.y != r.y, l.z != r.z, l.w != r.w }; }
+
+	// per lane: are all components equal
+	friend SIMD_INLINE M equal (float4_wide l, float4_wide r) {	return all(l == r); }
+
+	//// componentwise
+
+	friend SIMD_INLINE float4_wide min (float4_wide l, float4_wide r) {	return { min(l.x, r.x), min(l.y, r.y), min(l.z, r.z), min(l.w, r.w) }; }
+	friend SIMD_INLINE float4_wide max (float4_wide l, float4_wide r) {	return { max(l.x, r.x), max(l.y, r.y), max(l.z, r.z), max(l.w, r.w) }; }
+	friend SIMD_INLINE float4_wide abs (float4_wide v) {				return { abs(v.x), abs(v.y), abs(v.z), abs(v.w) }; }
+	friend SIMD_INLINE float4_wide floor (float4_wide v) {				return { floor(v.x), floor(v.y), floor(v.z), floor(v.w) }; }
+	friend SIMD_INLINE float4_wide clamp (float4_wide v, float4_wide lo, float4_wide hi) {	return min(max(v, lo), hi); }
+	friend SIMD_INLINE float4_wide clamp (float4_wide v) {				return clamp(v, F(0.0f), F(1.0f)); }
+	friend SIMD_INLINE float4_wide lerp (float4_wide a, float4_wide b, F t) {	return a + (b - a) * t; }
+
+	// c ? l : r per lane, or per lane and component
+	friend SIMD_INLINE float4_wide select (M c, float4_wide l, float4_wide r) {		return { select(c, l.x, r.x), select(c, l.y, r.y), select(c, l.z, r.z), select(c, l.w, r.w) }; }
+	friend SIMD_INLINE float4_wide select (B4 c, float4_wide l, float4_wide r) {	return { select(c.x, l.x, r.x), select(c.y, l.y, r.y), select(c.z, l.z, r.z), select(c.w, l.w, r.w) }; }
+
+	//// vector math
+
+	friend SIMD_INLINE F dot (float4_wide l, float4_wide r) {		return l.x * r.x + l.y * r.y + l.z * r.z + l.w * r.w; }
+	friend SIMD_INLINE F length_sqr (float4_wide v) {				return dot(v, v); }
+	friend SIMD_INLINE F length (float4_wide v) {					return sqrt(dot(v, v)); }
+	friend SIMD_INLINE F distance (float4_wide a, float4_wide b) {	return length(a - b); }
+	friend SIMD_INLINE float4_wide normalize (float4_wide v) {		return v / length(v); }
+	// zero vector for zero length lanes instead of nan
+	friend SIMD_INLINE float4_wide normalizesafe (float4_wide v) {
+		F len = length(v);
+		M nonzero = len != F(0.0f);
+		return select(nonzero, v / select(nonzero, len, F(1.0f)), float4_wide(F(0.0f)));
+	}
+
+	friend SIMD_INLINE F min_component (float4_wide v) {	return min(min(v.x, v.y), min(v.z, v.w)); }
+	friend SIMD_INLINE F max_component (float4_wide v) {	return max(max(v.x, v.y), max(v.z, v.w)); }
+};
+
+//// matrix ops, the same matrix for all lanes
+
+// m * float4(v, 1)
+template <typename F> SIMD_INLINE float3_wide<F> transform_point (float3x4 const& m, float3_wide<F> v) {
+	float3 const* c = m.arr;
+	return { F(c[0].x) * v.x + F(c[1].x) * v.y + F(c[2].x) * v.z + F(c[3].x),
+	         F(c[0].y) * v.x + F(c[1].y) * v.y + F(c[2].y) * v.z + F(c[3].y),
+	         F(c[0].z) * v.x + F(c[1].z) * v.y + F(c[2].z) * v.z + F(c[3].z) };
+}
+// m * float4(v, 0)
+template <typename F> SIMD_INLINE float3_wide<F> transform_direction (float3x4 const& m, float3_wide<F> v) {
+	float3 const* c = m.arr;
+	return { F(c[0].x) * v.x + F(c[1].x) * v.y + F(c[2].x) * v.z,
+	         F(c[0].y) * v.x + F(c[1].y) * v.y + F(c[2].y) * v.z,
+	         F(c[0].z) * v.x + F(c[1].z) * v.y + F(c[2].z) * v.z };
+}
+template <typename F> SIMD_INLINE float3_wide<F> operator* (float3x3 const& m, float3_wide<F> v) {
+	float3 const* c = m.arr;
+	return { F(c[0].x) * v.x + F(c[1].x) * v.y + F(c[2].x) * v.z,
+	         F(c[0].y) * v.x + F(c[1].y) * v.y + F(c[2].y) * v.z,
+	         F(c[0].z) * v.x + F(c[1].z) * v.y + F(c[2].z) * v.z };
+}
+// m * float4(v, 1) with perspective divide
+template <typename F> SIMD_INLINE float3_wide<F> transform_point (float4x4 const& m, float3_wide<F> v) {
+	float4 const* c = m.arr;
+	F w = F(c[0].w) * v.x + F(c[1].w) * v.y + F(c[2].w) * v.z + F(c[3].w);
+	float3_wide<F> r = { F(c[0].x) * v.x + F(c[1].x) * v.y + F(c[2].x) * v.z + F(c[3].x),
+	                     F(c[0].y) * v.x + F(c[1].y) * v.y + F(c[2].y) * v.z + F(c[3].y),
+	                     F(c[0].z) * v.x + F(c[1].z) * v.y + F(c[2].z) * v.z + F(c[3].z) };
+	return r / w;
+}
+template <typename F> SIMD_INLINE float4_wide<F> operator* (float4x4 const& m, float4_wide<F> v) {
+	float4 const* c = m.arr;
+	return { F(c[0].x) * v.x + F(c[1].x) * v.y + F(c[2].x) * v.z + F(c[3].x) * v.w,
+	         F(c[0].y) * v.x + F(c[1].y) * v.y + F(c[2].y) * v.z + F(c[3].y) * v.w,
+	         F(c[0].z) * v.x + F(c[1].z) * v.y + F(c[2].z) * v.z + F(c[3].z) * v.w,
+	         F(c[0].w) * v.x + F(c[1].w) * v.y + F(c[2].w) * v.z + F(c[3].w) * v.w };
+}
+
+//// default width
+
+#ifndef WIDE_WIDTH
+	#define WIDE_WIDTH SIMD_MAX_WIDTH // 4, 8 or 16
+#endif
+
+typedef WideLanes<WIDE_WIDTH>::float_t	float_w;
+typedef float_w::mask_t					bool_w;
+typedef float3_wide<float_w>			float3_w;
+typedef bool3_wide<bool_w>				bool3_w;
+typedef float4_wide<float_w>			float4_w;
+typedef bool4_wide<bool_w>				bool4_w;
@@ -0,0 +1,223 @@
+#include "benchmarks.hpp"
+#include "timer.hpp"
+#include "wide_math.hpp"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <stdio.h>
+
+// scalar kissmath loops vs float3_w / float4_w at 4, 8 and 16 lanes over 1M AoS vectors (AoS in and out, so the transposes are included)
+namespace {
+	const size_t N = 1000000;
+
+	struct Data {
+		std::vector<float3>	in3, out3, ref3;
+		std::vector<float4>	in4, out4, ref4;
+		std::vector<float>	outf, reff;
+		float3x4			m34;
+		float4x4			m44;
+	};
+
+	// best of 7 after one warm up run
+	template <typename FUNC> double run (FUNC f) {
+		f();
+		double best = 1e9;
+		for (int r=0; r<7; ++r) {
+			auto t = kiss::Timer::start();
+			f();
+			best = std::min(best, (double)t.end());
+		}
+		return best;
+	}
+
+	double max_err (std::vector<float3> const& a, std::vector<float3> const& b) {
+		double e = 0;
+		for (size_t i=0; i<N; ++i)
+			e = std::max(e, (double)max_component(abs(a[i] - b[i])));
+		return e;
+	}
+	double max_err (std::vector<float4> const& a, std::vector<float4> const& b) {
+		double e = 0;
+		for (size_t i=0; i<N; ++i)
+			e = std::max(e, (double)max_component(abs(a[i] - b[i])));
+		return e;
+	}
+	double max_err (std::vector<float> const& a, std::vector<float> const& b) {
+		double e = 0;
+		for (size_t i=0; i<N; ++i)
+			e = std::max(e, (double)std::abs(a[i] - b[i]));
+		return e;
+	}
+
+	struct Times {
+		double transform3, length3, normalize3, transform4;
+	};
+
+	template <typename F> Times run_wide (Data& d) {
+		typedef float3_wide<F> V3;
+		typedef float4_wide<F> V4;
+		constexpr int W = F::WIDTH;
+
+		Times t;
+		t.transform3 = run([&] {
+			for (size_t i=0; i<N; i += W) {
+				int n = (int)std::min(N - i, (size_t)W);
+				transform_point(d.m34, V3::load_n(&d.in3[i], n)).store_n(&d.out3[i], n);
+			}
+		});
+		t.length3 = run([&] {
+			for (size_t i=0; i<N; i += W) {
+				int n = (int)std::min(N - i, (size_t)W);
+				F l = length(V3::load_n(&d.in3[i], n));
+				if (n == W) {
+					l.store(&d.outf[i]);
+				} else {
+					float tmp[W];
+					l.store(tmp);
+					for (int j=0; j<n; ++j)
+						d.outf[i+j] = tmp[j];
+				}
+			}
+		});
+		t.normalize3 = run([&] {
+			for (size_t i=0; i<N; i += W) {
+				int n = (int)std::min(N - i, (size_t)W);
+				normalize(V3::load_n(&d.in3[i], n)).store_n(&d.ref3[i], n);
+			}
+		});
+		t.transform4 = run([&] {
+			for (size_t i=0; i<N; i += W) {
+				int n = (int)std::min(N - i, (size_t)W);
+				(d.m44 * V4::load_n(&d.in4[i], n)).store_n(&d.out4[i], n);
+			}
+		});
+		return t;
+	}
+
+	void print (char const* name, Times const& t, Times const* scalar) {
+		auto col = [&] (char const* label, double sec, double scalar_sec) {
+			printf("  %s %6.1f", label, N / sec / 1e6);
+			if (scalar) printf(" (x%.1f)", scalar_sec / sec);
+			else        printf("       ");
+		};
+		printf("%-11s", name);
+		col("transform3", t.transform3, scalar ? scalar->transform3 : 0);
+		col("length3",    t.length3,    scalar ? scalar->length3 : 0);
+		col("normalize3", t.normalize3, scalar ? scalar->normalize3 : 0);
+		col("transform4", t.transform4, scalar ? scalar->transform4 : 0);
+		printf("  Mvec/s\n");
+	}
+
+	template <typename F> int check_wide (char const* name, Data& d, Times const& scalar) {
+		// scalar results into the ref arrays, wide ones into out
+		for (size_t i=0; i<N; ++i) {
+			d.ref3[i] = d.m34 * d.in3[i];
+			d.reff[i] = length(d.in3[i]);
+			d.ref4[i] = d.m44 * d.in4[i];
+		}
+		Times t = run_wide<F>(d);
+		print(name, t, &scalar);
+
+		// ref3 got overwritten by the wide normalize, compare that one first
+		double e_norm = 0;
+		for (size_t i=0; i<N; ++i)
+			e_norm = std::max(e_norm, (double)max_component(abs(d.ref3[i] - normalize(d.in3[i]))));
+		for (size_t i=0; i<N; ++i)
+			d.ref3[i] = d.m34 * d.in3[i];
+
+		double e_tr3 = max_err(d.out3, d.ref3);
+		double e_len = max_err(d.outf, d.reff);
+		double e_tr4 = max_err(d.out4, d.ref4);
+		printf("            max error  transform3 %.1e  length3 %.1e  normalize3 %.1e  transform4 %.1e\n", e_tr3, e_len, e_norm, e_tr4);
+
+		// differences only come from fma contraction, anything bigger is a bug
+		return (e_tr3 > 1e-4 || e_len > 1e-4 || e_norm > 1e-5 || e_tr4 > 1e-4) ? 1 : 0;
+	}
+
+	// dot and cross may be contracted to fma differently in the scalar and wide code
+	bool near (float a, float b) {		return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::abs(b)); }
+	bool near (float3 a, float3 b) {	return near(a.x, b.x) && near(a.y, b.y) && near(a.z, b.z); }
+
+	int mismatch (char const* what, int lane) {
+		printf("%s mismatch lane %d\n", what, lane);
+		return 1;
+	}
+
+	// lane semantics against the scalar kissmath functions
+	int check_ops (Data& d) {
+		int fails = 0;
+		constexpr int W = float3_w::WIDTH;
+
+		float3 const* a3 = &d.in3[0];
+		float3 const* b3 = &d.in3[W];
+		float3_w a = float3_w::load(a3), b = float3_w::load(b3);
+		for (int i=0; i<W; ++i) {
+			if (!near(cross(a, b).get(i), cross(a3[i], b3[i])))
+				fails += mismatch("float3_w cross", i);
+			if (!near(dot(a, b)[i], dot(a3[i], b3[i])))
+				fails += mismatch("float3_w dot", i);
+			if (!equal(select(a < b, a, b).get(i), select(a3[i] < b3[i], a3[i], b3[i])))
+				fails += mismatch("float3_w select", i);
+			if (!equal(clamp(a, float3(-1), float3(1)).get(i), clamp(a3[i], -1, 1)))
+				fails += mismatch("float3_w clamp", i);
+		}
+
+		float4 const* a4 = &d.in4[0];
+		float4 const* b4 = &d.in4[W];
+		float4_w c = float4_w::load(a4), e = float4_w::load(b4);
+		for (int i=0; i<W; ++i) {
+			if (!equal((c + e).get(i), a4[i] + b4[i]))
+				fails += mismatch("float4_w add", i);
+			if (!near(dot(c, e)[i], dot(a4[i], b4[i])))
+				fails += mismatch("float4_w dot", i);
+			if (!equal(select(c < e, c, e).get(i), select(a4[i] < b4[i], a4[i], b4[i])))
+				fails += mismatch("float4_w select", i);
+			if (!equal(c.xyz().get(i), float3(a4[i].x, a4[i].y, a4[i].z)))
+				fails += mismatch("float4_w xyz", i);
+		}
+
+		// store_n must not write past n
+		float4 tail[W];
+		for (int i=0; i<W; ++i) tail[i] = float4(-1);
+		c.store_n(tail, 1);
+		if (!equal(tail[0], a4[0]) || (W > 1 && !equal(tail[1], float4(-1))))
+			fails += mismatch("float4_w store_n", 1);
+
+		if ((normalizesafe(float3_w(float3(0))).x != float_w(0.0f)).bits())
+			fails += mismatch("float3_w normalizesafe(0)", 0);
+		if ((normalizesafe(float4_w(float4(0))).x != float_w(0.0f)).bits())
+			fails += mismatch("float4_w normalizesafe(0)", 0);
+
+		printf("lane semantics %s\n", fails ? "FAILED" : "ok");
+		return fails;
+	}
+}
+
+int bench_wide_math (int argc, char** argv) {
+	Data d;
+	d.in3.resize(N);	d.out3.resize(N);	d.ref3.resize(N);
+	d.in4.resize(N);	d.out4.resize(N);	d.ref4.resize(N);
+	d.outf.resize(N);	d.reff.resize(N);
+
+	std::mt19937 rng (1);
+	std::uniform_real_distribution<float> u (-10, 10);
+	for (auto& v : d.in3) v = float3(u(rng), u(rng), u(rng));
+	for (auto& v : d.in4) v = float4(u(rng), u(rng), u(rng), u(rng));
+
+	d.m34 = float3x4::columns(float3(0.8f,0.1f,0.2f), float3(-0.1f,0.9f,0.3f), float3(0.2f,-0.3f,1.1f), float3(5,6,7));
+	d.m44 = float4x4::columns(float4(0.8f,0.1f,0.2f,0.01f), float4(-0.1f,0.9f,0.3f,0.02f), float4(0.2f,-0.3f,1.1f,-0.01f), float4(5,6,7,1));
+
+	Times scalar;
+	scalar.transform3 = run([&] { for (size_t i=0; i<N; ++i) d.ref3[i] = d.m34 * d.in3[i]; });
+	scalar.length3    = run([&] { for (size_t i=0; i<N; ++i) d.reff[i] = length(d.in3[i]); });
+	scalar.normalize3 = run([&] { for (size_t i=0; i<N; ++i) d.out3[i] = normalize(d.in3[i]); });
+	scalar.transform4 = run([&] { for (size_t i=0; i<N; ++i) d.ref4[i] = d.m44 * d.in4[i]; });
+	print("scalar", scalar, nullptr);
+
+	int fails = 0;
+	fails += check_wide<WideLanes<4>::float_t>("wide4", d, scalar);
+	fails += check_wide<WideLanes<8>::float_t>("wide8", d, scalar);
+	fails += check_wide<WideLanes<16>::float_t>("wide16", d, scalar);
+	fails += check_ops(d);
+	return fails ? 1 : 0;
+}